@@ -0,0 +1,22 @@
+#ifndef TSK_BENCHMARK_H_INCLUDED
+#define TSK_BENCHMARK_H_INCLUDED
+
+#include <time.h>
+
+#include <tsk/type.h>
+
+static inline TskF64 benchmark_now(void) {
+	struct timespec time;
+	timespec_get(&time, TIME_UTC);
+
+	return (TskF64)time.tv_sec + ((TskF64)time.tv_nsec / 1e9);
+}
+
+static inline TskU64 benchmark_random(TskU64 *state) {
+	TskU64 random = (*state += 0x9E3779B97F4A7C15ULL);
+	random        = (random ^ (random >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	random        = (random ^ (random >> 27)) * 0x94D049BB133111EBULL;
+	return random ^ (random >> 31);
+}
+
+#endif // TSK_BENCHMARK_H_INCLUDED
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/cached_type.h>
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+#define BENCHMARK_WORD_LENGTH 8
+
+static TskF64 benchmark_uncached(const TskCharacter *text, TskUSize words_length, TskU64 *checksum) {
+	TskMap words_frequency = tsk_map_new(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type));
+
+	TskF64 start           = benchmark_now();
+	for (TskUSize i = 0; i < words_length; i++) {
+		TskArrayViewConst word = tsk_array_view_const_new(
+		    tsk_array_view_const_type(tsk_character_type),
+		    &text[i * BENCHMARK_WORD_LENGTH],
+		    BENCHMARK_WORD_LENGTH,
+		    1
+		);
+		TskU64 hash = tsk_map_hash(
+		    tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type),
+		    &words_frequency,
+		    tsk_array_view_const_type(tsk_character_type),
+		    &word
+		);
+		TskU32 *frequency = tsk_map_get_or_insert_with_hash(
+		    tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type),
+		    &words_frequency,
+		    &word,
+		    &(TskU32){ 0 },
+		    hash
+		);
+		(*frequency)++;
+	}
+	TskF64 time = benchmark_now() - start;
+
+	*checksum += tsk_map_length(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type), &words_frequency);
+
+	tsk_map_drop(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type), &words_frequency);
+
+	return time;
+}
+
+static TskF64 benchmark_cached(const TskCharacter *text, TskUSize words_length, TskU64 *checksum) {
+	TskMap words_frequency = tsk_map_new(TSK_CACHED_TYPE(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type)));
+
+	TskF64 start           = benchmark_now();
+	for (TskUSize i = 0; i < words_length; i++) {
+		TskArrayViewConst word = tsk_array_view_const_new(
+		    TSK_CACHED_TYPE(tsk_array_view_const_type(tsk_character_type)),
+		    &text[i * BENCHMARK_WORD_LENGTH],
+		    BENCHMARK_WORD_LENGTH,
+		    1
+		);
+		TskU64 hash = tsk_map_hash(
+		    TSK_CACHED_TYPE(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type)),
+		    &words_frequency,
+		    TSK_CACHED_TYPE(tsk_array_view_const_type(tsk_character_type)),
+		    &word
+		);
+		TskU32 *frequency = tsk_map_get_or_insert_with_hash(
+		    TSK_CACHED_TYPE(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type)),
+		    &words_frequency,
+		    &word,
+		    &(TskU32){ 0 },
+		    hash
+		);
+		(*frequency)++;
+	}
+	TskF64 time = benchmark_now() - start;
+
+	*checksum += tsk_map_length(TSK_CACHED_TYPE(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type)), &words_frequency);
+
+	tsk_map_drop(TSK_CACHED_TYPE(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type)), &words_frequency);
+
+	return time;
+}
+
+int main(int argc, char **argv) {
+	TskUSize words_length      = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+	TskUSize vocabulary_length = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 1000;
+
+	TskCharacter *text         = malloc(words_length * BENCHMARK_WORD_LENGTH);
+	if (text == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+
+	TskU64 state = 1;
+	for (TskUSize i = 0; i < words_length; i++) {
+		TskU64 word = benchmark_random(&state) % vocabulary_length;
+		for (TskUSize j = 0; j < BENCHMARK_WORD_LENGTH; j++) {
+			text[(i * BENCHMARK_WORD_LENGTH) + j] = (TskCharacter)('a' + (word % 26));
+			word /= 26;
+		}
+	}
+
+	TskU64 uncached_checksum = 0;
+	TskU64 cached_checksum   = 0;
+	TskF64 uncached          = benchmark_uncached(text, words_length, &uncached_checksum);
+	TskF64 cached            = benchmark_cached(text, words_length, &cached_checksum);
+
+	printf("%14s %14s %10s\n", "uncached (ns)", "cached (ns)", "speedup");
+	printf(
+	    "%14.2f %14.2f %9.2fx (%llu, %llu)\n",
+	    uncached * 1e9 / (TskF64)words_length,
+	    cached * 1e9 / (TskF64)words_length,
+	    uncached / cached,
+	    (unsigned long long)uncached_checksum,
+	    (unsigned long long)cached_checksum
+	);
+
+	free(text);
+
+	return EXIT_SUCCESS;
+}
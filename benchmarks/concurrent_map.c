@@ -0,0 +1,152 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/concurrent_map.h>
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+typedef struct BenchmarkShared BenchmarkShared;
+struct BenchmarkShared {
+	const TskType   *map_type;
+	TskMap           map;
+	pthread_mutex_t  mutex;
+	const TskType   *concurrent_map_type;
+	TskConcurrentMap concurrent_map;
+	TskUSize         keys;
+	TskUSize         operations;
+};
+
+typedef struct BenchmarkThread BenchmarkThread;
+struct BenchmarkThread {
+	pthread_t        thread;
+	BenchmarkShared *shared;
+	TskU64           seed;
+	TskU64           checksum;
+};
+
+static void *benchmark_mutex_map(void *argument) {
+	BenchmarkThread *thread = argument;
+	BenchmarkShared *shared = thread->shared;
+
+	TskU64 state            = thread->seed;
+	for (TskUSize i = 0; i < shared->operations; i++) {
+		TskU64 random = benchmark_random(&state);
+		TskU64 key    = (random & 0xFFFFFFFF) % shared->keys;
+
+		(void)pthread_mutex_lock(&shared->mutex);
+		if ((random >> 32) % 10 != 0) {
+			const TskU64 *value = tsk_map_get_const(shared->map_type, &shared->map, &key);
+			thread->checksum += value != TSK_NULL ? *value : 0;
+		} else {
+			TskU64 value = random;
+			(void)tsk_map_insert(shared->map_type, &shared->map, &key, &value);
+		}
+		(void)pthread_mutex_unlock(&shared->mutex);
+	}
+
+	return TSK_NULL;
+}
+
+static void *benchmark_concurrent_map(void *argument) {
+	BenchmarkThread *thread = argument;
+	BenchmarkShared *shared = thread->shared;
+
+	TskU64 state            = thread->seed;
+	for (TskUSize i = 0; i < shared->operations; i++) {
+		TskU64 random = benchmark_random(&state);
+		TskU64 key    = (random & 0xFFFFFFFF) % shared->keys;
+
+		if ((random >> 32) % 10 != 0) {
+			TskU64 value = 0;
+			if (tsk_concurrent_map_get(shared->concurrent_map_type, &shared->concurrent_map, &key, &value)) {
+				thread->checksum += value;
+			}
+		} else {
+			TskU64 value = random;
+			(void)tsk_concurrent_map_insert(shared->concurrent_map_type, &shared->concurrent_map, &key, &value);
+		}
+	}
+
+	return TSK_NULL;
+}
+
+static TskF64 benchmark_run(BenchmarkShared *shared, void *(*function)(void *argument), TskUSize threads_length, TskU64 *checksum) {
+	BenchmarkThread *threads = malloc(threads_length * sizeof(BenchmarkThread));
+	if (threads == TSK_NULL) {
+		exit(EXIT_FAILURE);
+	}
+
+	TskF64 start = benchmark_now();
+	for (TskUSize i = 0; i < threads_length; i++) {
+		threads[i].shared   = shared;
+		threads[i].seed     = i + 1;
+		threads[i].checksum = 0;
+		if (pthread_create(&threads[i].thread, TSK_NULL, function, &threads[i]) != 0) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	for (TskUSize i = 0; i < threads_length; i++) {
+		(void)pthread_join(threads[i].thread, TSK_NULL);
+		*checksum += threads[i].checksum;
+	}
+	TskF64 time = benchmark_now() - start;
+
+	free(threads);
+
+	return time;
+}
+
+int main(int argc, char **argv) {
+	TskUSize keys          = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+	TskUSize operations    = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 1000000;
+	TskUSize shards_length = argc > 3 ? (TskUSize)strtoull(argv[3], TSK_NULL, 10) : 64;
+
+	BenchmarkShared shared = {
+		.map_type            = tsk_map_type(tsk_u64_type, tsk_u64_type),
+		.concurrent_map_type = tsk_concurrent_map_type(tsk_u64_type, tsk_u64_type),
+		.keys                = keys,
+		.operations          = operations,
+	};
+	shared.map = tsk_map_new(shared.map_type);
+	if (pthread_mutex_init(&shared.mutex, TSK_NULL) != 0 ||
+	    !tsk_concurrent_map_new(shared.concurrent_map_type, &shared.concurrent_map, shards_length)) {
+		return EXIT_FAILURE;
+	}
+
+	for (TskU64 key = 0; key < keys; key++) {
+		TskU64 value = key;
+		if (!tsk_map_insert(shared.map_type, &shared.map, &key, &value) ||
+		    !tsk_concurrent_map_insert(shared.concurrent_map_type, &shared.concurrent_map, &key, &value)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	printf("%12s %12s %20s %20s %16s\n", "threads", "shards", "mutex (Mop/s)", "sharded (Mop/s)", "speedup");
+	TskU64 checksum = 0;
+	for (TskUSize threads_length = 1; threads_length <= 64; threads_length *= 2) {
+		TskF64 mutex_time      = benchmark_run(&shared, benchmark_mutex_map, threads_length, &checksum);
+		TskF64 concurrent_time = benchmark_run(&shared, benchmark_concurrent_map, threads_length, &checksum);
+
+		printf(
+		    "%12zu %12zu %20.2f %20.2f %16.2f (%llu)\n",
+		    threads_length,
+		    shards_length,
+		    (TskF64)(threads_length * operations) / mutex_time / 1e6,
+		    (TskF64)(threads_length * operations) / concurrent_time / 1e6,
+		    mutex_time / concurrent_time,
+		    (unsigned long long)checksum
+		);
+	}
+
+	tsk_concurrent_map_drop(shared.concurrent_map_type, &shared.concurrent_map);
+	(void)pthread_mutex_destroy(&shared.mutex);
+	tsk_map_drop(shared.map_type, &shared.map);
+
+	return EXIT_SUCCESS;
+}
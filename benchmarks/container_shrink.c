@@ -0,0 +1,200 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/deque.h>
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+typedef enum BenchmarkPolicy {
+	BENCHMARK_POLICY_NONE,
+	BENCHMARK_POLICY_AUTOMATIC,
+	BENCHMARK_POLICY_SHRINK_TO_FIT,
+} BenchmarkPolicy;
+
+typedef struct BenchmarkResult BenchmarkResult;
+struct BenchmarkResult {
+	TskF64 time;
+	TskF64 peak;
+	TskF64 drained;
+};
+
+typedef BenchmarkResult (*BenchmarkFunction)(BenchmarkPolicy policy, TskUSize length, TskUSize remaining, TskU64 *checksum);
+
+static TskF64 benchmark_resident_size(void) {
+	FILE *file = fopen("/proc/self/statm", "r");
+	if (file == TSK_NULL) {
+		return 0.0;
+	}
+
+	unsigned long size     = 0;
+	unsigned long resident = 0;
+	if (fscanf(file, "%lu %lu", &size, &resident) != 2) {
+		resident = 0;
+	}
+	(void)fclose(file);
+
+	return (TskF64)resident * (TskF64)sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+}
+
+static BenchmarkResult benchmark_array(BenchmarkPolicy policy, TskUSize length, TskUSize remaining, TskU64 *checksum) {
+	const TskType *array_type = tsk_array_type(tsk_u64_type);
+
+	TskF64   start_size       = benchmark_resident_size();
+	TskF64   start            = benchmark_now();
+
+	TskArray array            = tsk_array_new(array_type);
+	tsk_array_set_automatic_shrink(array_type, &array, policy == BENCHMARK_POLICY_AUTOMATIC);
+	for (TskU64 i = 0; i < length; i++) {
+		if (!tsk_array_push_back(array_type, &array, &i)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	TskF64 peak = benchmark_resident_size() - start_size;
+
+	for (TskUSize i = remaining; i < length; i++) {
+		TskU64 element = 0;
+		(void)tsk_array_pop_back(array_type, &array, &element);
+		*checksum += element;
+	}
+	if (policy == BENCHMARK_POLICY_SHRINK_TO_FIT && !tsk_array_shrink_to_fit(array_type, &array)) {
+		exit(EXIT_FAILURE);
+	}
+
+	BenchmarkResult result = {
+		.time    = benchmark_now() - start,
+		.peak    = peak,
+		.drained = benchmark_resident_size() - start_size,
+	};
+
+	tsk_array_drop(array_type, &array);
+
+	return result;
+}
+
+static BenchmarkResult benchmark_deque(BenchmarkPolicy policy, TskUSize length, TskUSize remaining, TskU64 *checksum) {
+	const TskType *deque_type = tsk_deque_type(tsk_u64_type);
+
+	TskF64   start_size       = benchmark_resident_size();
+	TskF64   start            = benchmark_now();
+
+	TskDeque deque            = tsk_deque_new(deque_type);
+	tsk_deque_set_automatic_shrink(deque_type, &deque, policy == BENCHMARK_POLICY_AUTOMATIC);
+	for (TskU64 i = 0; i < length; i++) {
+		if (!tsk_deque_push_back(deque_type, &deque, &i)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	TskF64 peak = benchmark_resident_size() - start_size;
+
+	for (TskUSize i = remaining; i < length; i++) {
+		TskU64 element = 0;
+		(void)tsk_deque_pop_front(deque_type, &deque, &element);
+		*checksum += element;
+	}
+	if (policy == BENCHMARK_POLICY_SHRINK_TO_FIT && !tsk_deque_shrink_to_fit(deque_type, &deque)) {
+		exit(EXIT_FAILURE);
+	}
+
+	BenchmarkResult result = {
+		.time    = benchmark_now() - start,
+		.peak    = peak,
+		.drained = benchmark_resident_size() - start_size,
+	};
+
+	tsk_deque_drop(deque_type, &deque);
+
+	return result;
+}
+
+static BenchmarkResult benchmark_map(BenchmarkPolicy policy, TskUSize length, TskUSize remaining, TskU64 *checksum) {
+	const TskType *map_type   = tsk_map_type(tsk_u64_type, tsk_u64_type);
+
+	TskF64         start_size = benchmark_resident_size();
+	TskF64         start      = benchmark_now();
+
+	TskMap         map        = tsk_map_new(map_type);
+	tsk_map_set_automatic_shrink(map_type, &map, policy == BENCHMARK_POLICY_AUTOMATIC);
+	for (TskU64 i = 0; i < length; i++) {
+		TskU64 value = i;
+		if (!tsk_map_insert(map_type, &map, &i, &value)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	TskF64 peak = benchmark_resident_size() - start_size;
+
+	for (TskU64 i = remaining; i < length; i++) {
+		TskU64 value = 0;
+		(void)tsk_map_remove(map_type, &map, &i, &value);
+		*checksum += value;
+	}
+	if (policy == BENCHMARK_POLICY_SHRINK_TO_FIT && !tsk_map_shrink_to_fit(map_type, &map)) {
+		exit(EXIT_FAILURE);
+	}
+
+	BenchmarkResult result = {
+		.time    = benchmark_now() - start,
+		.peak    = peak,
+		.drained = benchmark_resident_size() - start_size,
+	};
+
+	tsk_map_drop(map_type, &map);
+
+	return result;
+}
+
+int main(int argc, char **argv) {
+	TskUSize length                  = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+	TskUSize remaining               = length / 100;
+
+	const TskCharacter *containers[] = { "array", "deque", "map" };
+	const TskCharacter *policies[]   = { "none", "automatic", "shrink_to_fit" };
+	BenchmarkFunction   benchmarks[] = {
+		benchmark_array,
+		benchmark_deque,
+		benchmark_map,
+	};
+
+	printf("%12s %16s %12s %16s %16s\n", "container", "policy", "time (s)", "peak (MiB)", "drained (MiB)");
+	(void)fflush(stdout);
+	for (TskUSize i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+		for (TskUSize j = 0; j < sizeof(policies) / sizeof(policies[0]); j++) {
+			pid_t process = fork();
+			if (process < 0) {
+				return EXIT_FAILURE;
+			}
+
+			if (process == 0) {
+				TskU64          checksum = 0;
+				BenchmarkResult result   = benchmarks[i]((BenchmarkPolicy)j, length, remaining, &checksum);
+
+				printf(
+				    "%12s %16s %12.3f %16.1f %16.1f (%llu)\n",
+				    containers[i],
+				    policies[j],
+				    result.time,
+				    result.peak,
+				    result.drained,
+				    (unsigned long long)checksum
+				);
+				(void)fflush(stdout);
+
+				_exit(EXIT_SUCCESS);
+			}
+
+			int status = 0;
+			if (waitpid(process, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
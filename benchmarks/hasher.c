@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/default_hasher.h>
+#include <tsk/map.h>
+#include <tsk/sip_hasher.h>
+#include <tsk/trait/builder.h>
+#include <tsk/trait/complete.h>
+#include <tsk/trait/hasher.h>
+
+#include "benchmark.h"
+
+static TskU64 benchmark_fnv_1a(const TskU8 *bytes, TskUSize length) {
+	TskU64 hash = 14695981039346656037ULL;
+	for (TskUSize i = 0; i < length; i++) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+static TskF64 benchmark_hash(const TskType *hasher_builder_type, const TskAny *hasher_builder, TskAny *hasher, const TskU8 *bytes, TskUSize length, TskUSize iterations, TskU64 *checksum) {
+	const TskType *hasher_type = tsk_trait_builder_built_type(hasher_builder_type);
+
+	TskF64 start               = benchmark_now();
+	for (TskUSize i = 0; i < iterations; i++) {
+		tsk_trait_builder_build(hasher_builder_type, hasher_builder, hasher);
+		tsk_trait_hasher_combine(hasher_type, hasher, bytes + (i & 63), length);
+		*checksum += tsk_trait_hasher_finalize(hasher_type, hasher);
+	}
+	return benchmark_now() - start;
+}
+
+static TskF64 benchmark_map(const TskType *hasher_builder_type, TskAny *hasher_builder, const TskU64 *keys, TskUSize length, TskU64 *checksum) {
+	const TskType *map_type = tsk_map_type(tsk_u64_type, tsk_u64_type);
+
+	TskMap map              = tsk_map_new(map_type);
+	if (hasher_builder_type != TSK_NULL && !tsk_map_with_hasher_builder(map_type, &map, hasher_builder_type, hasher_builder)) {
+		return 0.0;
+	}
+
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64 key   = keys[i];
+		TskU64 value = i;
+		if (!tsk_map_insert(map_type, &map, &key, &value)) {
+			return 0.0;
+		}
+	}
+
+	TskF64 start = benchmark_now();
+	for (TskUSize i = 0; i < length; i++) {
+		const TskU64 *value = tsk_map_get_const(map_type, &map, &keys[(i * 7919) % length]);
+		*checksum += value != TSK_NULL ? *value : 0;
+	}
+	TskF64 hit_time = benchmark_now() - start;
+
+	tsk_map_drop(map_type, &map);
+
+	return hit_time;
+}
+
+int main(int argc, char **argv) {
+	TskUSize total_bytes                   = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1 << 28;
+	TskUSize maximum_length                = 4096;
+
+	TskSipHasherBuilder sip_hasher_builder = tsk_sip_hasher_builder_random();
+
+	TskUSize hasher_size                   = tsk_trait_complete_size(tsk_trait_builder_built_type(tsk_default_hasher_builder_type));
+	if (hasher_size < tsk_trait_complete_size(tsk_trait_builder_built_type(tsk_sip_hasher_builder_type))) {
+		hasher_size = tsk_trait_complete_size(tsk_trait_builder_built_type(tsk_sip_hasher_builder_type));
+	}
+
+	TskAny *hasher = malloc(hasher_size);
+	TskU8  *bytes  = malloc(maximum_length + 64);
+	if (hasher == TSK_NULL || bytes == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+
+	TskU64 state = 0;
+	for (TskUSize i = 0; i < maximum_length + 64; i++) {
+		bytes[i] = (TskU8)benchmark_random(&state);
+	}
+
+	printf("%12s %16s %16s %16s %16s %16s %16s\n", "length", "hash (ns/op)", "hash (GB/s)", "sip (ns/op)", "sip (GB/s)", "fnv-1a (ns/op)", "fnv-1a (GB/s)");
+	TskU64 checksum = 0;
+	for (TskUSize length = 1; length <= maximum_length; length *= 2) {
+		TskUSize iterations = total_bytes / length < 1000000 ? 1000000 : total_bytes / length;
+
+		TskF64 hash_time    = benchmark_hash(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher, bytes, length, iterations, &checksum);
+		TskF64 sip_time     = benchmark_hash(tsk_sip_hasher_builder_type, &sip_hasher_builder, hasher, bytes, length, iterations, &checksum);
+
+		TskF64 start        = benchmark_now();
+		for (TskUSize i = 0; i < iterations; i++) {
+			checksum += benchmark_fnv_1a(bytes + (i & 63), length);
+		}
+		TskF64 fnv_1a_time = benchmark_now() - start;
+
+		printf(
+		    "%12zu %16.2f %16.2f %16.2f %16.2f %16.2f %16.2f (%llu)\n",
+		    length,
+		    hash_time * 1e9 / (TskF64)iterations,
+		    (TskF64)(length * iterations) / hash_time / 1e9,
+		    sip_time * 1e9 / (TskF64)iterations,
+		    (TskF64)(length * iterations) / sip_time / 1e9,
+		    fnv_1a_time * 1e9 / (TskF64)iterations,
+		    (TskF64)(length * iterations) / fnv_1a_time / 1e9,
+		    (unsigned long long)checksum
+		);
+	}
+
+	printf("%12s %16s %16s\n", "map length", "hit (ns/op)", "sip hit (ns/op)");
+	for (TskUSize length = 1000; length <= 1000000; length *= 10) {
+		TskU64 *keys = malloc(length * sizeof(TskU64));
+		if (keys == TSK_NULL) {
+			return EXIT_FAILURE;
+		}
+
+		for (TskUSize i = 0; i < length; i++) {
+			keys[i] = benchmark_random(&state);
+		}
+
+		TskF64 hit_time     = benchmark_map(TSK_NULL, TSK_NULL, keys, length, &checksum);
+		TskF64 sip_hit_time = benchmark_map(tsk_sip_hasher_builder_type, &sip_hasher_builder, keys, length, &checksum);
+
+		printf(
+		    "%12zu %16.2f %16.2f (%llu)\n",
+		    length,
+		    hit_time * 1e9 / (TskF64)length,
+		    sip_hit_time * 1e9 / (TskF64)length,
+		    (unsigned long long)checksum
+		);
+
+		free(keys);
+	}
+
+	free(bytes);
+	free(hasher);
+
+	return EXIT_SUCCESS;
+}
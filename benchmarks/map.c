@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tsk/type.h>
+
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+int main(int argc, char **argv) {
+	TskUSize     maximum_length      = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 10000000;
+	TskF32       maximum_load_factor = argc > 2 ? strtof(argv[2], TSK_NULL) : 0.875F;
+	TskMapEngine engine              = argc > 3 && strcmp(argv[3], "robin_hood") == 0 ? TSK_MAP_ENGINE_ROBIN_HOOD : TSK_MAP_ENGINE_SWISS_TABLE;
+
+	const TskType *map_type          = tsk_map_type_with_engine(tsk_u64_type, tsk_u64_type, engine);
+
+	printf("%s\n", tsk_type_name(map_type));
+	printf("%12s %16s %16s %16s %16s %16s %16s %16s\n", "length", "insert (ns/op)", "hit (ns/op)", "miss (ns/op)", "hit (Mops/s)", "bytes/entry", "max probe", "average probe");
+	for (TskUSize length = 1000; length <= maximum_length; length *= 10) {
+		TskU64 *keys = malloc(length * sizeof(TskU64));
+		if (keys == TSK_NULL) {
+			return EXIT_FAILURE;
+		}
+
+		TskU64 state = 0;
+		for (TskUSize i = 0; i < length; i++) {
+			keys[i] = benchmark_random(&state);
+		}
+
+		TskMap map = tsk_map_new(map_type);
+		if (!tsk_map_set_maximum_load_factor(map_type, &map, maximum_load_factor)) {
+			return EXIT_FAILURE;
+		}
+
+		TskF64 start = benchmark_now();
+		for (TskUSize i = 0; i < length; i++) {
+			TskU64 key   = keys[i];
+			TskU64 value = i;
+			if (!tsk_map_insert(map_type, &map, &key, &value)) {
+				return EXIT_FAILURE;
+			}
+		}
+		TskF64 insert_time = benchmark_now() - start;
+
+		TskU64 checksum    = 0;
+
+		start              = benchmark_now();
+		for (TskUSize i = 0; i < length; i++) {
+			const TskU64 *value = tsk_map_get_const(map_type, &map, &keys[(i * 7919) % length]);
+			checksum += value != TSK_NULL ? *value : 0;
+		}
+		TskF64 hit_time = benchmark_now() - start;
+
+		start           = benchmark_now();
+		for (TskUSize i = 0; i < length; i++) {
+			TskU64        key   = benchmark_random(&state);
+			const TskU64 *value = tsk_map_get_const(map_type, &map, &key);
+			checksum += value != TSK_NULL ? *value : 0;
+		}
+		TskF64 miss_time            = benchmark_now() - start;
+
+		TskUSize         bytes      = tsk_map_capacity(map_type, &map) * (sizeof(TskU64) + sizeof(TskU64) + 1);
+		TskMapStatistics statistics = tsk_map_statistics(map_type, &map);
+
+		printf(
+		    "%12zu %16.2f %16.2f %16.2f %16.2f %16.2f %16zu %16.2f (%llu)\n",
+		    length,
+		    insert_time * 1e9 / (TskF64)length,
+		    hit_time * 1e9 / (TskF64)length,
+		    miss_time * 1e9 / (TskF64)length,
+		    (TskF64)length / hit_time / 1e6,
+		    (TskF64)bytes / (TskF64)length,
+		    statistics.maximum_probe_distance,
+		    (TskF64)statistics.average_probe_distance,
+		    (unsigned long long)checksum
+		);
+
+		tsk_map_drop(map_type, &map);
+		free(keys);
+	}
+
+	return EXIT_SUCCESS;
+}
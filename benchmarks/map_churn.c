@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+int main(int argc, char **argv) {
+	TskUSize length         = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 100000;
+	TskUSize cycles         = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 100000000;
+	TskUSize lookups        = 1000000;
+
+	const TskType *map_type = tsk_map_type(tsk_u64_type, tsk_u64_type);
+
+	TskU64 *keys            = malloc(length * sizeof(TskU64));
+	if (keys == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+
+	TskU64 state = 0;
+	TskMap map   = tsk_map_new(map_type);
+	for (TskUSize i = 0; i < length; i++) {
+		keys[i]      = benchmark_random(&state);
+
+		TskU64 key   = keys[i];
+		TskU64 value = i;
+		if (!tsk_map_insert(map_type, &map, &key, &value)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	printf("%12s %16s %16s %16s %16s\n", "cycles", "churn (ns/op)", "hit (ns/op)", "miss (ns/op)", "capacity");
+	TskUSize report   = cycles / 10 != 0 ? cycles / 10 : 1;
+	TskU64   checksum = 0;
+	for (TskUSize cycle = 0; cycle < cycles;) {
+		TskF64 start = benchmark_now();
+		for (TskUSize i = 0; i < report && cycle < cycles; i++, cycle++) {
+			TskUSize index = cycle % length;
+			if (!tsk_map_remove(map_type, &map, &keys[index], TSK_NULL)) {
+				return EXIT_FAILURE;
+			}
+
+			keys[index]  = benchmark_random(&state);
+
+			TskU64 key   = keys[index];
+			TskU64 value = cycle;
+			if (!tsk_map_insert(map_type, &map, &key, &value)) {
+				return EXIT_FAILURE;
+			}
+		}
+		TskF64 churn_time = benchmark_now() - start;
+
+		start             = benchmark_now();
+		for (TskUSize i = 0; i < lookups; i++) {
+			const TskU64 *value = tsk_map_get_const(map_type, &map, &keys[(i * 7919) % length]);
+			checksum += value != TSK_NULL ? *value : 0;
+		}
+		TskF64 hit_time = benchmark_now() - start;
+
+		start           = benchmark_now();
+		for (TskUSize i = 0; i < lookups; i++) {
+			TskU64        key   = benchmark_random(&(TskU64){ state + i });
+			const TskU64 *value = tsk_map_get_const(map_type, &map, &key);
+			checksum += value != TSK_NULL ? *value : 0;
+		}
+		TskF64 miss_time = benchmark_now() - start;
+
+		printf(
+		    "%12zu %16.2f %16.2f %16.2f %16zu (%llu)\n",
+		    cycle,
+		    churn_time * 1e9 / (TskF64)report,
+		    hit_time * 1e9 / (TskF64)lookups,
+		    miss_time * 1e9 / (TskF64)lookups,
+		    tsk_map_capacity(map_type, &map),
+		    (unsigned long long)checksum
+		);
+	}
+
+	tsk_map_drop(map_type, &map);
+	free(keys);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+typedef enum BenchmarkCounter {
+	BENCHMARK_COUNTER_GET_INSERT,
+	BENCHMARK_COUNTER_GET_OR_INSERT,
+	BENCHMARK_COUNTER_ENTRY,
+} BenchmarkCounter;
+
+static TskF64 benchmark_count(BenchmarkCounter counter, const TskCharacter *vocabulary, const TskUSize *offsets, TskUSize words, TskUSize bytes, TskU64 *checksum) {
+	const TskType *word_type = tsk_array_view_const_type(tsk_character_type);
+	const TskType *map_type  = tsk_map_type(word_type, tsk_u32_type);
+
+	TskMap map               = tsk_map_new(map_type);
+	TskU64 state             = 0;
+
+	TskF64 start             = benchmark_now();
+	for (TskUSize length = 0; length < bytes;) {
+		TskUSize          index = (TskUSize)(benchmark_random(&state) % words);
+		index                   = (TskUSize)(benchmark_random(&state) % (index + 1));
+		TskArrayViewConst word  = tsk_array_view_const_new(word_type, &vocabulary[offsets[index]], offsets[index + 1] - offsets[index], 1);
+		length += offsets[index + 1] - offsets[index] + 1;
+
+		switch (counter) {
+			case BENCHMARK_COUNTER_GET_INSERT: {
+				TskU32 *frequency = tsk_map_get(map_type, &map, &word);
+				if (frequency != TSK_NULL) {
+					(*frequency)++;
+				} else if (!tsk_map_insert(map_type, &map, &word, &(TskU32){ 1 })) {
+					exit(EXIT_FAILURE);
+				}
+			} break;
+			case BENCHMARK_COUNTER_GET_OR_INSERT: {
+				TskU32 *frequency = tsk_map_get_or_insert(map_type, &map, &word, &(TskU32){ 0 });
+				if (frequency == TSK_NULL) {
+					exit(EXIT_FAILURE);
+				}
+				(*frequency)++;
+			} break;
+			case BENCHMARK_COUNTER_ENTRY: {
+				TskMapEntry entry;
+				if (!tsk_map_entry(map_type, &map, &word, &entry)) {
+					exit(EXIT_FAILURE);
+				}
+				if (tsk_map_entry_is_occupied(map_type, &entry)) {
+					(*(TskU32 *)tsk_map_entry_value(map_type, &entry))++;
+				} else {
+					tsk_map_entry_insert(map_type, &entry, &word, &(TskU32){ 1 });
+				}
+			} break;
+		}
+	}
+	TskF64 time = benchmark_now() - start;
+
+	for (TskUSize i = 0; i < words; i++) {
+		TskArrayViewConst word      = tsk_array_view_const_new(word_type, &vocabulary[offsets[i]], offsets[i + 1] - offsets[i], 1);
+		const TskU32     *frequency = tsk_map_get_const(map_type, &map, &word);
+		*checksum += frequency != TSK_NULL ? (*frequency * (i + 1)) : 0;
+	}
+
+	tsk_map_drop(map_type, &map);
+
+	return time;
+}
+
+int main(int argc, char **argv) {
+	TskUSize bytes           = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : ((TskUSize)1 << 30);
+	TskUSize words           = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 1000000;
+
+	TskCharacter *vocabulary = malloc(words * 16);
+	TskUSize     *offsets    = malloc((words + 1) * sizeof(TskUSize));
+	if (vocabulary == TSK_NULL || offsets == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+
+	TskU64 state = 0;
+	offsets[0]   = 0;
+	for (TskUSize i = 0; i < words; i++) {
+		TskUSize length = 2 + (TskUSize)(benchmark_random(&state) % 13);
+		for (TskUSize j = 0; j < length; j++) {
+			vocabulary[offsets[i] + j] = (TskCharacter)('a' + (benchmark_random(&state) % 26));
+		}
+		offsets[i + 1] = offsets[i] + length;
+	}
+
+	printf("%12s %12s %20s %20s %16s %16s\n", "bytes", "words", "get+insert (s)", "get_or_insert (s)", "entry (s)", "speedup");
+	TskU64 checksum           = 0;
+	TskF64 get_insert_time    = benchmark_count(BENCHMARK_COUNTER_GET_INSERT, vocabulary, offsets, words, bytes, &checksum);
+	TskF64 get_or_insert_time = benchmark_count(BENCHMARK_COUNTER_GET_OR_INSERT, vocabulary, offsets, words, bytes, &checksum);
+	TskF64 entry_time         = benchmark_count(BENCHMARK_COUNTER_ENTRY, vocabulary, offsets, words, bytes, &checksum);
+	printf(
+	    "%12zu %12zu %20.3f %20.3f %16.3f %16.2f (%llu)\n",
+	    bytes,
+	    words,
+	    get_insert_time,
+	    get_or_insert_time,
+	    entry_time,
+	    get_insert_time / entry_time,
+	    (unsigned long long)checksum
+	);
+
+	free(offsets);
+	free(vocabulary);
+
+	return EXIT_SUCCESS;
+}
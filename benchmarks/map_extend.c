@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/map.h>
+#include <tsk/trait/complete.h>
+#include <tsk/tuple.h>
+
+#include "benchmark.h"
+
+static TskU64 benchmark_checksum(const TskType *map_type, const TskMap *map, TskUSize length) {
+	TskU64 checksum = tsk_map_length(map_type, map);
+
+	TskU64 state    = 1;
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64        key   = benchmark_random(&state);
+		const TskU64 *value = tsk_map_get_const(map_type, map, &key);
+		checksum += value != TSK_NULL ? *value : 0;
+	}
+
+	return checksum;
+}
+
+static TskF64 benchmark_insert(const TskType *map_type, TskArrayView items, TskUSize length, TskU64 *checksum) {
+	const TskType *item_type  = tsk_map_item_type(map_type);
+	const TskType *items_type = tsk_array_view_type(item_type);
+
+	TskF64 start              = benchmark_now();
+	TskMap map                = tsk_map_new(map_type);
+	for (TskUSize i = 0; i < length; i++) {
+		TskTuple *item = tsk_array_view_get(items_type, items, i);
+		if (!tsk_map_insert(map_type, &map, tsk_tuple_get(item_type, item, 0), tsk_tuple_get(item_type, item, 1))) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	TskF64 time = benchmark_now() - start;
+
+	*checksum += benchmark_checksum(map_type, &map, length);
+	tsk_map_drop(map_type, &map);
+
+	return time;
+}
+
+static TskF64 benchmark_extend(const TskType *map_type, TskArrayView items, TskUSize length, TskBoolean unique, TskU64 *checksum) {
+	TskF64 start = benchmark_now();
+	TskMap map   = tsk_map_new(map_type);
+	if (!tsk_map_extend(map_type, &map, items, unique)) {
+		exit(EXIT_FAILURE);
+	}
+	TskF64 time = benchmark_now() - start;
+
+	*checksum += benchmark_checksum(map_type, &map, length);
+	tsk_map_drop(map_type, &map);
+
+	return time;
+}
+
+int main(int argc, char **argv) {
+	TskUSize length = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+
+	printf("%12s %16s %16s %16s %12s %12s\n", "engine", "insert (Mop/s)", "extend (Mop/s)", "unique (Mop/s)", "speedup", "unique");
+	TskU64 checksum = 0;
+	for (TskUSize i = 0; i < 2; i++) {
+		TskMapEngine   engine     = i == 0 ? TSK_MAP_ENGINE_SWISS_TABLE : TSK_MAP_ENGINE_ROBIN_HOOD;
+		const TskType *map_type   = tsk_map_type_with_engine(tsk_u64_type, tsk_u64_type, engine);
+		const TskType *item_type  = tsk_map_item_type(map_type);
+		const TskType *items_type = tsk_array_view_type(item_type);
+
+		TskU8 *elements           = malloc(length * tsk_trait_complete_size(item_type));
+		if (elements == TSK_NULL) {
+			return EXIT_FAILURE;
+		}
+
+		TskU64 state = 1;
+		for (TskUSize j = 0; j < length; j++) {
+			TskTuple *item                               = elements + (j * tsk_trait_complete_size(item_type));
+			*(TskU64 *)tsk_tuple_get(item_type, item, 0) = benchmark_random(&state);
+			*(TskU64 *)tsk_tuple_get(item_type, item, 1) = j;
+		}
+		TskArrayView items = tsk_array_view_new(items_type, elements, length, 1);
+
+		TskF64 insert_time = benchmark_insert(map_type, items, length, &checksum);
+		TskF64 extend_time = benchmark_extend(map_type, items, length, TSK_FALSE, &checksum);
+		TskF64 unique_time = benchmark_extend(map_type, items, length, TSK_TRUE, &checksum);
+
+		printf(
+		    "%12s %16.2f %16.2f %16.2f %12.2f %12.2f (%llu)\n",
+		    engine == TSK_MAP_ENGINE_SWISS_TABLE ? "swiss" : "robin hood",
+		    (TskF64)length / insert_time / 1e6,
+		    (TskF64)length / extend_time / 1e6,
+		    (TskF64)length / unique_time / 1e6,
+		    insert_time / extend_time,
+		    insert_time / unique_time,
+		    (unsigned long long)checksum
+		);
+
+		free(elements);
+	}
+
+	return EXIT_SUCCESS;
+}
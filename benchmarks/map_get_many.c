@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/map.h>
+#include <tsk/reference.h>
+
+#include "benchmark.h"
+
+int main(int argc, char **argv) {
+	TskUSize length              = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 16000000;
+	TskUSize lookups             = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 4000000;
+
+	const TskType *map_type      = tsk_map_type(tsk_u64_type, tsk_u64_type);
+	const TskType *keys_type     = tsk_array_view_const_type(tsk_u64_type);
+	const TskType *values_type   = tsk_array_view_type(tsk_reference_const_type(tsk_u64_type));
+
+	TskU64        *keys          = malloc(length * sizeof(TskU64));
+	TskU64        *lookup_keys   = malloc(lookups * sizeof(TskU64));
+	const TskU64 **lookup_values = malloc(lookups * sizeof(const TskU64 *));
+	if (keys == TSK_NULL || lookup_keys == TSK_NULL || lookup_values == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+
+	TskU64 state = 0;
+	TskMap map   = tsk_map_new(map_type);
+	for (TskUSize i = 0; i < length; i++) {
+		keys[i]      = benchmark_random(&state);
+
+		TskU64 key   = keys[i];
+		TskU64 value = i;
+		if (!tsk_map_insert(map_type, &map, &key, &value)) {
+			return EXIT_FAILURE;
+		}
+	}
+	for (TskUSize i = 0; i < lookups; i++) {
+		lookup_keys[i] = (i & 1) == 0 ? keys[benchmark_random(&state) % length] : benchmark_random(&state);
+	}
+
+	printf("%12s %12s %16s %16s %16s\n", "length", "batch", "loop (ns/op)", "batch (ns/op)", "speedup");
+	TskU64 checksum = 0;
+	for (TskUSize batch = 32; batch <= 256; batch *= 2) {
+		TskF64 start = benchmark_now();
+		for (TskUSize i = 0; i < lookups; i++) {
+			lookup_values[i] = tsk_map_get_const(map_type, &map, &lookup_keys[i]);
+		}
+		TskF64 loop_time = benchmark_now() - start;
+		for (TskUSize i = 0; i < lookups; i++) {
+			checksum += lookup_values[i] != TSK_NULL ? *lookup_values[i] : 0;
+		}
+
+		start = benchmark_now();
+		for (TskUSize i = 0; i < lookups; i += batch) {
+			TskUSize count = lookups - i < batch ? lookups - i : batch;
+			tsk_map_get_many_const(
+			    map_type,
+			    &map,
+			    tsk_array_view_const_new(keys_type, &lookup_keys[i], count, 1),
+			    tsk_array_view_new(values_type, (TskAny *)&lookup_values[i], count, 1)
+			);
+		}
+		TskF64 batch_time = benchmark_now() - start;
+		for (TskUSize i = 0; i < lookups; i++) {
+			checksum += lookup_values[i] != TSK_NULL ? *lookup_values[i] : 0;
+		}
+
+		printf(
+		    "%12zu %12zu %16.2f %16.2f %16.2f (%llu)\n",
+		    length,
+		    batch,
+		    loop_time * 1e9 / (TskF64)lookups,
+		    batch_time * 1e9 / (TskF64)lookups,
+		    loop_time / batch_time,
+		    (unsigned long long)checksum
+		);
+	}
+
+	tsk_map_drop(map_type, &map);
+	free(lookup_values);
+	free(lookup_keys);
+	free(keys);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+static int benchmark_compare(const void *latency_1, const void *latency_2) {
+	TskF64 a = *(const TskF64 *)latency_1;
+	TskF64 b = *(const TskF64 *)latency_2;
+	return (a > b) - (a < b);
+}
+
+static TskF64 benchmark_run(const TskType *map_type, TskBoolean incremental_resize, TskUSize length, TskF64 *latencies, TskU64 *checksum) {
+	TskMap map = tsk_map_new(map_type);
+	tsk_map_set_incremental_resize(map_type, &map, incremental_resize);
+
+	TskU64 state = 1;
+	TskF64 start = benchmark_now();
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64     key          = benchmark_random(&state);
+		TskU64     value        = i;
+
+		TskF64     insert_start = benchmark_now();
+		TskBoolean inserted     = tsk_map_insert(map_type, &map, &key, &value);
+		latencies[i]            = benchmark_now() - insert_start;
+
+		if (!inserted) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	TskF64 time = benchmark_now() - start;
+
+	state       = 1;
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64        key   = benchmark_random(&state);
+		const TskU64 *value = tsk_map_get_const(map_type, &map, &key);
+		*checksum += value != TSK_NULL ? *value : 0;
+	}
+
+	tsk_map_drop(map_type, &map);
+
+	qsort(latencies, length, sizeof(TskF64), benchmark_compare);
+
+	return time;
+}
+
+int main(int argc, char **argv) {
+	TskUSize length   = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 10000000;
+
+	TskF64 *latencies = malloc(length * sizeof(TskF64));
+	if (latencies == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+
+	printf("%12s %12s %12s %12s %12s %12s %12s\n", "engine", "resize", "total (s)", "p50 (ns)", "p99 (ns)", "p999 (ns)", "max (us)");
+	TskU64 checksum = 0;
+	for (TskUSize i = 0; i < 2; i++) {
+		TskMapEngine   engine   = i == 0 ? TSK_MAP_ENGINE_SWISS_TABLE : TSK_MAP_ENGINE_ROBIN_HOOD;
+		const TskType *map_type = tsk_map_type_with_engine(tsk_u64_type, tsk_u64_type, engine);
+
+		for (TskUSize j = 0; j < 2; j++) {
+			TskBoolean incremental_resize = j == 1;
+			TskF64     time               = benchmark_run(map_type, incremental_resize, length, latencies, &checksum);
+
+			printf(
+			    "%12s %12s %12.3f %12.0f %12.0f %12.0f %12.1f (%llu)\n",
+			    engine == TSK_MAP_ENGINE_SWISS_TABLE ? "swiss" : "robin hood",
+			    incremental_resize ? "incremental" : "stop",
+			    time,
+			    latencies[length / 2] * 1e9,
+			    latencies[length - 1 - (length / 100)] * 1e9,
+			    latencies[length - 1 - (length / 1000)] * 1e9,
+			    latencies[length - 1] * 1e6,
+			    (unsigned long long)checksum
+			);
+		}
+	}
+
+	free(latencies);
+
+	return EXIT_SUCCESS;
+}
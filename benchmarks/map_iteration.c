@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/map.h>
+#include <tsk/trait/iterable.h>
+#include <tsk/trait/iterator.h>
+
+#include "benchmark.h"
+
+static TskF64 benchmark_iterator(const TskType *map_type, TskMap *map, TskU64 *checksum) {
+	const TskType *map_iterator_type = tsk_map_iterator_type_with_map_type(map_type);
+
+	struct {
+		const TskU64 *key;
+		TskU64       *value;
+	} item;
+
+	TskF64 start = benchmark_now();
+	for (TskMapIterator iterator = tsk_map_iterator(map_type, map); tsk_map_iterator_next(map_iterator_type, &iterator, &item);) {
+		*checksum += *item.key ^ *item.value;
+	}
+
+	return benchmark_now() - start;
+}
+
+static TskF64 benchmark_iterator_const(const TskType *map_type, const TskMap *map, TskU64 *checksum) {
+	const TskType *map_iterator_type = tsk_map_iterator_const_type_with_map_type(map_type);
+
+	struct {
+		const TskU64 *key;
+		const TskU64 *value;
+	} item;
+
+	TskF64 start = benchmark_now();
+	for (TskMapIteratorConst iterator = tsk_map_iterator_const(map_type, map); tsk_map_iterator_const_next(map_iterator_type, &iterator, &item);) {
+		*checksum += *item.key ^ *item.value;
+	}
+
+	return benchmark_now() - start;
+}
+
+static TskF64 benchmark_iterable(const TskType *map_type, const TskMap *map, TskU64 *checksum) {
+	const TskType *iterator_type = tsk_trait_iterable_const_iterator_type(map_type);
+
+	struct {
+		const TskU64 *key;
+		const TskU64 *value;
+	} item;
+
+	TskF64              start = benchmark_now();
+	TskMapIteratorConst iterator;
+	tsk_trait_iterable_const_iterator(map_type, map, &iterator);
+	while (tsk_trait_iterator_next(iterator_type, &iterator, &item)) {
+		*checksum += *item.key ^ *item.value;
+	}
+
+	return benchmark_now() - start;
+}
+
+int main(int argc, char **argv) {
+	TskUSize length = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 10000000;
+
+	printf("%12s %12s %12s %12s %14s %14s\n", "engine", "occupancy", "entries", "iterator (ns)", "const (ns)", "iterable (ns)");
+	for (TskUSize i = 0; i < 2; i++) {
+		TskMapEngine   engine   = i == 0 ? TSK_MAP_ENGINE_SWISS_TABLE : TSK_MAP_ENGINE_ROBIN_HOOD;
+		const TskType *map_type = tsk_map_type_with_engine(tsk_u64_type, tsk_u64_type, engine);
+
+		TskMap         map      = tsk_map_new(map_type);
+		TskU64         state    = 1;
+		for (TskUSize j = 0; j < length; j++) {
+			TskU64 key   = benchmark_random(&state);
+			TskU64 value = j;
+			if (!tsk_map_insert(map_type, &map, &key, &value)) {
+				return EXIT_FAILURE;
+			}
+		}
+
+		for (TskUSize j = 0; j < 2; j++) {
+			if (j == 1) {
+				state = 1;
+				for (TskUSize k = 0; k < length; k++) {
+					TskU64 key = benchmark_random(&state);
+					if (k % 16 != 0) {
+						(void)tsk_map_remove(map_type, &map, &key, TSK_NULL);
+					}
+				}
+			}
+
+			TskU64   checksum = 0;
+			TskUSize entries  = tsk_map_length(map_type, &map);
+			TskF64   iterator = benchmark_iterator(map_type, &map, &checksum);
+			TskF64   constant = benchmark_iterator_const(map_type, &map, &checksum);
+			TskF64   iterable = benchmark_iterable(map_type, &map, &checksum);
+
+			printf(
+			    "%12s %11.1f%% %12zu %13.2f %14.2f %14.2f (%llu)\n",
+			    engine == TSK_MAP_ENGINE_SWISS_TABLE ? "swiss" : "robin hood",
+			    100.0 * (TskF64)entries / (TskF64)tsk_map_capacity(map_type, &map),
+			    entries,
+			    iterator * 1e9 / (TskF64)entries,
+			    constant * 1e9 / (TskF64)entries,
+			    iterable * 1e9 / (TskF64)entries,
+			    (unsigned long long)checksum
+			);
+		}
+
+		tsk_map_drop(map_type, &map);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+static TskEmpty benchmark_run(const TskType *map_type, const TskU64 *keys, TskUSize length, TskF64 *insert_time, TskF64 *hit_time, TskF64 *miss_time, TskU64 *checksum) {
+	TskMap map   = tsk_map_new(map_type);
+
+	TskF64 start = benchmark_now();
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64 key   = keys[i];
+		TskU64 value = i;
+		if (!tsk_map_insert(map_type, &map, &key, &value)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	*insert_time = benchmark_now() - start;
+
+	start        = benchmark_now();
+	for (TskUSize i = 0; i < length; i++) {
+		const TskU64 *value = tsk_map_get_const(map_type, &map, &keys[(i * 7919) % length]);
+		*checksum += value != TSK_NULL ? *value : 0;
+	}
+	*hit_time    = benchmark_now() - start;
+
+	TskU64 state = length;
+	start        = benchmark_now();
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64        key   = benchmark_random(&state);
+		const TskU64 *value = tsk_map_get_const(map_type, &map, &key);
+		*checksum += value != TSK_NULL ? *value : 0;
+	}
+	*miss_time = benchmark_now() - start;
+
+	tsk_map_drop(map_type, &map);
+}
+
+int main(int argc, char **argv) {
+	TskUSize maximum_length = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 10000000;
+
+	printf("%12s %12s %12s %16s %16s %16s\n", "engine", "layout", "length", "insert (ns/op)", "hit (ns/op)", "miss (ns/op)");
+	TskU64 checksum = 0;
+	for (TskUSize length = 1000; length <= maximum_length; length *= 10) {
+		TskU64 *keys = malloc(length * sizeof(TskU64));
+		if (keys == TSK_NULL) {
+			return EXIT_FAILURE;
+		}
+
+		TskU64 state = 0;
+		for (TskUSize i = 0; i < length; i++) {
+			keys[i] = benchmark_random(&state);
+		}
+
+		for (TskUSize i = 0; i < 4; i++) {
+			TskMapEngine   engine   = i / 2 == 0 ? TSK_MAP_ENGINE_SWISS_TABLE : TSK_MAP_ENGINE_ROBIN_HOOD;
+			TskMapLayout   layout   = i % 2 == 0 ? TSK_MAP_LAYOUT_SPLIT : TSK_MAP_LAYOUT_INTERLEAVED;
+			const TskType *map_type = tsk_map_type_with_layout(tsk_u64_type, tsk_u64_type, engine, layout);
+
+			TskF64 insert_time      = 0.0;
+			TskF64 hit_time         = 0.0;
+			TskF64 miss_time        = 0.0;
+			benchmark_run(map_type, keys, length, &insert_time, &hit_time, &miss_time, &checksum);
+
+			printf(
+			    "%12s %12s %12zu %16.2f %16.2f %16.2f (%llu)\n",
+			    engine == TSK_MAP_ENGINE_SWISS_TABLE ? "swiss" : "robin hood",
+			    layout == TSK_MAP_LAYOUT_SPLIT ? "split" : "interleaved",
+			    length,
+			    insert_time / (TskF64)length * 1e9,
+			    hit_time / (TskF64)length * 1e9,
+			    miss_time / (TskF64)length * 1e9,
+			    (unsigned long long)checksum
+			);
+		}
+
+		free(keys);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/map.h>
+#include <tsk/trait/complete.h>
+#include <tsk/tuple.h>
+
+#include "benchmark.h"
+
+int main(int argc, char **argv) {
+	TskUSize length           = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 10000000;
+	TskUSize maximum_threads  = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 16;
+
+	const TskType *map_type   = tsk_map_type(tsk_u64_type, tsk_u64_type);
+	const TskType *item_type  = tsk_map_item_type(map_type);
+	const TskType *items_type = tsk_array_view_type(item_type);
+
+	TskU8         *elements   = malloc(length * tsk_trait_complete_size(item_type));
+	if (elements == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+	TskArrayView items = tsk_array_view_new(items_type, elements, length, 1);
+
+	TskU64 state       = 1;
+	for (TskUSize i = 0; i < length; i++) {
+		TskTuple *item                               = tsk_array_view_get(items_type, items, i);
+		*(TskU64 *)tsk_tuple_get(item_type, item, 0) = benchmark_random(&state);
+		*(TskU64 *)tsk_tuple_get(item_type, item, 1) = i;
+	}
+
+	printf("%12s %16s %16s %16s %16s\n", "threads", "extend (s)", "clone (s)", "clear (s)", "speedup");
+	TskU64 checksum      = 0;
+	TskF64 baseline_time = 0.0;
+	for (TskUSize threads_length = 1; threads_length <= maximum_threads; threads_length *= 2) {
+		TskMap map   = tsk_map_new(map_type);
+
+		TskF64 start = benchmark_now();
+		if (!tsk_map_parallel_extend(map_type, &map, items, TSK_TRUE, threads_length)) {
+			return EXIT_FAILURE;
+		}
+		TskF64 extend_time = benchmark_now() - start;
+
+		TskMap clone;
+		start = benchmark_now();
+		if (!tsk_map_parallel_clone(map_type, &map, &clone, threads_length)) {
+			return EXIT_FAILURE;
+		}
+		TskF64 clone_time = benchmark_now() - start;
+
+		start             = benchmark_now();
+		tsk_map_parallel_clear(map_type, &clone, threads_length);
+		TskF64 clear_time = benchmark_now() - start;
+
+		state             = 1;
+		for (TskUSize i = 0; i < length; i += 64) {
+			TskU64        key   = benchmark_random(&state);
+			const TskU64 *value = tsk_map_get_const(map_type, &map, &key);
+			checksum += value != TSK_NULL ? *value : 0;
+		}
+		checksum += tsk_map_length(map_type, &map);
+
+		tsk_map_drop(map_type, &clone);
+		tsk_map_drop(map_type, &map);
+
+		if (threads_length == 1) {
+			baseline_time = extend_time;
+		}
+
+		printf(
+		    "%12zu %16.3f %16.3f %16.3f %16.2f (%llu)\n",
+		    threads_length,
+		    extend_time,
+		    clone_time,
+		    clear_time,
+		    baseline_time / extend_time,
+		    (unsigned long long)checksum
+		);
+	}
+
+	free(elements);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/map.h>
+#include <tsk/rcu_map.h>
+
+#include "benchmark.h"
+
+typedef struct BenchmarkShared BenchmarkShared;
+struct BenchmarkShared {
+	const TskType  *map_type;
+	TskMap          map;
+	pthread_mutex_t mutex;
+	const TskType  *rcu_map_type;
+	TskRcuMap       rcu_map;
+	TskUSize        keys;
+	TskUSize        operations;
+	atomic_bool     stop;
+	TskUSize        writes;
+};
+
+typedef struct BenchmarkThread BenchmarkThread;
+struct BenchmarkThread {
+	pthread_t        thread;
+	BenchmarkShared *shared;
+	TskU64           seed;
+	TskU64           checksum;
+};
+
+static void *benchmark_mutex_map_reader(void *argument) {
+	BenchmarkThread *thread = argument;
+	BenchmarkShared *shared = thread->shared;
+
+	TskU64 state            = thread->seed;
+	for (TskUSize i = 0; i < shared->operations; i++) {
+		TskU64 key = benchmark_random(&state) % shared->keys;
+
+		(void)pthread_mutex_lock(&shared->mutex);
+		const TskU64 *value = tsk_map_get_const(shared->map_type, &shared->map, &key);
+		thread->checksum += value != TSK_NULL ? *value : 0;
+		(void)pthread_mutex_unlock(&shared->mutex);
+	}
+
+	return TSK_NULL;
+}
+
+static void *benchmark_mutex_map_writer(void *argument) {
+	BenchmarkShared *shared = argument;
+
+	for (TskU64 key = shared->keys; !atomic_load_explicit(&shared->stop, memory_order_relaxed); key++) {
+		TskU64 value = key;
+
+		(void)pthread_mutex_lock(&shared->mutex);
+		(void)tsk_map_insert(shared->map_type, &shared->map, &key, &value);
+		(void)tsk_map_remove(shared->map_type, &shared->map, &(TskU64){ key - shared->keys }, &value);
+		(void)pthread_mutex_unlock(&shared->mutex);
+
+		shared->writes++;
+	}
+
+	return TSK_NULL;
+}
+
+static void *benchmark_rcu_map_reader(void *argument) {
+	BenchmarkThread *thread = argument;
+	BenchmarkShared *shared = thread->shared;
+
+	TskU64 state            = thread->seed;
+	for (TskUSize i = 0; i < shared->operations; i++) {
+		TskU64 key   = benchmark_random(&state) % shared->keys;
+
+		TskU64 value = 0;
+		if (tsk_rcu_map_get(shared->rcu_map_type, &shared->rcu_map, &key, &value)) {
+			thread->checksum += value;
+		}
+	}
+
+	return TSK_NULL;
+}
+
+static void *benchmark_rcu_map_writer(void *argument) {
+	BenchmarkShared *shared = argument;
+
+	for (TskU64 key = shared->keys; !atomic_load_explicit(&shared->stop, memory_order_relaxed); key++) {
+		TskU64 value = key;
+
+		(void)tsk_rcu_map_insert(shared->rcu_map_type, &shared->rcu_map, &key, &value);
+		(void)tsk_rcu_map_remove(shared->rcu_map_type, &shared->rcu_map, &(TskU64){ key - shared->keys });
+
+		shared->writes++;
+	}
+
+	return TSK_NULL;
+}
+
+static TskF64 benchmark_run(BenchmarkShared *shared, void *(*reader)(void *argument), void *(*writer)(void *argument), TskUSize threads_length, TskU64 *checksum) {
+	BenchmarkThread *threads = malloc(threads_length * sizeof(BenchmarkThread));
+	if (threads == TSK_NULL) {
+		exit(EXIT_FAILURE);
+	}
+
+	atomic_store(&shared->stop, TSK_FALSE);
+	shared->writes = 0;
+
+	pthread_t writer_thread;
+	if (pthread_create(&writer_thread, TSK_NULL, writer, shared) != 0) {
+		exit(EXIT_FAILURE);
+	}
+
+	TskF64 start = benchmark_now();
+	for (TskUSize i = 0; i < threads_length; i++) {
+		threads[i].shared   = shared;
+		threads[i].seed     = i + 1;
+		threads[i].checksum = 0;
+		if (pthread_create(&threads[i].thread, TSK_NULL, reader, &threads[i]) != 0) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	for (TskUSize i = 0; i < threads_length; i++) {
+		(void)pthread_join(threads[i].thread, TSK_NULL);
+		*checksum += threads[i].checksum;
+	}
+	TskF64 time = benchmark_now() - start;
+
+	atomic_store(&shared->stop, TSK_TRUE);
+	(void)pthread_join(writer_thread, TSK_NULL);
+
+	free(threads);
+
+	return time;
+}
+
+static TskBoolean benchmark_fill(BenchmarkShared *shared) {
+	tsk_map_clear(shared->map_type, &shared->map);
+	tsk_rcu_map_drop(shared->rcu_map_type, &shared->rcu_map);
+	if (!tsk_rcu_map_new(shared->rcu_map_type, &shared->rcu_map)) {
+		return TSK_FALSE;
+	}
+
+	for (TskU64 key = 0; key < shared->keys; key++) {
+		TskU64 value = key;
+		if (!tsk_map_insert(shared->map_type, &shared->map, &key, &value) ||
+		    !tsk_rcu_map_insert(shared->rcu_map_type, &shared->rcu_map, &key, &value)) {
+			return TSK_FALSE;
+		}
+	}
+
+	return TSK_TRUE;
+}
+
+int main(int argc, char **argv) {
+	TskUSize keys          = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+	TskUSize operations    = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 1000000;
+
+	BenchmarkShared shared = {
+		.map_type     = tsk_map_type(tsk_u64_type, tsk_u64_type),
+		.rcu_map_type = tsk_rcu_map_type(tsk_u64_type, tsk_u64_type),
+		.keys         = keys,
+		.operations   = operations,
+	};
+	shared.map = tsk_map_new(shared.map_type);
+	if (pthread_mutex_init(&shared.mutex, TSK_NULL) != 0 ||
+	    !tsk_rcu_map_new(shared.rcu_map_type, &shared.rcu_map)) {
+		return EXIT_FAILURE;
+	}
+
+	printf("%12s %20s %20s %16s %16s %16s\n", "readers", "mutex (Mop/s)", "rcu (Mop/s)", "speedup", "mutex writes", "rcu writes");
+	TskU64 checksum = 0;
+	for (TskUSize threads_length = 1; threads_length <= 64; threads_length *= 2) {
+		if (!benchmark_fill(&shared)) {
+			return EXIT_FAILURE;
+		}
+
+		TskF64   mutex_time   = benchmark_run(&shared, benchmark_mutex_map_reader, benchmark_mutex_map_writer, threads_length, &checksum);
+		TskUSize mutex_writes = shared.writes;
+		TskF64   rcu_time     = benchmark_run(&shared, benchmark_rcu_map_reader, benchmark_rcu_map_writer, threads_length, &checksum);
+		TskUSize rcu_writes   = shared.writes;
+
+		printf(
+		    "%12zu %20.2f %20.2f %16.2f %16zu %16zu (%llu)\n",
+		    threads_length,
+		    (TskF64)(threads_length * operations) / mutex_time / 1e6,
+		    (TskF64)(threads_length * operations) / rcu_time / 1e6,
+		    mutex_time / rcu_time,
+		    mutex_writes,
+		    rcu_writes,
+		    (unsigned long long)checksum
+		);
+	}
+
+	tsk_rcu_map_drop(shared.rcu_map_type, &shared.rcu_map);
+	(void)pthread_mutex_destroy(&shared.mutex);
+	tsk_map_drop(shared.map_type, &shared.map);
+
+	return EXIT_SUCCESS;
+}
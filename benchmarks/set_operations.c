@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/map.h>
+#include <tsk/set.h>
+
+#include "benchmark.h"
+
+static TskEmpty benchmark_map_fill(const TskType *map_type, TskMap *map, TskU64 seed, TskUSize length) {
+	TskU64 state = seed;
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64 key = benchmark_random(&state) % (length * 2);
+		TskUnit value;
+		if (!tsk_map_insert(map_type, map, &key, &value)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
+static TskEmpty benchmark_set_fill(const TskType *set_type, TskSet *set, TskU64 seed, TskUSize length) {
+	TskU64 state = seed;
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64 element = benchmark_random(&state) % (length * 2);
+		if (!tsk_set_insert(set_type, set, &element)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
+static TskEmpty benchmark_map(TskUSize length_1, TskUSize length_2, TskU64 *checksum) {
+	const TskType *map_type = tsk_map_type(tsk_u64_type, tsk_unit_type);
+
+	TskMap         map_1    = tsk_map_new(map_type);
+	TskMap         map_2    = tsk_map_new(map_type);
+
+	TskF64         start    = benchmark_now();
+	benchmark_map_fill(map_type, &map_1, 1, length_1);
+	benchmark_map_fill(map_type, &map_2, 2, length_2);
+	TskF64 insert = benchmark_now() - start;
+
+	start         = benchmark_now();
+	TskU64 state  = 3;
+	for (TskUSize i = 0; i < length_1; i++) {
+		TskU64 key = benchmark_random(&state) % (length_1 * 2);
+		*checksum += tsk_map_get_const(map_type, &map_1, &key) != TSK_NULL;
+	}
+	TskF64 contains = benchmark_now() - start;
+
+	struct {
+		const TskU64  *key;
+		const TskUnit *value;
+	} item;
+
+	start        = benchmark_now();
+	TskMap map_3 = tsk_map_new(map_type);
+	for (TskMapIteratorConst iterator = tsk_map_iterator_const(map_type, &map_2); tsk_map_iterator_const_next(tsk_map_iterator_const_type_with_map_type(map_type), &iterator, &item);) {
+		TskU64  key = *item.key;
+		TskUnit value;
+		if (tsk_map_get_const(map_type, &map_1, &key) != TSK_NULL && !tsk_map_insert(map_type, &map_3, &key, &value)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	TskF64 intersection = benchmark_now() - start;
+	*checksum += tsk_map_length(map_type, &map_3);
+
+	start = benchmark_now();
+	TskMap map_4;
+	if (!tsk_map_clone(map_type, &map_1, &map_4)) {
+		exit(EXIT_FAILURE);
+	}
+	for (TskMapIteratorConst iterator = tsk_map_iterator_const(map_type, &map_2); tsk_map_iterator_const_next(tsk_map_iterator_const_type_with_map_type(map_type), &iterator, &item);) {
+		TskU64  key = *item.key;
+		TskUnit value;
+		if (tsk_map_get_const(map_type, &map_4, &key) == TSK_NULL && !tsk_map_insert(map_type, &map_4, &key, &value)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	TskF64 union_ = benchmark_now() - start;
+	*checksum += tsk_map_length(map_type, &map_4);
+
+	printf("%12s %12.3f %12.3f %14.3f %12.3f (%llu)\n", "map", insert, contains, intersection, union_, (unsigned long long)*checksum);
+
+	tsk_map_drop(map_type, &map_1);
+	tsk_map_drop(map_type, &map_2);
+	tsk_map_drop(map_type, &map_3);
+	tsk_map_drop(map_type, &map_4);
+}
+
+static TskEmpty benchmark_set(TskUSize length_1, TskUSize length_2, TskU64 *checksum) {
+	const TskType *set_type = tsk_set_type(tsk_u64_type);
+
+	TskSet         set_1    = tsk_set_new(set_type);
+	TskSet         set_2    = tsk_set_new(set_type);
+
+	TskF64         start    = benchmark_now();
+	benchmark_set_fill(set_type, &set_1, 1, length_1);
+	benchmark_set_fill(set_type, &set_2, 2, length_2);
+	TskF64 insert = benchmark_now() - start;
+
+	start         = benchmark_now();
+	TskU64 state  = 3;
+	for (TskUSize i = 0; i < length_1; i++) {
+		TskU64 element = benchmark_random(&state) % (length_1 * 2);
+		*checksum += tsk_set_contains(set_type, &set_1, &element);
+	}
+	TskF64 contains = benchmark_now() - start;
+
+	start           = benchmark_now();
+	TskSet set_3;
+	if (!tsk_set_intersection(set_type, &set_1, &set_2, &set_3)) {
+		exit(EXIT_FAILURE);
+	}
+	TskF64 intersection = benchmark_now() - start;
+	*checksum += tsk_set_length(set_type, &set_3);
+
+	start = benchmark_now();
+	TskSet set_4;
+	if (!tsk_set_union(set_type, &set_1, &set_2, &set_4)) {
+		exit(EXIT_FAILURE);
+	}
+	TskF64 union_ = benchmark_now() - start;
+	*checksum += tsk_set_length(set_type, &set_4);
+
+	printf("%12s %12.3f %12.3f %14.3f %12.3f (%llu)\n", "set", insert, contains, intersection, union_, (unsigned long long)*checksum);
+
+	tsk_set_drop(set_type, &set_1);
+	tsk_set_drop(set_type, &set_2);
+	tsk_set_drop(set_type, &set_3);
+	tsk_set_drop(set_type, &set_4);
+}
+
+int main(int argc, char **argv) {
+	TskUSize length_1 = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 4000000;
+	TskUSize length_2 = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : length_1 / 16;
+
+	printf("%12s %12s %12s %14s %12s\n", "container", "insert (s)", "contains (s)", "intersect (s)", "union (s)");
+	TskU64 map_checksum = 0;
+	benchmark_map(length_1, length_2, &map_checksum);
+	TskU64 set_checksum = 0;
+	benchmark_set(length_1, length_2, &set_checksum);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+
+#include "benchmark.h"
+
+int main(int argc, char **argv) {
+	TskUSize length                = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+	TskUSize repetitions           = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 20;
+
+	const TskType *array_type      = tsk_array_type(tsk_u64_type);
+	const TskType *array_view_type = tsk_array_view_type(tsk_u64_type);
+
+	TskArray       array           = tsk_array_new(array_type);
+	if (!tsk_array_reserve(array_type, &array, length)) {
+		return EXIT_FAILURE;
+	}
+	TskU64 state = 1;
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64 element = benchmark_random(&state);
+		if (!tsk_array_push_back(array_type, &array, &element)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	TskU64 checksum = 0;
+	TskF64 start    = benchmark_now();
+	for (TskUSize repetition = 0; repetition < repetitions; repetition++) {
+		for (TskUSize i = 0; i < length; i++) {
+			checksum += *(const TskU64 *)tsk_array_get(array_type, &array, i);
+		}
+	}
+	TskF64 get_time  = benchmark_now() - start;
+
+	TskF64 sort_time = 0;
+	for (TskUSize repetition = 0; repetition < repetitions; repetition++) {
+		state = repetition + 1;
+		for (TskUSize i = 0; i < length; i++) {
+			*(TskU64 *)tsk_array_get(array_type, &array, i) = benchmark_random(&state);
+		}
+
+		start = benchmark_now();
+		tsk_array_view_sort(array_view_type, tsk_array_view_new(array_view_type, tsk_array_elements(array_type, &array), length, 1));
+		sort_time += benchmark_now() - start;
+
+		checksum += *(const TskU64 *)tsk_array_get(array_type, &array, length / 2);
+	}
+
+	printf("%10s %16s %16s\n", "length", "get (ns)", "sort (ns)");
+	printf(
+	    "%10zu %16.2f %16.2f (%llu)\n",
+	    length,
+	    get_time * 1e9 / (TskF64)(length * repetitions),
+	    sort_time * 1e9 / (TskF64)(length * repetitions),
+	    (unsigned long long)checksum
+	);
+
+	tsk_array_drop(array_type, &array);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/deque.h>
+#include <tsk/map.h>
+
+#include "benchmark.h"
+
+int main(int argc, char **argv) {
+	TskUSize length           = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+	TskUSize repetitions      = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 20;
+
+	const TskType *array_type = tsk_array_type(tsk_u64_type);
+	const TskType *deque_type = tsk_deque_type(tsk_u64_type);
+	const TskType *map_type   = tsk_map_type(tsk_u64_type, tsk_u64_type);
+
+	TskF64 array_clone_time   = 0;
+	TskF64 array_clear_time   = 0;
+	TskF64 deque_clear_time   = 0;
+	TskF64 map_clear_time     = 0;
+	TskU64 checksum           = 0;
+
+	TskArray array            = tsk_array_new(array_type);
+	TskDeque deque            = tsk_deque_new(deque_type);
+	TskMap   map              = tsk_map_new(map_type);
+	tsk_array_set_automatic_shrink(array_type, &array, TSK_FALSE);
+	tsk_deque_set_automatic_shrink(deque_type, &deque, TSK_FALSE);
+	tsk_map_set_automatic_shrink(map_type, &map, TSK_FALSE);
+
+	for (TskUSize repetition = 0; repetition < repetitions; repetition++) {
+		for (TskU64 i = 0; i < length; i++) {
+			TskU64 element = i + repetition;
+			if (!tsk_array_push_back(array_type, &array, &element) ||
+			    !tsk_deque_push_back(deque_type, &deque, &element) ||
+			    !tsk_map_insert(map_type, &map, &(TskU64){ i }, &element)) {
+				return EXIT_FAILURE;
+			}
+		}
+
+		TskArray clone = { 0 };
+		TskF64   start = benchmark_now();
+		if (!tsk_array_clone(array_type, &array, &clone)) {
+			return EXIT_FAILURE;
+		}
+		array_clone_time += benchmark_now() - start;
+
+		checksum += *(const TskU64 *)tsk_array_get(array_type, &clone, length - 1);
+		tsk_array_drop(array_type, &clone);
+
+		start = benchmark_now();
+		tsk_array_clear(array_type, &array);
+		array_clear_time += benchmark_now() - start;
+
+		start = benchmark_now();
+		tsk_deque_clear(deque_type, &deque);
+		deque_clear_time += benchmark_now() - start;
+
+		start = benchmark_now();
+		tsk_map_clear(map_type, &map);
+		map_clear_time += benchmark_now() - start;
+	}
+
+	printf("%10s %18s %18s %18s %18s\n", "length", "array clone (ns)", "array clear (ns)", "deque clear (ns)", "map clear (ns)");
+	printf(
+	    "%10zu %18.3f %18.3f %18.3f %18.3f (%llu)\n",
+	    length,
+	    array_clone_time * 1e9 / (TskF64)(length * repetitions),
+	    array_clear_time * 1e9 / (TskF64)(length * repetitions),
+	    deque_clear_time * 1e9 / (TskF64)(length * repetitions),
+	    map_clear_time * 1e9 / (TskF64)(length * repetitions),
+	    (unsigned long long)checksum
+	);
+
+	tsk_array_drop(array_type, &array);
+	tsk_deque_drop(deque_type, &deque);
+	tsk_map_drop(map_type, &map);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/reference.h>
+
+#include "benchmark.h"
+
+int main(int argc, char **argv) {
+	TskUSize maximum_length = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 100000;
+	TskUSize lookups_length = argc > 2 ? (TskUSize)strtoull(argv[2], TSK_NULL, 10) : 1000000;
+
+	const TskType **types   = malloc((maximum_length + 1) * sizeof(const TskType *));
+	if (types == TSK_NULL) {
+		return EXIT_FAILURE;
+	}
+	types[0]        = tsk_u8_type;
+
+	TskUSize length = 0;
+
+	printf("%10s %16s %16s\n", "types", "register (ns)", "lookup (ns)");
+	for (TskUSize target_length = 100; target_length <= maximum_length; target_length *= 10) {
+		TskUSize previous_length = length;
+		TskF64   start           = benchmark_now();
+		for (; length < target_length; length++) {
+			types[length + 1] = tsk_reference_type(types[length]);
+			if (types[length + 1] == TSK_NULL) {
+				return EXIT_FAILURE;
+			}
+		}
+		TskF64 register_time = benchmark_now() - start;
+
+		TskU64 state         = 1;
+		TskU64 checksum      = 0;
+		start                = benchmark_now();
+		for (TskUSize i = 0; i < lookups_length; i++) {
+			TskUSize index = benchmark_random(&state) % length;
+			if (tsk_reference_type(types[index]) != types[index + 1]) {
+				return EXIT_FAILURE;
+			}
+			checksum += index;
+		}
+		TskF64 lookup_time = benchmark_now() - start;
+
+		printf(
+		    "%10zu %16.2f %16.2f (%llu)\n",
+		    length,
+		    register_time * 1e9 / (TskF64)(length - previous_length),
+		    lookup_time * 1e9 / (TskF64)lookups_length,
+		    (unsigned long long)checksum
+		);
+	}
+
+	free(types);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <tsk/type.h>
+
+#include <tsk/array.h>
+#include <tsk/map.h>
+#include <tsk/typed_array.h>
+#include <tsk/typed_map.h>
+
+#include "benchmark.h"
+
+TSK_ARRAY_DEFINE(u32, TskU32)
+TSK_MAP_DEFINE(u64, TskU64, u64, TskU64)
+
+typedef TskF64 (*BenchmarkFunction)(TskBoolean typed, TskUSize length, TskU64 *checksum);
+
+static TskEmpty benchmark_fill(TskArray *array, TskUSize length) {
+	TskU64 state = 1;
+	for (TskUSize i = 0; i < length; i++) {
+		if (!tsk_array_u32_push_back(array, (TskU32)benchmark_random(&state))) {
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
+static TskF64 benchmark_sort(TskBoolean typed, TskUSize length, TskU64 *checksum) {
+	TskArray array = tsk_array_u32_new();
+	benchmark_fill(&array, length);
+
+	TskF64 start = benchmark_now();
+	if (typed) {
+		tsk_array_u32_sort(&array);
+	} else {
+		tsk_array_view_sort(tsk_array_view_type(tsk_u32_type), tsk_array_view(tsk_array_type(tsk_u32_type), &array));
+	}
+	TskF64 time = benchmark_now() - start;
+
+	for (TskUSize i = 0; i < length; i += length / 64) {
+		*checksum += *tsk_array_u32_get_const(&array, i);
+	}
+
+	tsk_array_u32_drop(&array);
+
+	return time;
+}
+
+static TskF64 benchmark_search(TskBoolean typed, TskUSize length, TskU64 *checksum) {
+	TskArray array = tsk_array_u32_new();
+	benchmark_fill(&array, length);
+	tsk_array_u32_sort(&array);
+
+	TskU64 state = 1;
+	TskF64 start = benchmark_now();
+	for (TskUSize i = 0; i < length; i++) {
+		TskU32 element = (TskU32)benchmark_random(&state);
+		if (typed) {
+			*checksum += tsk_array_view_u32_lower_bound(tsk_array_u32_view(&array), element);
+		} else {
+			*checksum += tsk_array_view_lower_bound(tsk_array_view_type(tsk_u32_type), tsk_array_view(tsk_array_type(tsk_u32_type), &array), &element);
+		}
+	}
+	TskF64 time = benchmark_now() - start;
+
+	tsk_array_u32_drop(&array);
+
+	return time;
+}
+
+static TskF64 benchmark_lookup(TskBoolean typed, TskUSize length, TskU64 *checksum) {
+	TskMap map   = tsk_map_u64_u64_new();
+	TskU64 state = 1;
+	for (TskUSize i = 0; i < length; i++) {
+		if (!tsk_map_u64_u64_insert(&map, benchmark_random(&state), i)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	state        = 1;
+	TskF64 start = benchmark_now();
+	for (TskUSize i = 0; i < length; i++) {
+		TskU64        key   = benchmark_random(&state);
+		const TskU64 *value = TSK_NULL;
+		if (typed) {
+			value = tsk_map_u64_u64_get_const(&map, key);
+		} else {
+			value = tsk_map_get_const(tsk_map_type(tsk_u64_type, tsk_u64_type), &map, &key);
+		}
+		*checksum += value != TSK_NULL ? *value : 0;
+	}
+	TskF64 time = benchmark_now() - start;
+
+	tsk_map_u64_u64_drop(&map);
+
+	return time;
+}
+
+int main(int argc, char **argv) {
+	TskUSize length = argc > 1 ? (TskUSize)strtoull(argv[1], TSK_NULL, 10) : 1000000;
+
+	printf("%12s %14s %14s %10s\n", "operation", "erased (ns)", "typed (ns)", "speedup");
+	const TskCharacter *operations[] = { "sort", "search", "lookup" };
+	BenchmarkFunction   benchmarks[] = {
+		benchmark_sort,
+		benchmark_search,
+		benchmark_lookup,
+	};
+	for (TskUSize i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+		TskU64 erased_checksum = 0;
+		TskU64 typed_checksum  = 0;
+		TskF64 erased          = benchmarks[i](TSK_FALSE, length, &erased_checksum);
+		TskF64 typed           = benchmarks[i](TSK_TRUE, length, &typed_checksum);
+
+		printf(
+		    "%12s %14.2f %14.2f %9.2fx (%llu, %llu)\n",
+		    operations[i],
+		    erased * 1e9 / (TskF64)length,
+		    typed * 1e9 / (TskF64)length,
+		    erased / typed,
+		    (unsigned long long)erased_checksum,
+		    (unsigned long long)typed_checksum
+		);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -69,7 +69,7 @@ void inspect_type(const TskType *type) {
 	printf("type information:\n");
 	printf("\tname: %s\n", type->name);
 	printf("\ttraits:\n");
-	for (TskUSize i = 0; i < type->trait_table->capacity; i++) {
+	for (TskUSize i = 0; i < TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH + type->trait_table->capacity; i++) {
 		if (type->trait_table->entries[i].trait_data != TSK_NULL) {
 			printf("\t\ttrait_id: %zu, trait_data: %p\n", type->trait_table->entries[i].trait_id, type->trait_table->entries[i].trait_data);
 		}
@@ -75,7 +75,8 @@ int main(void) {
 	    1
 	);
 
-	TskMap words_frequency = tsk_map_new(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type));
+	const TskType *words_frequency_type = tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type);
+	TskMap         words_frequency      = tsk_map_new(words_frequency_type);
 
 	TskArrayViewConst word;
 	while (!tsk_array_view_const_is_empty(
@@ -87,7 +88,7 @@ int main(void) {
 	    )
 	)) {
 		TskU32 *frequency = tsk_map_get_or_insert(
-		    tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type),
+		    words_frequency_type,
 		    &words_frequency,
 		    &word,
 		    &(TskU32){ 0 }
@@ -101,7 +102,7 @@ int main(void) {
 	} item;
 	for (
 	    TskMapIteratorConst iterator = tsk_map_iterator_const(
-	        tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type),
+	        words_frequency_type,
 	        &words_frequency
 	    );
 	    tsk_map_iterator_const_next(
@@ -118,6 +119,6 @@ int main(void) {
 		);
 	}
 
-	tsk_map_drop(tsk_map_type(tsk_array_view_const_type(tsk_character_type), tsk_u32_type), &words_frequency);
+	tsk_map_drop(words_frequency_type, &words_frequency);
 	tsk_array_drop(tsk_array_type(tsk_character_type), &text);
 }
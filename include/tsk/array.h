@@ -10,9 +10,10 @@ extern "C" {
 
 typedef struct TskArray TskArray;
 struct TskArray {
-	TskAny  *elements;
-	TskUSize length;
-	TskUSize capacity;
+	TskAny    *elements;
+	TskUSize   length;
+	TskUSize   capacity;
+	TskBoolean automatic_shrink;
 };
 TskBoolean     tsk_array_is_valid(const TskType *array_type, const TskArray *array);
 TskArray       tsk_array_new(const TskType *array_type);
@@ -25,6 +26,8 @@ TskUSize       tsk_array_length(const TskType *array_type, const TskArray *array
 TskBoolean     tsk_array_is_empty(const TskType *array_type, const TskArray *array);
 TskUSize       tsk_array_capacity(const TskType *array_type, const TskArray *array);
 TskUSize       tsk_array_maximum_capacity(const TskType *array_type);
+TskBoolean     tsk_array_automatic_shrink(const TskType *array_type, const TskArray *array);
+TskEmpty       tsk_array_set_automatic_shrink(const TskType *array_type, TskArray *array, TskBoolean automatic_shrink);
 TskAny        *tsk_array_get(const TskType *array_type, TskArray *array, TskUSize index);
 const TskAny  *tsk_array_get_const(const TskType *array_type, const TskArray *array, TskUSize index);
 TskAny        *tsk_array_front(const TskType *array_type, TskArray *array);
@@ -34,6 +37,8 @@ const TskAny  *tsk_array_back_const(const TskType *array_type, const TskArray *a
 TskEmpty       tsk_array_clear(const TskType *array_type, TskArray *array);
 TskBoolean     tsk_array_reserve(const TskType *array_type, TskArray *array, TskUSize capacity);
 TskBoolean     tsk_array_reserve_additional(const TskType *array_type, TskArray *array, TskUSize additional);
+TskBoolean     tsk_array_shrink_to_fit(const TskType *array_type, TskArray *array);
+TskBoolean     tsk_array_shrink_to(const TskType *array_type, TskArray *array, TskUSize capacity);
 TskBoolean     tsk_array_insert(const TskType *array_type, TskArray *array, TskUSize index, TskAny *elements, TskUSize count);
 TskEmpty       tsk_array_remove(const TskType *array_type, TskArray *array, TskUSize index, TskAny *elements, TskUSize count);
 TskBoolean     tsk_array_push_front(const TskType *array_type, TskArray *array, TskAny *element);
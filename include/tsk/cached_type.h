@@ -0,0 +1,38 @@
+#ifndef TSK_CACHED_TYPE_H_INCLUDED
+#define TSK_CACHED_TYPE_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/type.h>
+
+#include <stdatomic.h>
+
+static inline const TskType *tsk_cached_type_load(_Atomic(const TskType *) *cache) {
+	return atomic_load_explicit(cache, memory_order_acquire);
+}
+static inline const TskType *tsk_cached_type_store(_Atomic(const TskType *) *cache, const TskType *type) {
+	if (type != TSK_NULL) {
+		atomic_store_explicit(cache, type, memory_order_release);
+	}
+	return type;
+}
+
+// clang-format off
+#if defined(__GNUC__) || defined(__clang__)
+	#define TSK_CACHED_TYPE(expression) __extension__({\
+		static _Atomic(const TskType *) tsk_cached_type_cache_ = TSK_NULL;\
+		const TskType *tsk_cached_type_ = tsk_cached_type_load(&tsk_cached_type_cache_);\
+		tsk_cached_type_ != TSK_NULL ? tsk_cached_type_ : tsk_cached_type_store(&tsk_cached_type_cache_, (expression));\
+	})
+#else
+	#define TSK_CACHED_TYPE(expression) (expression)
+#endif
+// clang-format on
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_CACHED_TYPE_H_INCLUDED
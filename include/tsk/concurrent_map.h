@@ -0,0 +1,42 @@
+#ifndef TSK_CONCURRENT_MAP_H_INCLUDED
+#define TSK_CONCURRENT_MAP_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/map.h>
+#include <tsk/type.h>
+
+typedef struct TskConcurrentMapShard TskConcurrentMapShard;
+
+typedef struct TskConcurrentMap TskConcurrentMap;
+struct TskConcurrentMap {
+	TskMap                 prototype;
+	TskConcurrentMapShard *shards;
+	TskUSize               shards_length;
+};
+TskBoolean     tsk_concurrent_map_is_valid(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map);
+TskBoolean     tsk_concurrent_map_new(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, TskUSize shards_length);
+TskBoolean     tsk_concurrent_map_with_hasher_builder(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, TskUSize shards_length, const TskType *hasher_builder_type, TskAny *hasher_builder);
+TskEmpty       tsk_concurrent_map_drop(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map);
+const TskType *tsk_concurrent_map_key_type(const TskType *concurrent_map_type);
+const TskType *tsk_concurrent_map_value_type(const TskType *concurrent_map_type);
+const TskType *tsk_concurrent_map_map_type(const TskType *concurrent_map_type);
+TskUSize       tsk_concurrent_map_shards_length(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map);
+TskUSize       tsk_concurrent_map_length(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map);
+TskBoolean     tsk_concurrent_map_is_empty(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map);
+TskBoolean     tsk_concurrent_map_contains(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map, const TskAny *key);
+TskBoolean     tsk_concurrent_map_get(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map, const TskAny *key, TskAny *value);
+TskEmpty       tsk_concurrent_map_clear(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map);
+TskBoolean     tsk_concurrent_map_insert(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, TskAny *key, TskAny *value);
+TskBoolean     tsk_concurrent_map_remove(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, const TskAny *key, TskAny *value);
+
+TskBoolean     tsk_concurrent_map_type_is_valid(const TskType *concurrent_map_type);
+const TskType *tsk_concurrent_map_type(const TskType *key_type, const TskType *value_type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_CONCURRENT_MAP_H_INCLUDED
@@ -11,10 +11,11 @@ extern "C" {
 
 typedef struct TskDeque TskDeque;
 struct TskDeque {
-	TskAny **segments;
-	TskUSize segments_length;
-	TskUSize front_index;
-	TskUSize back_index;
+	TskAny   **segments;
+	TskUSize   segments_length;
+	TskUSize   front_index;
+	TskUSize   back_index;
+	TskBoolean automatic_shrink;
 };
 TskBoolean     tsk_deque_is_valid(const TskType *deque_type, const TskDeque *deque);
 TskDeque       tsk_deque_new(const TskType *deque_type);
@@ -24,6 +25,8 @@ const TskType *tsk_deque_element_type(const TskType *deque_type);
 TskUSize       tsk_deque_length(const TskType *deque_type, const TskDeque *deque);
 TskBoolean     tsk_deque_is_empty(const TskType *deque_type, const TskDeque *deque);
 TskUSize       tsk_deque_capacity(const TskType *deque_type, const TskDeque *deque);
+TskBoolean     tsk_deque_automatic_shrink(const TskType *deque_type, const TskDeque *deque);
+TskEmpty       tsk_deque_set_automatic_shrink(const TskType *deque_type, TskDeque *deque, TskBoolean automatic_shrink);
 TskAny        *tsk_deque_get(const TskType *deque_type, TskDeque *deque, TskUSize index);
 const TskAny  *tsk_deque_get_const(const TskType *deque_type, const TskDeque *deque, TskUSize index);
 TskAny        *tsk_deque_front(const TskType *deque_type, TskDeque *deque);
@@ -31,6 +34,8 @@ const TskAny  *tsk_deque_front_const(const TskType *deque_type, const TskDeque *
 TskAny        *tsk_deque_back(const TskType *deque_type, TskDeque *deque);
 const TskAny  *tsk_deque_back_const(const TskType *deque_type, const TskDeque *deque);
 TskEmpty       tsk_deque_clear(const TskType *deque_type, TskDeque *deque);
+TskBoolean     tsk_deque_shrink_to_fit(const TskType *deque_type, TskDeque *deque);
+TskBoolean     tsk_deque_shrink_to(const TskType *deque_type, TskDeque *deque, TskUSize capacity);
 TskBoolean     tsk_deque_push_front(const TskType *deque_type, TskDeque *deque, TskAny *element);
 TskBoolean     tsk_deque_push_back(const TskType *deque_type, TskDeque *deque, TskAny *element);
 TskBoolean     tsk_deque_pop_front(const TskType *deque_type, TskDeque *deque, TskAny *element);
@@ -0,0 +1,58 @@
+#ifndef TSK_INTERNAL_MAP_HASH_H_INCLUDED
+#define TSK_INTERNAL_MAP_HASH_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/default_hasher.h>
+#include <tsk/map.h>
+#include <tsk/type.h>
+
+#include <string.h>
+
+static inline TskU64 tsk_map_hash_mix(TskU64 hash) {
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+static inline TskBoolean tsk_map_hash_word(const TskMap *map, const TskAny *hashable, TskUSize hashable_size, TskU64 *hash) {
+	if (map->hasher.builder_type != tsk_default_hasher_builder_type) {
+		return TSK_FALSE;
+	}
+
+	TskU64 word = 0;
+	switch (hashable_size) {
+		case sizeof(TskU8): {
+			TskU8 value = 0;
+			memcpy(&value, hashable, sizeof(value));
+			word = value;
+		} break;
+		case sizeof(TskU16): {
+			TskU16 value = 0;
+			memcpy(&value, hashable, sizeof(value));
+			word = value;
+		} break;
+		case sizeof(TskU32): {
+			TskU32 value = 0;
+			memcpy(&value, hashable, sizeof(value));
+			word = value;
+		} break;
+		case sizeof(TskU64): {
+			memcpy(&word, hashable, sizeof(word));
+		} break;
+		default: return TSK_FALSE;
+	}
+	*hash = tsk_map_hash_mix(word);
+
+	return TSK_TRUE;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_INTERNAL_MAP_HASH_H_INCLUDED
@@ -5,45 +5,134 @@
 extern "C" {
 #endif
 
+#include <tsk/array.h>
+#include <tsk/trait/builder.h>
+#include <tsk/trait/droppable.h>
+#include <tsk/trait/hasher.h>
 #include <tsk/tuple.h>
 #include <tsk/type.h>
 #include <tsk/value.h>
 
-typedef struct TskMapEntry TskMapEntry;
-typedef struct TskMap      TskMap;
+typedef enum TskMapEngine {
+	TSK_MAP_ENGINE_SWISS_TABLE,
+	TSK_MAP_ENGINE_ROBIN_HOOD
+} TskMapEngine;
+
+typedef enum TskMapLayout {
+	TSK_MAP_LAYOUT_SPLIT,
+	TSK_MAP_LAYOUT_INTERLEAVED
+} TskMapLayout;
+
+typedef struct TskMapStatistics TskMapStatistics;
+struct TskMapStatistics {
+	TskUSize maximum_probe_distance;
+	TskF32   average_probe_distance;
+};
+
+typedef struct TskMapHasher TskMapHasher;
+struct TskMapHasher {
+	const TskType           *builder_type;
+	const TskTraitBuilder   *builder_trait;
+	const TskType           *type;
+	TskUSize                 size;
+	const TskTraitHasher    *hasher_trait;
+	const TskTraitDroppable *droppable_trait;
+};
+
+typedef struct TskMap TskMap;
 struct TskMap {
 	TskValue     hasher_builder;
-	TskMapEntry *entries;
+	TskMapHasher hasher;
+	TskU8       *controls;
 	TskAny      *keys;
 	TskAny      *values;
 	TskUSize     length;
+	TskUSize     deleted;
 	TskUSize     capacity;
+	TskU32       maximum_load_factor;
+	TskBoolean   incremental_resize;
+	TskBoolean   automatic_shrink;
+	TskMap      *previous;
+	TskUSize     migration_index;
 };
 TskBoolean     tsk_map_is_valid(const TskType *map_type, const TskMap *map);
 TskMap         tsk_map_new(const TskType *map_type);
 TskBoolean     tsk_map_with_hasher_builder(const TskType *map_type, TskMap *map, const TskType *hasher_builder_type, TskAny *hasher_builder);
 TskEmpty       tsk_map_drop(const TskType *map_type, TskMap *map);
 TskBoolean     tsk_map_clone(const TskType *map_type, const TskMap *map_1, TskMap *map_2);
+TskBoolean     tsk_map_clone_empty(const TskType *map_type, const TskMap *map_1, TskMap *map_2);
+TskBoolean     tsk_map_parallel_clone(const TskType *map_type, const TskMap *map_1, TskMap *map_2, TskUSize threads_length);
 const TskType *tsk_map_key_type(const TskType *map_type);
 const TskType *tsk_map_value_type(const TskType *map_type);
+const TskType *tsk_map_item_type(const TskType *map_type);
 TskUSize       tsk_map_length(const TskType *map_type, const TskMap *map);
 TskBoolean     tsk_map_is_empty(const TskType *map_type, const TskMap *map);
 TskUSize       tsk_map_capacity(const TskType *map_type, const TskMap *map);
 TskUSize       tsk_map_maximum_capacity(const TskType *map_type);
 TskF32         tsk_map_load_factor(const TskType *map_type, const TskMap *map);
-TskF32         tsk_map_maximum_load_factor(const TskType *map_type);
+TskF32         tsk_map_maximum_load_factor(const TskType *map_type, const TskMap *map);
+TskBoolean     tsk_map_set_maximum_load_factor(const TskType *map_type, TskMap *map, TskF32 maximum_load_factor);
+TskBoolean     tsk_map_incremental_resize(const TskType *map_type, const TskMap *map);
+TskEmpty       tsk_map_set_incremental_resize(const TskType *map_type, TskMap *map, TskBoolean incremental_resize);
+TskBoolean     tsk_map_automatic_shrink(const TskType *map_type, const TskMap *map);
+TskEmpty       tsk_map_set_automatic_shrink(const TskType *map_type, TskMap *map, TskBoolean automatic_shrink);
+TskBoolean     tsk_map_is_resizing(const TskType *map_type, const TskMap *map);
+// The hash given to the _with_hash and _heterogeneous functions must equal what tsk_map_hash returns for the
+// equal key of the map's key type, so a heterogeneous key has to hash exactly like the stored key type.
+TskU64         tsk_map_hash(const TskType *map_type, const TskMap *map, const TskType *hashable_type, const TskAny *hashable);
 TskAny        *tsk_map_get(const TskType *map_type, TskMap *map, const TskAny *key);
+TskAny        *tsk_map_get_with_hash(const TskType *map_type, TskMap *map, const TskAny *key, TskU64 hash);
+TskAny        *tsk_map_get_heterogeneous(const TskType *map_type, TskMap *map, const TskAny *key, TskU64 hash, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2));
 const TskAny  *tsk_map_get_const(const TskType *map_type, const TskMap *map, const TskAny *key);
+const TskAny  *tsk_map_get_const_with_hash(const TskType *map_type, const TskMap *map, const TskAny *key, TskU64 hash);
+const TskAny  *tsk_map_key_const(const TskType *map_type, const TskMap *map, const TskAny *key);
+const TskAny  *tsk_map_get_const_heterogeneous(const TskType *map_type, const TskMap *map, const TskAny *key, TskU64 hash, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2));
+TskUSize       tsk_map_get_many(const TskType *map_type, TskMap *map, TskArrayViewConst keys, TskArrayView values);
+TskUSize       tsk_map_get_many_const(const TskType *map_type, const TskMap *map, TskArrayViewConst keys, TskArrayView values);
+TskEmpty       tsk_map_prefetch_with_hash(const TskType *map_type, const TskMap *map, TskU64 hash);
+TskBoolean     tsk_map_next_key(const TskType *map_type, const TskMap *map, TskUSize *index, const TskAny **key);
 TskEmpty       tsk_map_clear(const TskType *map_type, TskMap *map);
+TskEmpty       tsk_map_parallel_clear(const TskType *map_type, TskMap *map, TskUSize threads_length);
 TskBoolean     tsk_map_reserve(const TskType *map_type, TskMap *map, TskUSize capacity);
 TskBoolean     tsk_map_reserve_additional(const TskType *map_type, TskMap *map, TskUSize additional);
+TskBoolean     tsk_map_shrink_to_fit(const TskType *map_type, TskMap *map);
+TskBoolean     tsk_map_shrink_to(const TskType *map_type, TskMap *map, TskUSize capacity);
 TskBoolean     tsk_map_insert(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value);
+TskBoolean     tsk_map_insert_with_hash(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value, TskU64 hash);
+TskBoolean     tsk_map_extend(const TskType *map_type, TskMap *map, TskArrayView items, TskBoolean unique);
+TskBoolean     tsk_map_extend_from_iterator(const TskType *map_type, TskMap *map, const TskType *iterator_type, TskAny *iterator, TskBoolean unique);
+TskBoolean     tsk_map_from_iterator(const TskType *map_type, TskMap *map, const TskType *iterator_type, TskAny *iterator, TskBoolean unique);
+TskBoolean     tsk_map_parallel_extend(const TskType *map_type, TskMap *map, TskArrayView items, TskBoolean unique, TskUSize threads_length);
 TskAny        *tsk_map_get_or_insert(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value);
+TskAny        *tsk_map_get_or_insert_with_hash(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value, TskU64 hash);
 TskBoolean     tsk_map_remove(const TskType *map_type, TskMap *map, const TskAny *key, TskAny *value);
+TskBoolean     tsk_map_remove_with_hash(const TskType *map_type, TskMap *map, const TskAny *key, TskAny *value, TskU64 hash);
 TskBoolean     tsk_map_equals(const TskType *map_type, const TskMap *map_1, const TskMap *map_2);
 
+TskMapStatistics tsk_map_statistics(const TskType *map_type, const TskMap *map);
+
+typedef struct TskMapEntry TskMapEntry;
+struct TskMapEntry {
+	TskMap    *map;
+	TskU64     hash;
+	TskUSize   index;
+	TskU8      control;
+	TskBoolean occupied;
+};
+TskBoolean    tsk_map_entry(const TskType *map_type, TskMap *map, const TskAny *key, TskMapEntry *entry);
+TskBoolean    tsk_map_entry_with_hash(const TskType *map_type, TskMap *map, const TskAny *key, TskU64 hash, TskMapEntry *entry);
+TskBoolean    tsk_map_entry_is_valid(const TskType *map_type, const TskMapEntry *entry);
+TskBoolean    tsk_map_entry_is_occupied(const TskType *map_type, const TskMapEntry *entry);
+const TskAny *tsk_map_entry_key(const TskType *map_type, const TskMapEntry *entry);
+TskAny       *tsk_map_entry_value(const TskType *map_type, TskMapEntry *entry);
+TskAny       *tsk_map_entry_insert(const TskType *map_type, TskMapEntry *entry, TskAny *key, TskAny *value);
+
 TskBoolean     tsk_map_type_is_valid(const TskType *map_type);
+TskMapEngine   tsk_map_engine(const TskType *map_type);
+TskMapLayout   tsk_map_layout(const TskType *map_type);
 const TskType *tsk_map_type(const TskType *key_type, const TskType *value_type);
+const TskType *tsk_map_type_with_engine(const TskType *key_type, const TskType *value_type, TskMapEngine engine);
+const TskType *tsk_map_type_with_layout(const TskType *key_type, const TskType *value_type, TskMapEngine engine, TskMapLayout layout);
 
 typedef struct TskMapIterator TskMapIterator;
 struct TskMapIterator {
@@ -51,6 +140,7 @@ struct TskMapIterator {
 	TskUSize index;
 };
 TskBoolean     tsk_map_iterator_is_valid(const TskType *map_iterator_type, const TskMapIterator *map_iterator);
+const TskType *tsk_map_iterator_map_type(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_key_type(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_value_type(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_item_type(const TskType *map_iterator_type);
@@ -58,6 +148,7 @@ TskBoolean     tsk_map_iterator_next(const TskType *map_iterator_type, TskMapIte
 
 TskBoolean     tsk_map_iterator_type_is_valid(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_type(const TskType *key_type, const TskType *value_type);
+const TskType *tsk_map_iterator_type_with_map_type(const TskType *map_type);
 
 TskMapIterator tsk_map_iterator(const TskType *map_type, TskMap *map);
 
@@ -67,6 +158,7 @@ struct TskMapIteratorConst {
 	TskUSize      index;
 };
 TskBoolean     tsk_map_iterator_const_is_valid(const TskType *map_iterator_type, const TskMapIteratorConst *map_iterator);
+const TskType *tsk_map_iterator_const_map_type(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_const_key_type(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_const_value_type(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_const_item_type(const TskType *map_iterator_type);
@@ -74,6 +166,7 @@ TskBoolean     tsk_map_iterator_const_next(const TskType *map_iterator_type, Tsk
 
 TskBoolean     tsk_map_iterator_const_type_is_valid(const TskType *map_iterator_type);
 const TskType *tsk_map_iterator_const_type(const TskType *key_type, const TskType *value_type);
+const TskType *tsk_map_iterator_const_type_with_map_type(const TskType *map_type);
 
 TskMapIteratorConst tsk_map_iterator_const(const TskType *map_type, const TskMap *map);
 
@@ -0,0 +1,38 @@
+#ifndef TSK_RCU_MAP_H_INCLUDED
+#define TSK_RCU_MAP_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/type.h>
+
+typedef struct TskRcuMapState TskRcuMapState;
+
+typedef struct TskRcuMap TskRcuMap;
+struct TskRcuMap {
+	TskRcuMapState *state;
+};
+TskBoolean     tsk_rcu_map_is_valid(const TskType *rcu_map_type, const TskRcuMap *rcu_map);
+TskBoolean     tsk_rcu_map_new(const TskType *rcu_map_type, TskRcuMap *rcu_map);
+TskBoolean     tsk_rcu_map_with_hasher_builder(const TskType *rcu_map_type, TskRcuMap *rcu_map, const TskType *hasher_builder_type, TskAny *hasher_builder);
+TskEmpty       tsk_rcu_map_drop(const TskType *rcu_map_type, TskRcuMap *rcu_map);
+const TskType *tsk_rcu_map_key_type(const TskType *rcu_map_type);
+const TskType *tsk_rcu_map_value_type(const TskType *rcu_map_type);
+TskUSize       tsk_rcu_map_length(const TskType *rcu_map_type, const TskRcuMap *rcu_map);
+TskBoolean     tsk_rcu_map_is_empty(const TskType *rcu_map_type, const TskRcuMap *rcu_map);
+TskUSize       tsk_rcu_map_capacity(const TskType *rcu_map_type, const TskRcuMap *rcu_map);
+TskBoolean     tsk_rcu_map_contains(const TskType *rcu_map_type, const TskRcuMap *rcu_map, const TskAny *key);
+TskBoolean     tsk_rcu_map_get(const TskType *rcu_map_type, const TskRcuMap *rcu_map, const TskAny *key, TskAny *value);
+TskBoolean     tsk_rcu_map_insert(const TskType *rcu_map_type, TskRcuMap *rcu_map, TskAny *key, TskAny *value);
+TskBoolean     tsk_rcu_map_remove(const TskType *rcu_map_type, TskRcuMap *rcu_map, const TskAny *key);
+TskEmpty       tsk_rcu_map_synchronize(const TskType *rcu_map_type, TskRcuMap *rcu_map);
+
+TskBoolean     tsk_rcu_map_type_is_valid(const TskType *rcu_map_type);
+const TskType *tsk_rcu_map_type(const TskType *key_type, const TskType *value_type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_RCU_MAP_H_INCLUDED
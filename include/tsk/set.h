@@ -0,0 +1,68 @@
+#ifndef TSK_SET_H_INCLUDED
+#define TSK_SET_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/array.h>
+#include <tsk/map.h>
+#include <tsk/type.h>
+
+typedef struct TskSet TskSet;
+struct TskSet {
+	TskMap map;
+};
+TskBoolean     tsk_set_is_valid(const TskType *set_type, const TskSet *set);
+TskSet         tsk_set_new(const TskType *set_type);
+TskBoolean     tsk_set_with_hasher_builder(const TskType *set_type, TskSet *set, const TskType *hasher_builder_type, TskAny *hasher_builder);
+TskEmpty       tsk_set_drop(const TskType *set_type, TskSet *set);
+TskBoolean     tsk_set_clone(const TskType *set_type, const TskSet *set_1, TskSet *set_2);
+const TskType *tsk_set_element_type(const TskType *set_type);
+const TskType *tsk_set_map_type(const TskType *set_type);
+TskUSize       tsk_set_length(const TskType *set_type, const TskSet *set);
+TskBoolean     tsk_set_is_empty(const TskType *set_type, const TskSet *set);
+TskUSize       tsk_set_capacity(const TskType *set_type, const TskSet *set);
+TskBoolean     tsk_set_contains(const TskType *set_type, const TskSet *set, const TskAny *element);
+const TskAny  *tsk_set_get(const TskType *set_type, const TskSet *set, const TskAny *element);
+TskEmpty       tsk_set_clear(const TskType *set_type, TskSet *set);
+TskBoolean     tsk_set_reserve(const TskType *set_type, TskSet *set, TskUSize capacity);
+TskBoolean     tsk_set_reserve_additional(const TskType *set_type, TskSet *set, TskUSize additional);
+TskBoolean     tsk_set_shrink_to_fit(const TskType *set_type, TskSet *set);
+TskBoolean     tsk_set_shrink_to(const TskType *set_type, TskSet *set, TskUSize capacity);
+TskBoolean     tsk_set_insert(const TskType *set_type, TskSet *set, TskAny *element);
+TskBoolean     tsk_set_extend(const TskType *set_type, TskSet *set, TskArrayView elements);
+TskBoolean     tsk_set_remove(const TskType *set_type, TskSet *set, const TskAny *element);
+TskBoolean     tsk_set_union(const TskType *set_type, const TskSet *set_1, const TskSet *set_2, TskSet *set_3);
+TskBoolean     tsk_set_intersection(const TskType *set_type, const TskSet *set_1, const TskSet *set_2, TskSet *set_3);
+TskBoolean     tsk_set_difference(const TskType *set_type, const TskSet *set_1, const TskSet *set_2, TskSet *set_3);
+TskBoolean     tsk_set_is_subset(const TskType *set_type, const TskSet *set_1, const TskSet *set_2);
+TskBoolean     tsk_set_is_disjoint(const TskType *set_type, const TskSet *set_1, const TskSet *set_2);
+TskBoolean     tsk_set_equals(const TskType *set_type, const TskSet *set_1, const TskSet *set_2);
+
+TskBoolean     tsk_set_type_is_valid(const TskType *set_type);
+const TskType *tsk_set_type(const TskType *element_type);
+const TskType *tsk_set_type_with_engine(const TskType *element_type, TskMapEngine engine);
+
+typedef struct TskSetIterator TskSetIterator;
+struct TskSetIterator {
+	const TskSet *set;
+	TskUSize      index;
+};
+TskBoolean     tsk_set_iterator_is_valid(const TskType *set_iterator_type, const TskSetIterator *set_iterator);
+const TskType *tsk_set_iterator_set_type(const TskType *set_iterator_type);
+const TskType *tsk_set_iterator_element_type(const TskType *set_iterator_type);
+const TskType *tsk_set_iterator_item_type(const TskType *set_iterator_type);
+TskBoolean     tsk_set_iterator_next(const TskType *set_iterator_type, TskSetIterator *set_iterator, TskAny *item);
+
+TskBoolean     tsk_set_iterator_type_is_valid(const TskType *set_iterator_type);
+const TskType *tsk_set_iterator_type(const TskType *element_type);
+const TskType *tsk_set_iterator_type_with_set_type(const TskType *set_type);
+
+TskSetIterator tsk_set_iterator(const TskType *set_type, const TskSet *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_SET_H_INCLUDED
@@ -0,0 +1,24 @@
+#ifndef TSK_SIP_HASHER_H_INCLUDED
+#define TSK_SIP_HASHER_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/type.h>
+
+typedef struct TskSipHasherBuilder TskSipHasherBuilder;
+struct TskSipHasherBuilder {
+	TskU64 key_0;
+	TskU64 key_1;
+};
+TskSipHasherBuilder tsk_sip_hasher_builder_new(TskU64 key_0, TskU64 key_1);
+TskSipHasherBuilder tsk_sip_hasher_builder_random(TskEmpty);
+
+extern const TskType *tsk_sip_hasher_builder_type;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_SIP_HASHER_H_INCLUDED
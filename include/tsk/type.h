@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stdalign.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -51,6 +52,8 @@ typedef double TskF64;
 
 typedef TskUSize TskTraitID;
 
+#define TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH ((TskTraitID)16)
+
 typedef struct TskTypeTraitTableEntry TskTypeTraitTableEntry;
 struct TskTypeTraitTableEntry {
 	TskTraitID    trait_id;
@@ -61,15 +64,27 @@ struct TskTypeTraitTable {
 	TskTypeTraitTableEntry *entries;
 	TskUSize                capacity;
 };
+typedef struct TskTypeLayout TskTypeLayout;
+struct TskTypeLayout {
+	TskUSize       size;
+	TskUSize       alignment;
+	TskBoolean     is_trivially_droppable;
+	TskBoolean     is_trivially_clonable;
+	TskBoolean     is_bitwise_equatable;
+	TskBoolean     is_bytewise_hashable;
+	_Atomic(TskU8) state;
+};
 typedef struct TskType TskType;
 struct TskType {
 	const TskCharacter      *name;
 	const TskTypeTraitTable *trait_table;
+	TskTypeLayout           *layout;
 };
-TskBoolean          tsk_type_is_valid(const TskType *type);
-const TskCharacter *tsk_type_name(const TskType *type);
-const TskAny       *tsk_type_trait(const TskType *type, TskTraitID trait_id);
-TskBoolean          tsk_type_has_trait(const TskType *type, TskTraitID trait_id);
+TskBoolean           tsk_type_is_valid(const TskType *type);
+const TskCharacter  *tsk_type_name(const TskType *type);
+const TskAny        *tsk_type_trait(const TskType *type, TskTraitID trait_id);
+TskBoolean           tsk_type_has_trait(const TskType *type, TskTraitID trait_id);
+const TskTypeLayout *tsk_type_layout(const TskType *type);
 
 // clang-format off
 #define TSK_TYPE_TRAIT_TABLE_LENGTH_(\
@@ -97,20 +112,23 @@ TskBoolean          tsk_type_has_trait(const TskType *type, TskTraitID trait_id)
 #define TSK_TYPE_TRAIT_TABLE_CAPACITY(...) \
 	TSK_TYPE_TRAIT_TABLE_CAPACITY_(TSK_TYPE_TRAIT_TABLE_LENGTH(__VA_ARGS__))
 
-#define TSK_TYPE(type_identifier, type_name, ...)                                                    \
-	enum {                                                                                             \
-		type_identifier##_trait_table_capacity = TSK_TYPE_TRAIT_TABLE_CAPACITY(__VA_ARGS__)              \
-	};                                                                                                 \
-	const TskType type_identifier##_ = {                                                               \
-		.name        = #type_name,                                                                       \
-		.trait_table = &(const TskTypeTraitTable){                                                       \
-		    .entries  = (TskTypeTraitTableEntry[type_identifier##_trait_table_capacity]){ __VA_ARGS__ }, \
-		    .capacity = type_identifier##_trait_table_capacity,                                          \
-		}                                                                                                \
-	};                                                                                                 \
+#define TSK_TYPE(type_identifier, type_name, ...)                                                                                         \
+	enum {                                                                                                                                  \
+		type_identifier##_trait_table_capacity = TSK_TYPE_TRAIT_TABLE_CAPACITY(__VA_ARGS__)                                                   \
+	};                                                                                                                                      \
+	const TskType type_identifier##_ = {                                                                                                    \
+		.name        = #type_name,                                                                                                            \
+		.trait_table = &(const TskTypeTraitTable){                                                                                            \
+		    .entries  = (TskTypeTraitTableEntry[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH + type_identifier##_trait_table_capacity]){ __VA_ARGS__ }, \
+		    .capacity = type_identifier##_trait_table_capacity,                                                                               \
+		},                                                                                                                                    \
+		.layout      = &(TskTypeLayout){ .size = 0 },                                                                                         \
+	};                                                                                                                                      \
 	const TskType *const type_identifier = &type_identifier##_
+#define TSK_TYPE_TRAIT_INDEX(type_identifier, trait_id) \
+	((trait_id) < TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH ? (trait_id) : TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH + ((trait_id) & (type_identifier##_trait_table_capacity - 1)))
 #define TSK_TYPE_TRAIT(type_identifier, trait_id, ...) \
-	[(trait_id) & (type_identifier##_trait_table_capacity - 1)] = { (trait_id), (__VA_ARGS__) }
+	[TSK_TYPE_TRAIT_INDEX(type_identifier, trait_id)] = { (trait_id), (__VA_ARGS__) }
 
 extern const TskType *const tsk_unit_type;
 
@@ -0,0 +1,48 @@
+#ifndef TSK_TYPE_REGISTRY_H_INCLUDED
+#define TSK_TYPE_REGISTRY_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/type.h>
+
+#include <stdatomic.h>
+
+#define TSK_TYPE_REGISTRY_SEGMENTS_LENGTH 32
+
+typedef enum TskTypeRegistryResult {
+	TSK_TYPE_REGISTRY_RESULT_FOUND,
+	TSK_TYPE_REGISTRY_RESULT_CLAIMED,
+	TSK_TYPE_REGISTRY_RESULT_FULL
+} TskTypeRegistryResult;
+
+typedef struct TskTypeRegistryTable TskTypeRegistryTable;
+struct TskTypeRegistryTable {
+	TskTypeRegistryTable *previous;
+	TskUSize              capacity;
+	_Atomic(TskUSize)     length;
+	_Atomic(TskU64)       slots[];
+};
+
+typedef struct TskTypeRegistry TskTypeRegistry;
+struct TskTypeRegistry {
+	TskUSize                        entry_size;
+	_Atomic(TskTypeRegistryTable *) table;
+	_Atomic(TskU8 *)                segments[TSK_TYPE_REGISTRY_SEGMENTS_LENGTH];
+	_Atomic(TskUSize)               length;
+	atomic_flag                     is_growing;
+};
+TskTypeRegistryResult tsk_type_registry_find_or_claim(TskTypeRegistry *registry, TskU64 hash, TskBoolean (*equals)(const TskAny *entry, const TskAny *key), const TskAny *key, TskAny **entry);
+TskEmpty              tsk_type_registry_publish(TskTypeRegistry *registry, TskAny *entry);
+TskEmpty              tsk_type_registry_abandon(TskTypeRegistry *registry, TskAny *entry);
+TskBoolean            tsk_type_registry_contains(const TskTypeRegistry *registry, const TskAny *entry);
+
+#define TSK_TYPE_REGISTRY(entry_size_) \
+	{ .entry_size = (entry_size_), .table = TSK_NULL, .segments = { TSK_NULL }, .length = 0, .is_growing = ATOMIC_FLAG_INIT }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_TYPE_REGISTRY_H_INCLUDED
@@ -0,0 +1,258 @@
+#ifndef TSK_TYPED_ARRAY_H_INCLUDED
+#define TSK_TYPED_ARRAY_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/array.h>
+#include <tsk/cached_type.h>
+#include <tsk/trait/equatable.h>
+#include <tsk/type.h>
+
+#include <assert.h>
+#include <string.h>
+
+// The typed wrappers order elements with the built-in <, the same relation the primitive comparable trait uses,
+// and sort every stride with the same introsort. They are therefore limited to arithmetic element types; with
+// unordered values such as NaN the resulting order is unspecified.
+// clang-format off
+#define TSK_TYPED_ARRAY_IS_ARITHMETIC(type_name)\
+	_Generic((type_name)0,\
+		_Bool: 1,\
+		char: 1,\
+		signed char: 1,\
+		unsigned char: 1,\
+		short: 1,\
+		unsigned short: 1,\
+		int: 1,\
+		unsigned int: 1,\
+		long: 1,\
+		unsigned long: 1,\
+		long long: 1,\
+		unsigned long long: 1,\
+		float: 1,\
+		double: 1,\
+		long double: 1,\
+		default: 0\
+	)
+
+#define TSK_ARRAY_VIEW_DEFINE(type_parameter, type_name)\
+	_Static_assert(TSK_TYPED_ARRAY_IS_ARITHMETIC(type_name), "TSK_ARRAY_VIEW_DEFINE requires an arithmetic element type");\
+	static inline const TskType *tsk_array_view_##type_parameter##_type(TskEmpty) {\
+		static _Atomic(const TskType *) array_view_type = TSK_NULL;\
+		const TskType *type = tsk_cached_type_load(&array_view_type);\
+		return type != TSK_NULL ? type : tsk_cached_type_store(&array_view_type, tsk_array_view_type(tsk_##type_parameter##_type));\
+	}\
+	static inline TskArrayView tsk_array_view_##type_parameter##_new(type_name *elements, TskUSize length) {\
+		return (TskArrayView){\
+			.elements = elements,\
+			.length   = length,\
+			.stride   = 1,\
+		};\
+	}\
+	static inline type_name *tsk_array_view_##type_parameter##_get(TskArrayView array_view, TskUSize index) {\
+		assert(index < array_view.length);\
+		return (type_name *)array_view.elements + ((TskISize)index * array_view.stride);\
+	}\
+	static inline TskUSize tsk_array_view_##type_parameter##_lower_bound(TskArrayView array_view, type_name element) {\
+		TskUSize left  = 0;\
+		TskUSize right = array_view.length;\
+		while (left < right) {\
+			TskUSize middle = left + ((right - left) / 2);\
+			if (*tsk_array_view_##type_parameter##_get(array_view, middle) < element) {\
+				left = middle + 1;\
+			} else {\
+				right = middle;\
+			}\
+		}\
+		return left;\
+	}\
+	static inline TskBoolean tsk_array_view_##type_parameter##_binary_search(TskArrayView array_view, type_name element, TskUSize *index) {\
+		TskUSize lower_bound = tsk_array_view_##type_parameter##_lower_bound(array_view, element);\
+		if (lower_bound == array_view.length || element < *tsk_array_view_##type_parameter##_get(array_view, lower_bound)) {\
+			return TSK_FALSE;\
+		}\
+		if (index != TSK_NULL) {\
+			*index = lower_bound;\
+		}\
+		return TSK_TRUE;\
+	}\
+	static inline TskBoolean tsk_array_view_##type_parameter##_linear_search(TskArrayView array_view, type_name element, TskUSize *index) {\
+		const TskTypeLayout *element_layout = tsk_type_layout(tsk_##type_parameter##_type);\
+		for (TskUSize i = 0; i < array_view.length; i++) {\
+			const type_name *candidate = tsk_array_view_##type_parameter##_get(array_view, i);\
+			if (element_layout->is_bitwise_equatable ? memcmp(candidate, &element, sizeof(element)) == 0 : tsk_trait_equatable_equals(tsk_##type_parameter##_type, candidate, &element)) {\
+				if (index != TSK_NULL) {\
+					*index = i;\
+				}\
+				return TSK_TRUE;\
+			}\
+		}\
+		return TSK_FALSE;\
+	}\
+	static inline TskEmpty tsk_array_view_##type_parameter##_sift_down(type_name *elements, TskISize stride, TskUSize length, TskUSize index) {\
+		type_name element = elements[(TskISize)index * stride];\
+		while ((2 * index) + 1 < length) {\
+			TskUSize child = (2 * index) + 1;\
+			if (child + 1 < length && elements[(TskISize)child * stride] < elements[(TskISize)(child + 1) * stride]) {\
+				child++;\
+			}\
+			if (!(element < elements[(TskISize)child * stride])) {\
+				break;\
+			}\
+			elements[(TskISize)index * stride] = elements[(TskISize)child * stride];\
+			index                              = child;\
+		}\
+		elements[(TskISize)index * stride] = element;\
+	}\
+	static inline TskEmpty tsk_array_view_##type_parameter##_swap(type_name *elements, TskISize stride, TskUSize index_1, TskUSize index_2) {\
+		type_name element                    = elements[(TskISize)index_1 * stride];\
+		elements[(TskISize)index_1 * stride] = elements[(TskISize)index_2 * stride];\
+		elements[(TskISize)index_2 * stride] = element;\
+	}\
+	static inline TskEmpty tsk_array_view_##type_parameter##_introsort(type_name *elements, TskISize stride, TskUSize length, TskUSize depth) {\
+		while (length > 16) {\
+			if (depth == 0) {\
+				for (TskUSize i = length / 2; i > 0; i--) {\
+					tsk_array_view_##type_parameter##_sift_down(elements, stride, length, i - 1);\
+				}\
+				for (TskUSize i = length - 1; i > 0; i--) {\
+					tsk_array_view_##type_parameter##_swap(elements, stride, 0, i);\
+					tsk_array_view_##type_parameter##_sift_down(elements, stride, i, 0);\
+				}\
+				return;\
+			}\
+			depth--;\
+			\
+			TskUSize middle = length / 2;\
+			if (elements[(TskISize)middle * stride] < elements[0]) {\
+				tsk_array_view_##type_parameter##_swap(elements, stride, 0, middle);\
+			}\
+			if (elements[(TskISize)(length - 1) * stride] < elements[(TskISize)middle * stride]) {\
+				tsk_array_view_##type_parameter##_swap(elements, stride, middle, length - 1);\
+				if (elements[(TskISize)middle * stride] < elements[0]) {\
+					tsk_array_view_##type_parameter##_swap(elements, stride, 0, middle);\
+				}\
+			}\
+			type_name pivot = elements[(TskISize)middle * stride];\
+			\
+			TskUSize i = 0;\
+			TskUSize j = length - 1;\
+			for (;;) {\
+				while (elements[(TskISize)i * stride] < pivot) {\
+					i++;\
+				}\
+				while (pivot < elements[(TskISize)j * stride]) {\
+					j--;\
+				}\
+				if (i >= j) {\
+					break;\
+				}\
+				tsk_array_view_##type_parameter##_swap(elements, stride, i, j);\
+				i++;\
+				j--;\
+			}\
+			\
+			TskUSize split = j + 1;\
+			if (split < length - split) {\
+				tsk_array_view_##type_parameter##_introsort(elements, stride, split, depth);\
+				elements += (TskISize)split * stride;\
+				length -= split;\
+			} else {\
+				tsk_array_view_##type_parameter##_introsort(elements + ((TskISize)split * stride), stride, length - split, depth);\
+				length = split;\
+			}\
+		}\
+		for (TskUSize i = 1; i < length; i++) {\
+			type_name element = elements[(TskISize)i * stride];\
+			TskUSize  j       = i;\
+			while (j > 0 && element < elements[(TskISize)(j - 1) * stride]) {\
+				elements[(TskISize)j * stride] = elements[(TskISize)(j - 1) * stride];\
+				j--;\
+			}\
+			elements[(TskISize)j * stride] = element;\
+		}\
+	}\
+	static inline TskEmpty tsk_array_view_##type_parameter##_sort(TskArrayView array_view) {\
+		TskUSize depth = 0;\
+		for (TskUSize length = array_view.length; length > 1; length /= 2) {\
+			depth += 2;\
+		}\
+		tsk_array_view_##type_parameter##_introsort(array_view.elements, array_view.stride, array_view.length, depth);\
+	}
+
+#define TSK_ARRAY_DEFINE(type_parameter, type_name)\
+	TSK_ARRAY_VIEW_DEFINE(type_parameter, type_name)\
+	\
+	static inline const TskType *tsk_array_##type_parameter##_type(TskEmpty) {\
+		static _Atomic(const TskType *) array_type = TSK_NULL;\
+		const TskType *type = tsk_cached_type_load(&array_type);\
+		return type != TSK_NULL ? type : tsk_cached_type_store(&array_type, tsk_array_type(tsk_##type_parameter##_type));\
+	}\
+	static inline TskArray tsk_array_##type_parameter##_new(TskEmpty) {\
+		return tsk_array_new(tsk_array_##type_parameter##_type());\
+	}\
+	static inline TskEmpty tsk_array_##type_parameter##_drop(TskArray *array) {\
+		tsk_array_drop(tsk_array_##type_parameter##_type(), array);\
+	}\
+	static inline type_name *tsk_array_##type_parameter##_elements(TskArray *array) {\
+		return array->elements;\
+	}\
+	static inline const type_name *tsk_array_##type_parameter##_elements_const(const TskArray *array) {\
+		return array->elements;\
+	}\
+	static inline TskUSize tsk_array_##type_parameter##_length(const TskArray *array) {\
+		return array->length;\
+	}\
+	static inline type_name *tsk_array_##type_parameter##_get(TskArray *array, TskUSize index) {\
+		assert(index < array->length);\
+		return (type_name *)array->elements + index;\
+	}\
+	static inline const type_name *tsk_array_##type_parameter##_get_const(const TskArray *array, TskUSize index) {\
+		assert(index < array->length);\
+		return (const type_name *)array->elements + index;\
+	}\
+	static inline TskBoolean tsk_array_##type_parameter##_reserve_additional(TskArray *array, TskUSize additional) {\
+		return tsk_array_reserve_additional(tsk_array_##type_parameter##_type(), array, additional);\
+	}\
+	static inline TskBoolean tsk_array_##type_parameter##_push_back(TskArray *array, type_name element) {\
+		if (array->length == array->capacity && !tsk_array_##type_parameter##_reserve_additional(array, 1)) {\
+			return TSK_FALSE;\
+		}\
+		((type_name *)array->elements)[array->length] = element;\
+		array->length++;\
+		return TSK_TRUE;\
+	}\
+	static inline TskBoolean tsk_array_##type_parameter##_pop_back(TskArray *array, type_name *element) {\
+		if (array->automatic_shrink) {\
+			return tsk_array_pop_back(tsk_array_##type_parameter##_type(), array, element);\
+		}\
+		if (array->length == 0) {\
+			return TSK_FALSE;\
+		}\
+		array->length--;\
+		if (element != TSK_NULL) {\
+			*element = ((type_name *)array->elements)[array->length];\
+		}\
+		return TSK_TRUE;\
+	}\
+	static inline TskArrayView tsk_array_##type_parameter##_view(TskArray *array) {\
+		return tsk_array_view_##type_parameter##_new(array->elements, array->length);\
+	}\
+	static inline TskEmpty tsk_array_##type_parameter##_sort(TskArray *array) {\
+		tsk_array_view_##type_parameter##_sort(tsk_array_##type_parameter##_view(array));\
+	}\
+	static inline TskBoolean tsk_array_##type_parameter##_binary_search(TskArray *array, type_name element, TskUSize *index) {\
+		return tsk_array_view_##type_parameter##_binary_search(tsk_array_##type_parameter##_view(array), element, index);\
+	}\
+	static inline TskBoolean tsk_array_##type_parameter##_linear_search(TskArray *array, type_name element, TskUSize *index) {\
+		return tsk_array_view_##type_parameter##_linear_search(tsk_array_##type_parameter##_view(array), element, index);\
+	}
+// clang-format on
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_TYPED_ARRAY_H_INCLUDED
@@ -0,0 +1,102 @@
+#ifndef TSK_TYPED_MAP_H_INCLUDED
+#define TSK_TYPED_MAP_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <tsk/cached_type.h>
+#include <tsk/internal/map_hash.h>
+#include <tsk/map.h>
+#include <tsk/trait/equatable.h>
+#include <tsk/type.h>
+
+#include <string.h>
+
+// clang-format off
+#define TSK_MAP_DEFINE(key_parameter, key_name, value_parameter, value_name)\
+	static inline const TskType *tsk_map_##key_parameter##_##value_parameter##_type(TskEmpty) {\
+		static _Atomic(const TskType *) map_type = TSK_NULL;\
+		const TskType *type = tsk_cached_type_load(&map_type);\
+		return type != TSK_NULL ? type : tsk_cached_type_store(&map_type, tsk_map_type(tsk_##key_parameter##_type, tsk_##value_parameter##_type));\
+	}\
+	static inline TskMap tsk_map_##key_parameter##_##value_parameter##_new(TskEmpty) {\
+		return tsk_map_new(tsk_map_##key_parameter##_##value_parameter##_type());\
+	}\
+	static inline TskEmpty tsk_map_##key_parameter##_##value_parameter##_drop(TskMap *map) {\
+		tsk_map_drop(tsk_map_##key_parameter##_##value_parameter##_type(), map);\
+	}\
+	static inline TskUSize tsk_map_##key_parameter##_##value_parameter##_length(const TskMap *map) {\
+		return tsk_map_length(tsk_map_##key_parameter##_##value_parameter##_type(), map);\
+	}\
+	static inline TskBoolean tsk_map_##key_parameter##_##value_parameter##_reserve_additional(TskMap *map, TskUSize additional) {\
+		return tsk_map_reserve_additional(tsk_map_##key_parameter##_##value_parameter##_type(), map, additional);\
+	}\
+	static inline TskBoolean tsk_map_##key_parameter##_##value_parameter##_key_equals(const TskAny *key_1, const TskAny *key_2) {\
+		if (tsk_type_layout(tsk_##key_parameter##_type)->is_bitwise_equatable) {\
+			return memcmp(key_1, key_2, sizeof(key_name)) == 0;\
+		}\
+		return tsk_trait_equatable_equals(tsk_##key_parameter##_type, key_1, key_2);\
+	}\
+	static inline TskU64 tsk_map_##key_parameter##_##value_parameter##_hash(const TskMap *map, key_name key) {\
+		TskU64 hash = 0;\
+		if (tsk_type_layout(tsk_##key_parameter##_type)->is_bytewise_hashable && tsk_map_hash_word(map, &key, sizeof(key), &hash)) {\
+			return hash;\
+		}\
+		return tsk_map_hash(tsk_map_##key_parameter##_##value_parameter##_type(), map, tsk_##key_parameter##_type, &key);\
+	}\
+	static inline value_name *tsk_map_##key_parameter##_##value_parameter##_get(TskMap *map, key_name key) {\
+		return tsk_map_get_heterogeneous(\
+			tsk_map_##key_parameter##_##value_parameter##_type(),\
+			map,\
+			&key,\
+			tsk_map_##key_parameter##_##value_parameter##_hash(map, key),\
+			tsk_map_##key_parameter##_##value_parameter##_key_equals\
+		);\
+	}\
+	static inline const value_name *tsk_map_##key_parameter##_##value_parameter##_get_const(const TskMap *map, key_name key) {\
+		return tsk_map_get_const_heterogeneous(\
+			tsk_map_##key_parameter##_##value_parameter##_type(),\
+			map,\
+			&key,\
+			tsk_map_##key_parameter##_##value_parameter##_hash(map, key),\
+			tsk_map_##key_parameter##_##value_parameter##_key_equals\
+		);\
+	}\
+	static inline TskBoolean tsk_map_##key_parameter##_##value_parameter##_contains(const TskMap *map, key_name key) {\
+		return tsk_map_##key_parameter##_##value_parameter##_get_const(map, key) != TSK_NULL;\
+	}\
+	static inline TskBoolean tsk_map_##key_parameter##_##value_parameter##_insert(TskMap *map, key_name key, value_name value) {\
+		return tsk_map_insert_with_hash(\
+			tsk_map_##key_parameter##_##value_parameter##_type(),\
+			map,\
+			&key,\
+			&value,\
+			tsk_map_##key_parameter##_##value_parameter##_hash(map, key)\
+		);\
+	}\
+	static inline value_name *tsk_map_##key_parameter##_##value_parameter##_get_or_insert(TskMap *map, key_name key, value_name value) {\
+		return tsk_map_get_or_insert_with_hash(\
+			tsk_map_##key_parameter##_##value_parameter##_type(),\
+			map,\
+			&key,\
+			&value,\
+			tsk_map_##key_parameter##_##value_parameter##_hash(map, key)\
+		);\
+	}\
+	static inline TskBoolean tsk_map_##key_parameter##_##value_parameter##_remove(TskMap *map, key_name key, value_name *value) {\
+		return tsk_map_remove_with_hash(\
+			tsk_map_##key_parameter##_##value_parameter##_type(),\
+			map,\
+			&key,\
+			value,\
+			tsk_map_##key_parameter##_##value_parameter##_hash(map, key)\
+		);\
+	}
+// clang-format on
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TSK_TYPED_MAP_H_INCLUDED
@@ -13,6 +13,7 @@
 #include <tsk/trait/hasher.h>
 #include <tsk/trait/iterable.h>
 #include <tsk/trait/iterator.h>
+#include <tsk/type_registry.h>
 
 #include <assert.h>
 #include <stdalign.h>
@@ -21,6 +22,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#define TSK_ARRAY_VIEW_HASH_CHUNK_SIZE ((TskUSize)1 << 10)
+
 // TODO: make array, array_view and array_view_const implement Iterable
 
 typedef struct TskArrayType TskArrayType;
@@ -28,10 +31,22 @@ struct TskArrayType {
 	TskType                array_type;
 	TskCharacter           array_type_name[40];
 	TskTypeTraitTable      array_type_trait_table;
-	TskTypeTraitTableEntry array_type_trait_table_entries[16];
+	TskTypeTraitTableEntry array_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          array_type_layout;
 	const TskType         *element_type;
 };
 
+static inline TskEmpty tsk_array_shrink_automatically(const TskType *array_type, TskArray *array) {
+	assert(tsk_array_type_is_valid(array_type));
+	assert(tsk_array_is_valid(array_type, array));
+
+	if (!array->automatic_shrink || tsk_array_length(array_type, array) >= tsk_array_capacity(array_type, array) / 4) {
+		return;
+	}
+
+	(void)tsk_array_shrink_to(array_type, array, tsk_array_length(array_type, array) * 2);
+}
+
 TskBoolean tsk_array_is_valid(const TskType *array_type, const TskArray *array) {
 	assert(tsk_array_type_is_valid(array_type));
 
@@ -41,7 +56,8 @@ TskArray tsk_array_new(const TskType *array_type) {
 	assert(tsk_array_type_is_valid(array_type));
 
 	TskArray array = {
-		.length = 0,
+		.length           = 0,
+		.automatic_shrink = TSK_FALSE,
 	};
 
 	if (tsk_trait_complete_size(tsk_array_element_type(array_type)) == 0) {
@@ -75,7 +91,8 @@ TskBoolean tsk_array_clone(const TskType *array_type, const TskArray *array_1, T
 	assert(array_2 != TSK_NULL);
 
 	if (tsk_array_is_empty(array_type, array_1)) {
-		*array_2 = tsk_array_new(array_type);
+		*array_2                  = tsk_array_new(array_type);
+		array_2->automatic_shrink = array_1->automatic_shrink;
 		return TSK_TRUE;
 	}
 
@@ -89,26 +106,33 @@ TskBoolean tsk_array_clone(const TskType *array_type, const TskArray *array_1, T
 		}
 	}
 
-	for (TskUSize i = 0; i < tsk_array_length(array_type, array_1); i++) {
-		if (!tsk_trait_clonable_clone(
-		        tsk_array_element_type(array_type),
-		        tsk_array_get_const(array_type, array_1, i),
-		        (TskU8 *)elements + (i * tsk_trait_complete_size(tsk_array_element_type(array_type)))
-		    )) {
-			for (TskUSize j = 0; j < i; j++) {
-				tsk_trait_droppable_drop(
-				    tsk_array_element_type(array_type),
-				    (TskU8 *)elements + (j * tsk_trait_complete_size(tsk_array_element_type(array_type)))
-				);
+	if (tsk_type_layout(tsk_array_element_type(array_type))->is_trivially_clonable) {
+		if (tsk_trait_complete_size(tsk_array_element_type(array_type)) != 0) {
+			memcpy(elements, array_1->elements, tsk_array_length(array_type, array_1) * tsk_trait_complete_size(tsk_array_element_type(array_type)));
+		}
+	} else {
+		for (TskUSize i = 0; i < tsk_array_length(array_type, array_1); i++) {
+			if (!tsk_trait_clonable_clone(
+			        tsk_array_element_type(array_type),
+			        tsk_array_get_const(array_type, array_1, i),
+			        (TskU8 *)elements + (i * tsk_trait_complete_size(tsk_array_element_type(array_type)))
+			    )) {
+				for (TskUSize j = 0; j < i; j++) {
+					tsk_trait_droppable_drop(
+					    tsk_array_element_type(array_type),
+					    (TskU8 *)elements + (j * tsk_trait_complete_size(tsk_array_element_type(array_type)))
+					);
+				}
+				free(elements);
+				return TSK_FALSE;
 			}
-			free(elements);
-			return TSK_FALSE;
 		}
 	}
 
-	array_2->elements = elements;
-	array_2->length   = array_1->length;
-	array_2->capacity = array_1->capacity;
+	array_2->elements         = elements;
+	array_2->length           = array_1->length;
+	array_2->capacity         = tsk_trait_complete_size(tsk_array_element_type(array_type)) == 0 ? SIZE_MAX : array_1->length;
+	array_2->automatic_shrink = array_1->automatic_shrink;
 
 	return TSK_TRUE;
 }
@@ -153,6 +177,20 @@ TskUSize tsk_array_maximum_capacity(const TskType *array_type) {
 	TskUSize element_size = tsk_trait_complete_size(tsk_array_element_type(array_type));
 	return element_size == 0 ? SIZE_MAX : SIZE_MAX / element_size;
 }
+TskBoolean tsk_array_automatic_shrink(const TskType *array_type, const TskArray *array) {
+	assert(tsk_array_type_is_valid(array_type));
+	assert(tsk_array_is_valid(array_type, array));
+
+	return array->automatic_shrink;
+}
+TskEmpty tsk_array_set_automatic_shrink(const TskType *array_type, TskArray *array, TskBoolean automatic_shrink) {
+	assert(tsk_array_type_is_valid(array_type));
+	assert(tsk_array_is_valid(array_type, array));
+
+	array->automatic_shrink = automatic_shrink;
+
+	tsk_array_shrink_automatically(array_type, array);
+}
 TskAny *tsk_array_get(const TskType *array_type, TskArray *array, TskUSize index) {
 	assert(tsk_array_type_is_valid(array_type));
 	assert(tsk_array_is_valid(array_type, array));
@@ -212,14 +250,18 @@ TskEmpty tsk_array_clear(const TskType *array_type, TskArray *array) {
 	assert(tsk_array_is_valid(array_type, array));
 	assert(tsk_type_has_trait(tsk_array_element_type(array_type), TSK_TRAIT_ID_DROPPABLE));
 
-	for (TskUSize i = 0; i < tsk_array_length(array_type, array); i++) {
-		tsk_trait_droppable_drop(
-		    tsk_array_element_type(array_type),
-		    tsk_array_get(array_type, array, i)
-		);
+	if (!tsk_type_layout(tsk_array_element_type(array_type))->is_trivially_droppable) {
+		for (TskUSize i = 0; i < tsk_array_length(array_type, array); i++) {
+			tsk_trait_droppable_drop(
+			    tsk_array_element_type(array_type),
+			    tsk_array_get(array_type, array, i)
+			);
+		}
 	}
 
 	array->length = 0;
+
+	tsk_array_shrink_automatically(array_type, array);
 }
 TskBoolean tsk_array_reserve(const TskType *array_type, TskArray *array, TskUSize capacity) {
 	assert(tsk_array_type_is_valid(array_type));
@@ -270,6 +312,47 @@ TskBoolean tsk_array_reserve_additional(const TskType *array_type, TskArray *arr
 
 	return tsk_array_reserve(array_type, array, capacity);
 }
+TskBoolean tsk_array_shrink_to_fit(const TskType *array_type, TskArray *array) {
+	assert(tsk_array_type_is_valid(array_type));
+	assert(tsk_array_is_valid(array_type, array));
+
+	return tsk_array_shrink_to(array_type, array, 0);
+}
+TskBoolean tsk_array_shrink_to(const TskType *array_type, TskArray *array, TskUSize capacity) {
+	assert(tsk_array_type_is_valid(array_type));
+	assert(tsk_array_is_valid(array_type, array));
+
+	if (tsk_trait_complete_size(tsk_array_element_type(array_type)) == 0) {
+		return TSK_TRUE;
+	}
+
+	if (capacity < tsk_array_length(array_type, array)) {
+		capacity = tsk_array_length(array_type, array);
+	}
+
+	if (capacity >= tsk_array_capacity(array_type, array)) {
+		return TSK_TRUE;
+	}
+
+	if (capacity == 0) {
+		free(array->elements);
+
+		array->elements = TSK_NULL;
+		array->capacity = 0;
+
+		return TSK_TRUE;
+	}
+
+	TskAny *elements = realloc(array->elements, capacity * tsk_trait_complete_size(tsk_array_element_type(array_type)));
+	if (elements == TSK_NULL) {
+		return TSK_FALSE;
+	}
+
+	array->elements = elements;
+	array->capacity = capacity;
+
+	return TSK_TRUE;
+}
 TskBoolean tsk_array_insert(const TskType *array_type, TskArray *array, TskUSize index, TskAny *elements, TskUSize count) {
 	assert(tsk_array_type_is_valid(array_type));
 	assert(tsk_array_is_valid(array_type, array));
@@ -299,7 +382,7 @@ TskEmpty tsk_array_remove(const TskType *array_type, TskArray *array, TskUSize i
 	assert(tsk_array_type_is_valid(array_type));
 	assert(tsk_array_is_valid(array_type, array));
 	assert(index < tsk_array_length(array_type, array));
-	assert(count < tsk_array_length(array_type, array) - index);
+	assert(count <= tsk_array_length(array_type, array) - index);
 
 	if (elements != TSK_NULL) {
 		memcpy(
@@ -319,11 +402,13 @@ TskEmpty tsk_array_remove(const TskType *array_type, TskArray *array, TskUSize i
 
 	memmove(
 	    tsk_array_get(array_type, array, index),
-	    tsk_array_get_const(array_type, array, index + count),
+	    (const TskU8 *)array->elements + ((index + count) * tsk_trait_complete_size(tsk_array_element_type(array_type))),
 	    (tsk_array_length(array_type, array) - index - count) * tsk_trait_complete_size(tsk_array_element_type(array_type))
 	);
 
 	array->length -= count;
+
+	tsk_array_shrink_automatically(array_type, array);
 }
 TskBoolean tsk_array_push_front(const TskType *array_type, TskArray *array, TskAny *element) {
 	assert(tsk_array_type_is_valid(array_type));
@@ -365,21 +450,21 @@ TskBoolean tsk_array_pop_back(const TskType *array_type, TskArray *array, TskAny
 }
 TskOrdering tsk_array_compare(const TskType *array_type, const TskArray *array_1, const TskArray *array_2) {
 	return tsk_array_view_const_compare(
-	    tsk_array_view_type(tsk_array_element_type(array_type)),
+	    tsk_array_view_const_type(tsk_array_element_type(array_type)),
 	    tsk_array_view_const(array_type, array_1),
 	    tsk_array_view_const(array_type, array_2)
 	);
 }
 TskBoolean tsk_array_equals(const TskType *array_type, const TskArray *array_1, const TskArray *array_2) {
 	return tsk_array_view_const_equals(
-	    tsk_array_view_type(tsk_array_element_type(array_type)),
+	    tsk_array_view_const_type(tsk_array_element_type(array_type)),
 	    tsk_array_view_const(array_type, array_1),
 	    tsk_array_view_const(array_type, array_2)
 	);
 }
 TskEmpty tsk_array_hash(const TskType *array_type, const TskArray *array, const TskType *hasher_type, TskAny *hasher) {
 	tsk_array_view_const_hash(
-	    tsk_array_view_type(tsk_array_element_type(array_type)),
+	    tsk_array_view_const_type(tsk_array_element_type(array_type)),
 	    tsk_array_view_const(array_type, array),
 	    hasher_type,
 	    hasher
@@ -442,13 +527,16 @@ const TskTraitIterableConst tsk_array_type_trait_iterable_const = {
 	.iterator      = tsk_array_type_trait_iterable_const_iterator,
 };
 
-#define TSK_ARRAY_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_array_types_registry = TSK_TYPE_REGISTRY(sizeof(TskArrayType));
 
-TskArrayType tsk_array_types[TSK_ARRAY_TYPES_CAPACITY];
+static inline TskBoolean tsk_array_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskArrayType *array_type_entry = entry;
+	return array_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_array_type_is_valid(const TskType *array_type) {
 	return tsk_type_is_valid(array_type) &&
-	       &tsk_array_types[0] <= (const TskArrayType *)array_type && (const TskArrayType *)array_type < &tsk_array_types[TSK_ARRAY_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_array_types_registry, array_type);
 }
 const TskType *tsk_array_type(const TskType *element_type) {
 	assert(tsk_type_is_valid(element_type));
@@ -463,76 +551,78 @@ const TskType *tsk_array_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_ARRAY_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_array_types[index].element_type != TSK_NULL) {
-		if (tsk_array_types[index].element_type == element_type) {
-			return &tsk_array_types[index].array_type;
-		}
-		index = (index + 1) & (TSK_ARRAY_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_array_types_registry, hash, tsk_array_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskArrayType *)entry)->array_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_array_types[index].array_type.trait_table                                                                                               = &tsk_array_types[index].array_type_trait_table;
-	tsk_array_types[index].array_type_trait_table.entries                                                                                       = tsk_array_types[index].array_type_trait_table_entries;
-	tsk_array_types[index].array_type_trait_table.capacity                                                                                      = sizeof(tsk_array_types[index].array_type_trait_table_entries) / sizeof(tsk_array_types[index].array_type_trait_table_entries[0]);
+	TskArrayType *array_type_entry                                          = entry;
 
-	tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	array_type_entry->array_type.trait_table                                = &array_type_entry->array_type_trait_table;
+	array_type_entry->array_type.layout                                     = &array_type_entry->array_type_layout;
+	array_type_entry->array_type_trait_table.entries                        = array_type_entry->array_type_trait_table_entries;
+	array_type_entry->array_type_trait_table.capacity                       = 0;
+
+	array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_COMPLETE,
 		.trait_data = &tsk_array_type_trait_complete,
 	};
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_DROPPABLE)) {
-		tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
 			.trait_data = &tsk_array_type_trait_droppable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_CLONABLE)) {
-		tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_CLONABLE,
 			.trait_data = &tsk_array_type_trait_clonable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPARABLE)) {
-		tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_COMPARABLE,
 			.trait_data = &tsk_array_type_trait_comparable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE)) {
-		tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_EQUATABLE,
 			.trait_data = &tsk_array_type_trait_equatable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE)) {
-		tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_HASHABLE,
 			.trait_data = &tsk_array_type_trait_hashable,
 		};
 	}
-	tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_ITERABLE,
 		.trait_data = &tsk_array_type_trait_iterable,
 	};
-	tsk_array_types[index].array_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE_CONST & (tsk_array_types[index].array_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	array_type_entry->array_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE_CONST] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_ITERABLE_CONST,
 		.trait_data = &tsk_array_type_trait_iterable_const,
 	};
 
-	tsk_array_types[index].element_type = element_type;
+	array_type_entry->element_type = element_type;
 
 	(void)snprintf(
-	    tsk_array_types[index].array_type_name,
-	    sizeof(tsk_array_types[index].array_type_name),
+	    array_type_entry->array_type_name,
+	    sizeof(array_type_entry->array_type_name),
 	    "TskArray<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_array_types[index].array_type.name = tsk_array_types[index].array_type_name;
+	array_type_entry->array_type.name = array_type_entry->array_type_name;
+
+	const TskType *array_type         = &array_type_entry->array_type;
+
+	(void)tsk_type_layout(array_type);
 
-	const TskType *array_type              = &tsk_array_types[index].array_type;
+	tsk_type_registry_publish(&tsk_array_types_registry, entry);
 
 	assert(tsk_array_type_is_valid(array_type));
 
@@ -544,7 +634,8 @@ struct TskArrayViewType {
 	TskType                array_view_type;
 	TskCharacter           array_view_type_name[40];
 	TskTypeTraitTable      array_view_type_trait_table;
-	TskTypeTraitTableEntry array_view_type_trait_table_entries[16];
+	TskTypeTraitTableEntry array_view_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          array_view_type_layout;
 	const TskType         *element_type;
 };
 
@@ -889,7 +980,8 @@ struct TskArrayViewConstType {
 	TskType                array_view_const_type;
 	TskCharacter           array_view_const_type_name[40];
 	TskTypeTraitTable      array_view_const_type_trait_table;
-	TskTypeTraitTableEntry array_view_const_type_trait_table_entries[16];
+	TskTypeTraitTableEntry array_view_const_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          array_view_const_type_layout;
 	const TskType         *element_type;
 };
 
@@ -923,13 +1015,16 @@ const TskTraitHashable tsk_array_view_type_trait_hashable = {
 	.hash = tsk_array_view_type_trait_hashable_hash,
 };
 
-#define TSK_ARRAY_VIEW_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_array_view_types_registry = TSK_TYPE_REGISTRY(sizeof(TskArrayViewType));
 
-TskArrayViewType tsk_array_view_types[TSK_ARRAY_VIEW_TYPES_CAPACITY];
+static inline TskBoolean tsk_array_view_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskArrayViewType *array_view_type_entry = entry;
+	return array_view_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_array_view_type_is_valid(const TskType *array_view_type) {
 	return tsk_type_is_valid(array_view_type) &&
-	       &tsk_array_view_types[0] <= (const TskArrayViewType *)array_view_type && (const TskArrayViewType *)array_view_type < &tsk_array_view_types[TSK_ARRAY_VIEW_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_array_view_types_registry, array_view_type);
 }
 const TskType *tsk_array_view_type(const TskType *element_type) {
 	assert(tsk_type_is_valid(element_type));
@@ -944,68 +1039,70 @@ const TskType *tsk_array_view_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_ARRAY_VIEW_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_array_view_types[index].element_type != TSK_NULL) {
-		if (tsk_array_view_types[index].element_type == element_type) {
-			return &tsk_array_view_types[index].array_view_type;
-		}
-		index = (index + 1) & (TSK_ARRAY_VIEW_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_array_view_types_registry, hash, tsk_array_view_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskArrayViewType *)entry)->array_view_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_array_view_types[index].array_view_type.trait_table                                                                                                         = &tsk_array_view_types[index].array_view_type_trait_table;
-	tsk_array_view_types[index].array_view_type_trait_table.entries                                                                                                 = tsk_array_view_types[index].array_view_type_trait_table_entries;
-	tsk_array_view_types[index].array_view_type_trait_table.capacity                                                                                                = sizeof(tsk_array_view_types[index].array_view_type_trait_table_entries) / sizeof(tsk_array_view_types[index].array_view_type_trait_table_entries[0]);
+	TskArrayViewType *array_view_type_entry                                           = entry;
+
+	array_view_type_entry->array_view_type.trait_table                                = &array_view_type_entry->array_view_type_trait_table;
+	array_view_type_entry->array_view_type.layout                                     = &array_view_type_entry->array_view_type_layout;
+	array_view_type_entry->array_view_type_trait_table.entries                        = array_view_type_entry->array_view_type_trait_table_entries;
+	array_view_type_entry->array_view_type_trait_table.capacity                       = 0;
 
-	tsk_array_view_types[index].array_view_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE & (tsk_array_view_types[index].array_view_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	array_view_type_entry->array_view_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_COMPLETE,
 		.trait_data = &tsk_array_view_type_trait_complete,
 	};
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_DROPPABLE)) {
-		tsk_array_view_types[index].array_view_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE & (tsk_array_view_types[index].array_view_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_type_entry->array_view_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
 			.trait_data = &tsk_array_view_type_trait_droppable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_CLONABLE)) {
-		tsk_array_view_types[index].array_view_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE & (tsk_array_view_types[index].array_view_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_type_entry->array_view_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_CLONABLE,
 			.trait_data = &tsk_array_view_type_trait_clonable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPARABLE)) {
-		tsk_array_view_types[index].array_view_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE & (tsk_array_view_types[index].array_view_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_type_entry->array_view_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_COMPARABLE,
 			.trait_data = &tsk_array_view_type_trait_comparable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE)) {
-		tsk_array_view_types[index].array_view_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE & (tsk_array_view_types[index].array_view_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_type_entry->array_view_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_EQUATABLE,
 			.trait_data = &tsk_array_view_type_trait_equatable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE)) {
-		tsk_array_view_types[index].array_view_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE & (tsk_array_view_types[index].array_view_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_type_entry->array_view_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_HASHABLE,
 			.trait_data = &tsk_array_view_type_trait_hashable,
 		};
 	}
 
-	tsk_array_view_types[index].element_type = element_type;
+	array_view_type_entry->element_type = element_type;
 
 	(void)snprintf(
-	    tsk_array_view_types[index].array_view_type_name,
-	    sizeof(tsk_array_view_types[index].array_view_type_name),
+	    array_view_type_entry->array_view_type_name,
+	    sizeof(array_view_type_entry->array_view_type_name),
 	    "TskArrayView<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_array_view_types[index].array_view_type.name = tsk_array_view_types[index].array_view_type_name;
+	array_view_type_entry->array_view_type.name = array_view_type_entry->array_view_type_name;
 
-	const TskType *array_view_type                   = &tsk_array_view_types[index].array_view_type;
+	const TskType *array_view_type              = &array_view_type_entry->array_view_type;
+
+	(void)tsk_type_layout(array_view_type);
+
+	tsk_type_registry_publish(&tsk_array_view_types_registry, entry);
 
 	assert(tsk_array_view_type_is_valid(array_view_type));
 
@@ -1146,12 +1243,13 @@ TskBoolean tsk_array_view_const_linear_search(const TskType *array_view_type, Ts
 	assert(element != TSK_NULL);
 	assert(tsk_type_has_trait(tsk_array_view_const_element_type(array_view_type), TSK_TRAIT_ID_EQUATABLE));
 
+	const TskTypeLayout *element_layout = tsk_type_layout(tsk_array_view_const_element_type(array_view_type));
 	for (TskUSize i = 0; i < tsk_array_view_const_length(array_view_type, array_view); i++) {
-		if (tsk_trait_equatable_equals(
-		        tsk_array_view_const_element_type(array_view_type),
-		        tsk_array_view_const_get(array_view_type, array_view, i),
-		        element
-		    )) {
+		const TskAny *candidate = tsk_array_view_const_get(array_view_type, array_view, i);
+		TskBoolean    found     = element_layout->is_bitwise_equatable
+		                            ? memcmp(candidate, element, element_layout->size) == 0
+		                            : tsk_trait_equatable_equals(tsk_array_view_const_element_type(array_view_type), candidate, element);
+		if (found) {
 			if (index != TSK_NULL) {
 				*index = i;
 			}
@@ -1362,6 +1460,29 @@ TskBoolean tsk_array_view_const_equals(const TskType *array_view_type, TskArrayV
 		return TSK_FALSE;
 	}
 
+	const TskTypeLayout *element_layout = tsk_type_layout(tsk_array_view_const_element_type(array_view_type));
+	if (element_layout->is_bitwise_equatable) {
+		if (tsk_array_view_const_stride(array_view_type, array_view_1) == 1 && tsk_array_view_const_stride(array_view_type, array_view_2) == 1) {
+			return tsk_array_view_const_is_empty(array_view_type, array_view_1) ||
+			       memcmp(
+			           tsk_array_view_const_elements(array_view_type, array_view_1),
+			           tsk_array_view_const_elements(array_view_type, array_view_2),
+			           tsk_array_view_const_length(array_view_type, array_view_1) * element_layout->size
+			       ) == 0;
+		}
+
+		for (TskUSize i = 0; i < tsk_array_view_const_length(array_view_type, array_view_1); i++) {
+			if (memcmp(
+			        tsk_array_view_const_get(array_view_type, array_view_1, i),
+			        tsk_array_view_const_get(array_view_type, array_view_2, i),
+			        element_layout->size
+			    ) != 0) {
+				return TSK_FALSE;
+			}
+		}
+		return TSK_TRUE;
+	}
+
 	for (TskUSize i = 0; i < tsk_array_view_const_length(array_view_type, array_view_1); i++) {
 		if (!tsk_trait_equatable_equals(
 		        tsk_array_view_const_element_type(array_view_type),
@@ -1387,6 +1508,46 @@ TskEmpty tsk_array_view_const_hash(const TskType *array_view_type, TskArrayViewC
 	    sizeof(length)
 	);
 
+	const TskTypeLayout *element_layout = tsk_type_layout(tsk_array_view_const_element_type(array_view_type));
+	if (element_layout->is_bytewise_hashable) {
+		TskUSize element_size = element_layout->size;
+
+		if (tsk_array_view_const_stride(array_view_type, array_view) == 1) {
+			const TskU8 *bytes        = tsk_array_view_const_elements(array_view_type, array_view);
+			TskUSize     bytes_length = length * element_size;
+			for (TskUSize offset = 0; offset < bytes_length; offset += TSK_ARRAY_VIEW_HASH_CHUNK_SIZE) {
+				tsk_trait_hasher_combine(
+				    hasher_type,
+				    hasher,
+				    bytes + offset,
+				    bytes_length - offset < TSK_ARRAY_VIEW_HASH_CHUNK_SIZE ? bytes_length - offset : TSK_ARRAY_VIEW_HASH_CHUNK_SIZE
+				);
+			}
+			return;
+		}
+
+		alignas(max_align_t) TskU8 chunk[TSK_ARRAY_VIEW_HASH_CHUNK_SIZE];
+		TskUSize                   chunk_length = 0;
+		for (TskUSize i = 0; i < length; i++) {
+			const TskU8 *element = tsk_array_view_const_get(array_view_type, array_view, i);
+			for (TskUSize copied = 0; copied < element_size;) {
+				TskUSize copy_length = element_size - copied < TSK_ARRAY_VIEW_HASH_CHUNK_SIZE - chunk_length ? element_size - copied : TSK_ARRAY_VIEW_HASH_CHUNK_SIZE - chunk_length;
+				memcpy(chunk + chunk_length, element + copied, copy_length);
+				chunk_length += copy_length;
+				copied += copy_length;
+
+				if (chunk_length == TSK_ARRAY_VIEW_HASH_CHUNK_SIZE) {
+					tsk_trait_hasher_combine(hasher_type, hasher, chunk, chunk_length);
+					chunk_length = 0;
+				}
+			}
+		}
+		if (chunk_length != 0) {
+			tsk_trait_hasher_combine(hasher_type, hasher, chunk, chunk_length);
+		}
+		return;
+	}
+
 	for (TskUSize i = 0; i < tsk_array_view_const_length(array_view_type, array_view); i++) {
 		tsk_trait_hashable_hash(
 		    tsk_array_view_const_element_type(array_view_type),
@@ -1427,13 +1588,16 @@ const TskTraitHashable tsk_array_view_const_type_trait_hashable = {
 	.hash = tsk_array_view_const_type_trait_hashable_hash,
 };
 
-#define TSK_ARRAY_VIEW_CONST_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_array_view_const_types_registry = TSK_TYPE_REGISTRY(sizeof(TskArrayViewConstType));
 
-TskArrayViewConstType tsk_array_view_const_types[TSK_ARRAY_VIEW_CONST_TYPES_CAPACITY];
+static inline TskBoolean tsk_array_view_const_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskArrayViewConstType *array_view_const_type_entry = entry;
+	return array_view_const_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_array_view_const_type_is_valid(const TskType *array_view_type) {
 	return tsk_type_is_valid(array_view_type) &&
-	       &tsk_array_view_const_types[0] <= (const TskArrayViewConstType *)array_view_type && (const TskArrayViewConstType *)array_view_type < &tsk_array_view_const_types[TSK_ARRAY_VIEW_CONST_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_array_view_const_types_registry, array_view_type);
 }
 const TskType *tsk_array_view_const_type(const TskType *element_type) {
 	assert(tsk_type_is_valid(element_type));
@@ -1448,68 +1612,70 @@ const TskType *tsk_array_view_const_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_ARRAY_VIEW_CONST_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_array_view_const_types[index].element_type != TSK_NULL) {
-		if (tsk_array_view_const_types[index].element_type == element_type) {
-			return &tsk_array_view_const_types[index].array_view_const_type;
-		}
-		index = (index + 1) & (TSK_ARRAY_VIEW_CONST_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_array_view_const_types_registry, hash, tsk_array_view_const_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskArrayViewConstType *)entry)->array_view_const_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_array_view_const_types[index].array_view_const_type.trait_table                                                                                                                     = &tsk_array_view_const_types[index].array_view_const_type_trait_table;
-	tsk_array_view_const_types[index].array_view_const_type_trait_table.entries                                                                                                             = tsk_array_view_const_types[index].array_view_const_type_trait_table_entries;
-	tsk_array_view_const_types[index].array_view_const_type_trait_table.capacity                                                                                                            = sizeof(tsk_array_view_const_types[index].array_view_const_type_trait_table_entries) / sizeof(tsk_array_view_const_types[index].array_view_const_type_trait_table_entries[0]);
+	TskArrayViewConstType *array_view_const_type_entry                                            = entry;
+
+	array_view_const_type_entry->array_view_const_type.trait_table                                = &array_view_const_type_entry->array_view_const_type_trait_table;
+	array_view_const_type_entry->array_view_const_type.layout                                     = &array_view_const_type_entry->array_view_const_type_layout;
+	array_view_const_type_entry->array_view_const_type_trait_table.entries                        = array_view_const_type_entry->array_view_const_type_trait_table_entries;
+	array_view_const_type_entry->array_view_const_type_trait_table.capacity                       = 0;
 
-	tsk_array_view_const_types[index].array_view_const_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE & (tsk_array_view_const_types[index].array_view_const_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	array_view_const_type_entry->array_view_const_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_COMPLETE,
 		.trait_data = &tsk_array_view_const_type_trait_complete,
 	};
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_DROPPABLE)) {
-		tsk_array_view_const_types[index].array_view_const_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE & (tsk_array_view_const_types[index].array_view_const_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_const_type_entry->array_view_const_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
 			.trait_data = &tsk_array_view_const_type_trait_droppable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_CLONABLE)) {
-		tsk_array_view_const_types[index].array_view_const_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE & (tsk_array_view_const_types[index].array_view_const_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_const_type_entry->array_view_const_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_CLONABLE,
 			.trait_data = &tsk_array_view_const_type_trait_clonable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPARABLE)) {
-		tsk_array_view_const_types[index].array_view_const_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE & (tsk_array_view_const_types[index].array_view_const_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_const_type_entry->array_view_const_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_COMPARABLE,
 			.trait_data = &tsk_array_view_const_type_trait_comparable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE)) {
-		tsk_array_view_const_types[index].array_view_const_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE & (tsk_array_view_const_types[index].array_view_const_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_const_type_entry->array_view_const_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_EQUATABLE,
 			.trait_data = &tsk_array_view_const_type_trait_equatable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE)) {
-		tsk_array_view_const_types[index].array_view_const_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE & (tsk_array_view_const_types[index].array_view_const_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		array_view_const_type_entry->array_view_const_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_HASHABLE,
 			.trait_data = &tsk_array_view_const_type_trait_hashable,
 		};
 	}
 
-	tsk_array_view_const_types[index].element_type = element_type;
+	array_view_const_type_entry->element_type = element_type;
 
 	(void)snprintf(
-	    tsk_array_view_const_types[index].array_view_const_type_name,
-	    sizeof(tsk_array_view_const_types[index].array_view_const_type_name),
+	    array_view_const_type_entry->array_view_const_type_name,
+	    sizeof(array_view_const_type_entry->array_view_const_type_name),
 	    "TskArrayViewConst<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_array_view_const_types[index].array_view_const_type.name = tsk_array_view_const_types[index].array_view_const_type_name;
+	array_view_const_type_entry->array_view_const_type.name = array_view_const_type_entry->array_view_const_type_name;
+
+	const TskType *array_view_const_type                    = &array_view_const_type_entry->array_view_const_type;
+
+	(void)tsk_type_layout(array_view_const_type);
 
-	const TskType *array_view_const_type                         = &tsk_array_view_const_types[index].array_view_const_type;
+	tsk_type_registry_publish(&tsk_array_view_const_types_registry, entry);
 
 	assert(tsk_array_view_const_type_is_valid(array_view_const_type));
 
@@ -1620,13 +1786,16 @@ TSK_TYPE(tsk_array_iterator_type_, TskArrayIterator,
 );
 // clang-format on
 
-#define TSK_ARRAY_ITERATOR_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_array_iterator_types_registry = TSK_TYPE_REGISTRY(sizeof(TskArrayIteratorType));
 
-TskArrayIteratorType tsk_array_iterator_types[TSK_ARRAY_ITERATOR_TYPES_CAPACITY];
+static inline TskBoolean tsk_array_iterator_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskArrayIteratorType *array_iterator_type_entry = entry;
+	return array_iterator_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_array_iterator_type_is_valid(const TskType *array_iterator_type) {
 	return tsk_type_is_valid(array_iterator_type) &&
-	       &tsk_array_iterator_types[0] <= (const TskArrayIteratorType *)array_iterator_type && (const TskArrayIteratorType *)array_iterator_type < &tsk_array_iterator_types[TSK_ARRAY_ITERATOR_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_array_iterator_types_registry, array_iterator_type);
 }
 const TskType *tsk_array_iterator_type(const TskType *element_type) {
 	assert(tsk_array_type_is_valid(element_type));
@@ -1641,30 +1810,29 @@ const TskType *tsk_array_iterator_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_ARRAY_ITERATOR_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_array_iterator_types[index].element_type != TSK_NULL) {
-		if (tsk_array_iterator_types[index].element_type == element_type) {
-			return &tsk_array_iterator_types[index].array_iterator_type;
-		}
-		index = (index + 1) & (TSK_ARRAY_ITERATOR_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_array_iterator_types_registry, hash, tsk_array_iterator_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskArrayIteratorType *)entry)->array_iterator_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_array_iterator_types[index].array_iterator_type = *tsk_array_iterator_type_;
-	tsk_array_iterator_types[index].element_type        = element_type;
+	TskArrayIteratorType *array_iterator_type_entry = entry;
+
+	array_iterator_type_entry->array_iterator_type  = *tsk_array_iterator_type_;
+	array_iterator_type_entry->element_type         = element_type;
 
 	(void)snprintf(
-	    tsk_array_iterator_types[index].array_iterator_type_name,
-	    sizeof(tsk_array_iterator_types[index].array_iterator_type_name),
+	    array_iterator_type_entry->array_iterator_type_name,
+	    sizeof(array_iterator_type_entry->array_iterator_type_name),
 	    "TskArrayIterator<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_array_iterator_types[index].array_iterator_type.name = tsk_array_iterator_types[index].array_iterator_type_name;
+	array_iterator_type_entry->array_iterator_type.name = array_iterator_type_entry->array_iterator_type_name;
+
+	const TskType *array_iterator_type                  = &array_iterator_type_entry->array_iterator_type;
 
-	const TskType *array_iterator_type                       = &tsk_array_iterator_types[index].array_iterator_type;
+	tsk_type_registry_publish(&tsk_array_iterator_types_registry, entry);
 
 	assert(tsk_array_iterator_type_is_valid(array_iterator_type));
 
@@ -1775,13 +1943,16 @@ TSK_TYPE(tsk_array_iterator_const_type_, TskArrayIteratorConst,
 );
 // clang-format on
 
-#define TSK_ARRAY_ITERATOR_CONST_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_array_iterator_const_types_registry = TSK_TYPE_REGISTRY(sizeof(TskArrayIteratorConstType));
 
-TskArrayIteratorConstType tsk_array_iterator_const_types[TSK_ARRAY_ITERATOR_CONST_TYPES_CAPACITY];
+static inline TskBoolean tsk_array_iterator_const_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskArrayIteratorConstType *array_iterator_const_type_entry = entry;
+	return array_iterator_const_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_array_iterator_const_type_is_valid(const TskType *array_iterator_type) {
 	return tsk_type_is_valid(array_iterator_type) &&
-	       &tsk_array_iterator_const_types[0] <= (const TskArrayIteratorConstType *)array_iterator_type && (const TskArrayIteratorConstType *)array_iterator_type < &tsk_array_iterator_const_types[TSK_ARRAY_ITERATOR_CONST_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_array_iterator_const_types_registry, array_iterator_type);
 }
 const TskType *tsk_array_iterator_const_type(const TskType *element_type) {
 	assert(tsk_type_is_valid(element_type));
@@ -1796,30 +1967,29 @@ const TskType *tsk_array_iterator_const_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_ARRAY_ITERATOR_CONST_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_array_iterator_const_types[index].element_type != TSK_NULL) {
-		if (tsk_array_iterator_const_types[index].element_type == element_type) {
-			return &tsk_array_iterator_const_types[index].array_iterator_const_type;
-		}
-		index = (index + 1) & (TSK_ARRAY_ITERATOR_CONST_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_array_iterator_const_types_registry, hash, tsk_array_iterator_const_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskArrayIteratorConstType *)entry)->array_iterator_const_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_array_iterator_const_types[index].array_iterator_const_type = *tsk_array_iterator_const_type_;
-	tsk_array_iterator_const_types[index].element_type              = element_type;
+	TskArrayIteratorConstType *array_iterator_const_type_entry = entry;
+
+	array_iterator_const_type_entry->array_iterator_const_type = *tsk_array_iterator_const_type_;
+	array_iterator_const_type_entry->element_type              = element_type;
 
 	(void)snprintf(
-	    tsk_array_iterator_const_types[index].array_iterator_const_type_name,
-	    sizeof(tsk_array_iterator_const_types[index].array_iterator_const_type_name),
+	    array_iterator_const_type_entry->array_iterator_const_type_name,
+	    sizeof(array_iterator_const_type_entry->array_iterator_const_type_name),
 	    "TskArrayIteratorConst<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_array_iterator_const_types[index].array_iterator_const_type.name = tsk_array_iterator_const_types[index].array_iterator_const_type_name;
+	array_iterator_const_type_entry->array_iterator_const_type.name = array_iterator_const_type_entry->array_iterator_const_type_name;
+
+	const TskType *array_iterator_const_type                        = &array_iterator_const_type_entry->array_iterator_const_type;
 
-	const TskType *array_iterator_const_type                             = &tsk_array_iterator_const_types[index].array_iterator_const_type;
+	tsk_type_registry_publish(&tsk_array_iterator_const_types_registry, entry);
 
 	assert(tsk_array_iterator_const_type_is_valid(array_iterator_const_type));
 
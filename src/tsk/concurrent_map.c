@@ -0,0 +1,353 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <tsk/concurrent_map.h>
+
+#include <tsk/default_hasher.h>
+#include <tsk/trait/builder.h>
+#include <tsk/trait/clonable.h>
+#include <tsk/trait/complete.h>
+#include <tsk/trait/droppable.h>
+#include <tsk/trait/equatable.h>
+#include <tsk/trait/hashable.h>
+#include <tsk/trait/hasher.h>
+#include <tsk/type_registry.h>
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TSK_CONCURRENT_MAP_CACHE_LINE_SIZE ((TskUSize)64)
+
+typedef struct TskConcurrentMapType TskConcurrentMapType;
+struct TskConcurrentMapType {
+	TskType                concurrent_map_type;
+	TskCharacter           concurrent_map_type_name[40];
+	TskTypeTraitTable      concurrent_map_type_trait_table;
+	TskTypeTraitTableEntry concurrent_map_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          concurrent_map_type_layout;
+	const TskType         *key_type;
+	const TskType         *value_type;
+	const TskType         *map_type;
+};
+
+struct TskConcurrentMapShard {
+	alignas(TSK_CONCURRENT_MAP_CACHE_LINE_SIZE) pthread_rwlock_t lock;
+	TskMap map;
+};
+
+static inline TskConcurrentMapShard *tsk_concurrent_map_shard(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map, TskU64 hash) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	return &concurrent_map->shards[(TskUSize)(((hash >> 32) * concurrent_map->shards_length) >> 32)];
+}
+static inline TskBoolean tsk_concurrent_map_shards_new(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, TskUSize shards_length) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(concurrent_map != TSK_NULL);
+	assert(shards_length != 0 && shards_length <= UINT32_MAX);
+
+	TskConcurrentMapShard *shards = aligned_alloc(TSK_CONCURRENT_MAP_CACHE_LINE_SIZE, shards_length * sizeof(TskConcurrentMapShard));
+	if (shards == TSK_NULL) {
+		return TSK_FALSE;
+	}
+
+	for (TskUSize i = 0; i < shards_length; i++) {
+		if (pthread_rwlock_init(&shards[i].lock, TSK_NULL) != 0) {
+			for (TskUSize j = 0; j < i; j++) {
+				tsk_map_drop(tsk_concurrent_map_map_type(concurrent_map_type), &shards[j].map);
+				(void)pthread_rwlock_destroy(&shards[j].lock);
+			}
+			free(shards);
+			return TSK_FALSE;
+		}
+
+		if (!tsk_map_clone(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->prototype, &shards[i].map)) {
+			(void)pthread_rwlock_destroy(&shards[i].lock);
+			for (TskUSize j = 0; j < i; j++) {
+				tsk_map_drop(tsk_concurrent_map_map_type(concurrent_map_type), &shards[j].map);
+				(void)pthread_rwlock_destroy(&shards[j].lock);
+			}
+			free(shards);
+			return TSK_FALSE;
+		}
+	}
+
+	concurrent_map->shards        = shards;
+	concurrent_map->shards_length = shards_length;
+
+	return TSK_TRUE;
+}
+
+TskBoolean tsk_concurrent_map_is_valid(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+
+	return concurrent_map != TSK_NULL &&
+	       concurrent_map->shards != TSK_NULL &&
+	       concurrent_map->shards_length != 0 &&
+	       tsk_map_is_valid(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->prototype) &&
+	       tsk_map_is_empty(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->prototype);
+}
+TskBoolean tsk_concurrent_map_new(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, TskUSize shards_length) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(concurrent_map != TSK_NULL);
+	assert(shards_length != 0 && shards_length <= UINT32_MAX);
+
+	concurrent_map->prototype = tsk_map_new(tsk_concurrent_map_map_type(concurrent_map_type));
+
+	if (!tsk_concurrent_map_shards_new(concurrent_map_type, concurrent_map, shards_length)) {
+		tsk_map_drop(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->prototype);
+		return TSK_FALSE;
+	}
+
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_concurrent_map_with_hasher_builder(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, TskUSize shards_length, const TskType *hasher_builder_type, TskAny *hasher_builder) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(concurrent_map != TSK_NULL);
+	assert(shards_length != 0 && shards_length <= UINT32_MAX);
+	assert(tsk_type_is_valid(hasher_builder_type));
+	assert(tsk_type_has_trait(hasher_builder_type, TSK_TRAIT_ID_CLONABLE));
+	assert(hasher_builder != TSK_NULL);
+
+	if (!tsk_map_with_hasher_builder(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->prototype, hasher_builder_type, hasher_builder)) {
+		return TSK_FALSE;
+	}
+
+	if (!tsk_concurrent_map_shards_new(concurrent_map_type, concurrent_map, shards_length)) {
+		tsk_map_drop(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->prototype);
+		return TSK_FALSE;
+	}
+
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	return TSK_TRUE;
+}
+TskEmpty tsk_concurrent_map_drop(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	for (TskUSize i = 0; i < concurrent_map->shards_length; i++) {
+		tsk_map_drop(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->shards[i].map);
+		(void)pthread_rwlock_destroy(&concurrent_map->shards[i].lock);
+	}
+	free(concurrent_map->shards);
+
+	tsk_map_drop(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->prototype);
+
+	concurrent_map->shards        = TSK_NULL;
+	concurrent_map->shards_length = 0;
+}
+const TskType *tsk_concurrent_map_key_type(const TskType *concurrent_map_type) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+
+	return ((const TskConcurrentMapType *)concurrent_map_type)->key_type;
+}
+const TskType *tsk_concurrent_map_value_type(const TskType *concurrent_map_type) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+
+	return ((const TskConcurrentMapType *)concurrent_map_type)->value_type;
+}
+const TskType *tsk_concurrent_map_map_type(const TskType *concurrent_map_type) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+
+	return ((const TskConcurrentMapType *)concurrent_map_type)->map_type;
+}
+TskUSize tsk_concurrent_map_shards_length(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	return concurrent_map->shards_length;
+}
+TskUSize tsk_concurrent_map_length(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	TskUSize length = 0;
+	for (TskUSize i = 0; i < concurrent_map->shards_length; i++) {
+		(void)pthread_rwlock_rdlock(&concurrent_map->shards[i].lock);
+		length += tsk_map_length(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->shards[i].map);
+		(void)pthread_rwlock_unlock(&concurrent_map->shards[i].lock);
+	}
+
+	return length;
+}
+TskBoolean tsk_concurrent_map_is_empty(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	return tsk_concurrent_map_length(concurrent_map_type, concurrent_map) == 0;
+}
+TskBoolean tsk_concurrent_map_contains(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map, const TskAny *key) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+	assert(key != TSK_NULL);
+
+	const TskType         *map_type = tsk_concurrent_map_map_type(concurrent_map_type);
+	TskU64                 hash     = tsk_map_hash(map_type, &concurrent_map->prototype, tsk_map_key_type(map_type), key);
+	TskConcurrentMapShard *shard    = tsk_concurrent_map_shard(concurrent_map_type, concurrent_map, hash);
+
+	(void)pthread_rwlock_rdlock(&shard->lock);
+	TskBoolean contains = tsk_map_get_const_with_hash(map_type, &shard->map, key, hash) != TSK_NULL;
+	(void)pthread_rwlock_unlock(&shard->lock);
+
+	return contains;
+}
+TskBoolean tsk_concurrent_map_get(const TskType *concurrent_map_type, const TskConcurrentMap *concurrent_map, const TskAny *key, TskAny *value) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+	assert(key != TSK_NULL);
+	assert(tsk_type_has_trait(tsk_concurrent_map_value_type(concurrent_map_type), TSK_TRAIT_ID_CLONABLE));
+	assert(value != TSK_NULL);
+
+	const TskType         *map_type = tsk_concurrent_map_map_type(concurrent_map_type);
+	TskU64                 hash     = tsk_map_hash(map_type, &concurrent_map->prototype, tsk_map_key_type(map_type), key);
+	TskConcurrentMapShard *shard    = tsk_concurrent_map_shard(concurrent_map_type, concurrent_map, hash);
+
+	(void)pthread_rwlock_rdlock(&shard->lock);
+	const TskAny *stored_value = tsk_map_get_const_with_hash(map_type, &shard->map, key, hash);
+	TskBoolean    found        = stored_value != TSK_NULL && tsk_trait_clonable_clone(tsk_map_value_type(map_type), stored_value, value);
+	(void)pthread_rwlock_unlock(&shard->lock);
+
+	return found;
+}
+TskEmpty tsk_concurrent_map_clear(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+
+	for (TskUSize i = 0; i < concurrent_map->shards_length; i++) {
+		(void)pthread_rwlock_wrlock(&concurrent_map->shards[i].lock);
+		tsk_map_clear(tsk_concurrent_map_map_type(concurrent_map_type), &concurrent_map->shards[i].map);
+		(void)pthread_rwlock_unlock(&concurrent_map->shards[i].lock);
+	}
+}
+TskBoolean tsk_concurrent_map_insert(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, TskAny *key, TskAny *value) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	const TskType         *map_type = tsk_concurrent_map_map_type(concurrent_map_type);
+	TskU64                 hash     = tsk_map_hash(map_type, &concurrent_map->prototype, tsk_map_key_type(map_type), key);
+	TskConcurrentMapShard *shard    = tsk_concurrent_map_shard(concurrent_map_type, concurrent_map, hash);
+
+	(void)pthread_rwlock_wrlock(&shard->lock);
+	TskBoolean inserted = tsk_map_insert_with_hash(map_type, &shard->map, key, value, hash);
+	(void)pthread_rwlock_unlock(&shard->lock);
+
+	return inserted;
+}
+TskBoolean tsk_concurrent_map_remove(const TskType *concurrent_map_type, TskConcurrentMap *concurrent_map, const TskAny *key, TskAny *value) {
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+	assert(tsk_concurrent_map_is_valid(concurrent_map_type, concurrent_map));
+	assert(key != TSK_NULL);
+
+	const TskType         *map_type = tsk_concurrent_map_map_type(concurrent_map_type);
+	TskU64                 hash     = tsk_map_hash(map_type, &concurrent_map->prototype, tsk_map_key_type(map_type), key);
+	TskConcurrentMapShard *shard    = tsk_concurrent_map_shard(concurrent_map_type, concurrent_map, hash);
+
+	(void)pthread_rwlock_wrlock(&shard->lock);
+	TskBoolean removed = tsk_map_remove(map_type, &shard->map, key, value);
+	(void)pthread_rwlock_unlock(&shard->lock);
+
+	return removed;
+}
+
+TskEmpty tsk_concurrent_map_type_trait_droppable_drop(const TskType *droppable_type, TskAny *droppable) {
+	tsk_concurrent_map_drop(droppable_type, droppable);
+}
+
+const TskTraitComplete tsk_concurrent_map_type_trait_complete = {
+	.size      = sizeof(TskConcurrentMap),
+	.alignment = alignof(TskConcurrentMap),
+};
+const TskTraitDroppable tsk_concurrent_map_type_trait_droppable = {
+	.drop = tsk_concurrent_map_type_trait_droppable_drop,
+};
+
+TskTypeRegistry tsk_concurrent_map_types_registry = TSK_TYPE_REGISTRY(sizeof(TskConcurrentMapType));
+
+static inline TskBoolean tsk_concurrent_map_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskConcurrentMapType *concurrent_map_type_entry = entry;
+	return concurrent_map_type_entry->key_type == ((const TskType *const *)key)[0] && concurrent_map_type_entry->value_type == ((const TskType *const *)key)[1];
+}
+
+TskBoolean tsk_concurrent_map_type_is_valid(const TskType *concurrent_map_type) {
+	return tsk_type_is_valid(concurrent_map_type) &&
+	       tsk_type_registry_contains(&tsk_concurrent_map_types_registry, concurrent_map_type);
+}
+const TskType *tsk_concurrent_map_type(const TskType *key_type, const TskType *value_type) {
+	assert(tsk_type_is_valid(key_type));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_EQUATABLE));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_HASHABLE));
+	assert(tsk_type_is_valid(value_type));
+	assert(tsk_type_has_trait(value_type, TSK_TRAIT_ID_COMPLETE));
+
+	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
+	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
+	tsk_trait_builder_build(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher);
+
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&key_type, sizeof(key_type));     // NOLINT(bugprone-sizeof-expression)
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&value_type, sizeof(value_type)); // NOLINT(bugprone-sizeof-expression)
+	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
+
+	tsk_trait_droppable_drop(hasher_type, hasher);
+
+	const TskType *map_type = tsk_map_type(key_type, value_type);
+	if (map_type == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_concurrent_map_types_registry, hash, tsk_concurrent_map_types_equals, (const TskType *[]){ key_type, value_type }, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskConcurrentMapType *)entry)->concurrent_map_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
+	}
+
+	TskConcurrentMapType *concurrent_map_type_entry                                           = entry;
+
+	concurrent_map_type_entry->concurrent_map_type.trait_table                                = &concurrent_map_type_entry->concurrent_map_type_trait_table;
+	concurrent_map_type_entry->concurrent_map_type.layout                                     = &concurrent_map_type_entry->concurrent_map_type_layout;
+	concurrent_map_type_entry->concurrent_map_type_trait_table.entries                        = concurrent_map_type_entry->concurrent_map_type_trait_table_entries;
+	concurrent_map_type_entry->concurrent_map_type_trait_table.capacity                       = 0;
+
+	concurrent_map_type_entry->concurrent_map_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
+		.trait_id   = TSK_TRAIT_ID_COMPLETE,
+		.trait_data = &tsk_concurrent_map_type_trait_complete,
+	};
+	if (tsk_type_has_trait(key_type, TSK_TRAIT_ID_DROPPABLE) && tsk_type_has_trait(value_type, TSK_TRAIT_ID_DROPPABLE)) {
+		concurrent_map_type_entry->concurrent_map_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
+			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
+			.trait_data = &tsk_concurrent_map_type_trait_droppable,
+		};
+	}
+
+	concurrent_map_type_entry->key_type   = key_type;
+	concurrent_map_type_entry->value_type = value_type;
+	concurrent_map_type_entry->map_type   = map_type;
+
+	(void)snprintf(
+	    concurrent_map_type_entry->concurrent_map_type_name,
+	    sizeof(concurrent_map_type_entry->concurrent_map_type_name),
+	    "TskConcurrentMap<%s, %s>",
+	    tsk_type_name(key_type),
+	    tsk_type_name(value_type)
+	);
+	concurrent_map_type_entry->concurrent_map_type.name = concurrent_map_type_entry->concurrent_map_type_name;
+
+	const TskType *concurrent_map_type                  = &concurrent_map_type_entry->concurrent_map_type;
+
+	(void)tsk_type_layout(concurrent_map_type);
+
+	tsk_type_registry_publish(&tsk_concurrent_map_types_registry, entry);
+
+	assert(tsk_concurrent_map_type_is_valid(concurrent_map_type));
+
+	return concurrent_map_type;
+}
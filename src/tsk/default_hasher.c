@@ -6,15 +6,189 @@
 #include <tsk/trait/droppable.h>
 #include <tsk/trait/hasher.h>
 
+#include <string.h>
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
 typedef struct TskDefaultHasher TskDefaultHasher;
 struct TskDefaultHasher {
 	TskU64 hash;
 };
 
+#define TSK_DEFAULT_HASHER_SECRET_0 0xA0761D6478BD642FULL
+#define TSK_DEFAULT_HASHER_SECRET_1 0xE7037ED1A0B428DBULL
+#define TSK_DEFAULT_HASHER_SECRET_2 0x8EBC6AF09C88C6E3ULL
+#define TSK_DEFAULT_HASHER_SECRET_3 0x589965CC75374CC3ULL
+
+#define TSK_DEFAULT_HASHER_STRIPE_SIZE ((TskUSize)32)
+#define TSK_DEFAULT_HASHER_STRIPES_PER_BLOCK ((TskUSize)16)
+#define TSK_DEFAULT_HASHER_STRIPES_MINIMUM_LENGTH ((TskUSize)256)
+#define TSK_DEFAULT_HASHER_SCRAMBLE_PRIME 0x9E3779B1ULL
+
+static const TskU64 tsk_default_hasher_stripe_keys[4] = {
+	0xBE4BA423396CFEB8ULL,
+	0x1CAD21F72C81017CULL,
+	0xDB979083E96DD4DEULL,
+	0x1F67B3B7A4A44072ULL,
+};
+static const TskU64 tsk_default_hasher_scramble_keys[4] = {
+	0x78E5C0CC4EE679CBULL,
+	0x2172FFCC7DD05A82ULL,
+	0x8E2443F7744608B8ULL,
+	0x4C263A81E69035E0ULL,
+};
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 TskDefaultHasherU128;
+#endif
+
+static inline TskEmpty tsk_default_hasher_multiply(TskU64 *a, TskU64 *b) {
+#if defined(__SIZEOF_INT128__)
+	TskDefaultHasherU128 product = (TskDefaultHasherU128)*a * *b;
+	*a                           = (TskU64)product;
+	*b                           = (TskU64)(product >> 64);
+#else
+	TskU64 a_high    = *a >> 32, a_low = (TskU32)*a, b_high = *b >> 32, b_low = (TskU32)*b;
+	TskU64 high_high = a_high * b_high, high_low = a_high * b_low, low_high = a_low * b_high, low_low = a_low * b_low;
+	TskU64 middle    = (low_low >> 32) + (TskU32)high_low + (TskU32)low_high;
+	*a               = (middle << 32) | (TskU32)low_low;
+	*b               = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+#endif
+}
+static inline TskU64 tsk_default_hasher_mix(TskU64 a, TskU64 b) {
+	tsk_default_hasher_multiply(&a, &b);
+	return a ^ b;
+}
+static inline TskU64 tsk_default_hasher_read_8(const TskU8 *bytes) {
+	TskU64 value = 0;
+	memcpy(&value, bytes, sizeof(value));
+	return value;
+}
+static inline TskU64 tsk_default_hasher_read_4(const TskU8 *bytes) {
+	TskU32 value = 0;
+	memcpy(&value, bytes, sizeof(value));
+	return value;
+}
+static inline TskU64 tsk_default_hasher_read_3(const TskU8 *bytes, TskUSize length) {
+	return ((TskU64)bytes[0] << 16) | ((TskU64)bytes[length >> 1] << 8) | bytes[length - 1];
+}
+
+static inline TskEmpty tsk_default_hasher_accumulate(TskU64 accumulators[4], const TskU8 *bytes, TskUSize stripes) {
+#if defined(__AVX2__)
+	__m256i accumulator = _mm256_loadu_si256((const __m256i *)(const TskAny *)accumulators);
+	__m256i key         = _mm256_loadu_si256((const __m256i *)(const TskAny *)tsk_default_hasher_stripe_keys);
+	for (TskUSize i = 0; i < stripes; i++) {
+		__m256i data     = _mm256_loadu_si256((const __m256i *)(const TskAny *)(bytes + (i * TSK_DEFAULT_HASHER_STRIPE_SIZE)));
+		__m256i data_key = _mm256_xor_si256(data, key);
+		__m256i product  = _mm256_mul_epu32(data_key, _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+		accumulator      = _mm256_add_epi64(accumulator, _mm256_add_epi64(product, _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+	_mm256_storeu_si256((__m256i *)(TskAny *)accumulators, accumulator);
+#else
+	for (TskUSize i = 0; i < stripes; i++) {
+		for (TskUSize j = 0; j < 4; j++) {
+			TskU64 data     = tsk_default_hasher_read_8(bytes + (i * TSK_DEFAULT_HASHER_STRIPE_SIZE) + (j * sizeof(TskU64)));
+			TskU64 data_key = data ^ tsk_default_hasher_stripe_keys[j];
+			accumulators[j ^ 1] += data;
+			accumulators[j] += (data_key & 0xFFFFFFFFULL) * (data_key >> 32);
+		}
+	}
+#endif
+}
+static inline TskEmpty tsk_default_hasher_scramble(TskU64 accumulators[4]) {
+#if defined(__AVX2__)
+	__m256i accumulator = _mm256_loadu_si256((const __m256i *)(const TskAny *)accumulators);
+	__m256i key         = _mm256_loadu_si256((const __m256i *)(const TskAny *)tsk_default_hasher_scramble_keys);
+	__m256i prime       = _mm256_set1_epi32((int)TSK_DEFAULT_HASHER_SCRAMBLE_PRIME);
+	accumulator         = _mm256_xor_si256(_mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47)), key);
+	accumulator         = _mm256_add_epi64(
+      _mm256_mul_epu32(accumulator, prime),
+      _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(accumulator, 32), prime), 32)
+  );
+	_mm256_storeu_si256((__m256i *)(TskAny *)accumulators, accumulator);
+#else
+	for (TskUSize j = 0; j < 4; j++) {
+		accumulators[j] ^= accumulators[j] >> 47;
+		accumulators[j] ^= tsk_default_hasher_scramble_keys[j];
+		accumulators[j] *= TSK_DEFAULT_HASHER_SCRAMBLE_PRIME;
+	}
+#endif
+}
+
+static inline TskU64 tsk_default_hasher_hash_short(const TskU8 *bytes, TskUSize length, TskU64 seed) {
+	seed ^= tsk_default_hasher_mix(seed ^ TSK_DEFAULT_HASHER_SECRET_0, TSK_DEFAULT_HASHER_SECRET_1);
+
+	TskU64 a = 0;
+	TskU64 b = 0;
+	if (length <= 16) {
+		if (length >= 4) {
+			a = (tsk_default_hasher_read_4(bytes) << 32) | tsk_default_hasher_read_4(bytes + ((length >> 3) << 2));
+			b = (tsk_default_hasher_read_4(bytes + length - 4) << 32) | tsk_default_hasher_read_4(bytes + length - 4 - ((length >> 3) << 2));
+		} else if (length > 0) {
+			a = tsk_default_hasher_read_3(bytes, length);
+		}
+	} else {
+		const TskU8 *end       = bytes + length;
+		TskUSize     remaining = length;
+		if (remaining > 48) {
+			TskU64 seed_1 = seed;
+			TskU64 seed_2 = seed;
+			do {
+				seed   = tsk_default_hasher_mix(tsk_default_hasher_read_8(bytes) ^ TSK_DEFAULT_HASHER_SECRET_1, tsk_default_hasher_read_8(bytes + 8) ^ seed);
+				seed_1 = tsk_default_hasher_mix(tsk_default_hasher_read_8(bytes + 16) ^ TSK_DEFAULT_HASHER_SECRET_2, tsk_default_hasher_read_8(bytes + 24) ^ seed_1);
+				seed_2 = tsk_default_hasher_mix(tsk_default_hasher_read_8(bytes + 32) ^ TSK_DEFAULT_HASHER_SECRET_3, tsk_default_hasher_read_8(bytes + 40) ^ seed_2);
+				bytes += 48;
+				remaining -= 48;
+			} while (remaining > 48);
+			seed ^= seed_1 ^ seed_2;
+		}
+		while (remaining > 16) {
+			seed = tsk_default_hasher_mix(tsk_default_hasher_read_8(bytes) ^ TSK_DEFAULT_HASHER_SECRET_1, tsk_default_hasher_read_8(bytes + 8) ^ seed);
+			bytes += 16;
+			remaining -= 16;
+		}
+		a = tsk_default_hasher_read_8(end - 16);
+		b = tsk_default_hasher_read_8(end - 8);
+	}
+
+	a ^= TSK_DEFAULT_HASHER_SECRET_1;
+	b ^= seed;
+	tsk_default_hasher_multiply(&a, &b);
+	return tsk_default_hasher_mix(a ^ TSK_DEFAULT_HASHER_SECRET_0 ^ length, b ^ TSK_DEFAULT_HASHER_SECRET_1);
+}
+static inline TskU64 tsk_default_hasher_hash_long(const TskU8 *bytes, TskUSize length, TskU64 seed) {
+	TskU64 accumulators[4] = {
+		seed ^ TSK_DEFAULT_HASHER_SECRET_0,
+		seed ^ TSK_DEFAULT_HASHER_SECRET_1,
+		seed ^ TSK_DEFAULT_HASHER_SECRET_2,
+		seed ^ TSK_DEFAULT_HASHER_SECRET_3,
+	};
+
+	TskUSize stripes = length / TSK_DEFAULT_HASHER_STRIPE_SIZE;
+	for (TskUSize i = 0; i < stripes; i += TSK_DEFAULT_HASHER_STRIPES_PER_BLOCK) {
+		TskUSize block_stripes = stripes - i < TSK_DEFAULT_HASHER_STRIPES_PER_BLOCK ? stripes - i : TSK_DEFAULT_HASHER_STRIPES_PER_BLOCK;
+		tsk_default_hasher_accumulate(accumulators, bytes + (i * TSK_DEFAULT_HASHER_STRIPE_SIZE), block_stripes);
+		tsk_default_hasher_scramble(accumulators);
+	}
+
+	seed = tsk_default_hasher_mix(accumulators[0] ^ TSK_DEFAULT_HASHER_SECRET_0, accumulators[1] ^ TSK_DEFAULT_HASHER_SECRET_1) ^
+	       tsk_default_hasher_mix(accumulators[2] ^ TSK_DEFAULT_HASHER_SECRET_2, accumulators[3] ^ TSK_DEFAULT_HASHER_SECRET_3) ^
+	       length;
+
+	return tsk_default_hasher_hash_short(
+	    bytes + (stripes * TSK_DEFAULT_HASHER_STRIPE_SIZE),
+	    length - (stripes * TSK_DEFAULT_HASHER_STRIPE_SIZE),
+	    seed
+	);
+}
+
 TskEmpty tsk_default_hasher_combine(TskDefaultHasher *hasher, const TskU8 *bytes, TskUSize length) {
-	for (TskUSize i = 0; i < length; i++) {
-		hasher->hash ^= bytes[i];
-		hasher->hash *= 1099511628211ULL;
+	if (length >= TSK_DEFAULT_HASHER_STRIPES_MINIMUM_LENGTH) {
+		hasher->hash = tsk_default_hasher_hash_long(bytes, length, hasher->hash);
+	} else {
+		hasher->hash = tsk_default_hasher_hash_short(bytes, length, hasher->hash);
 	}
 }
 TskU64 tsk_default_hasher_finalize(const TskDefaultHasher *hasher) {
@@ -59,7 +233,7 @@ const TskType *tsk_default_hasher_builder_built_type(TskEmpty) {
 }
 TskEmpty tsk_default_hasher_builder_build(const TskDefaultHasherBuilder *hasher_builder, TskDefaultHasher *hasher) {
 	(TskEmpty) hasher_builder;
-	hasher->hash = 14695981039346656037ULL;
+	hasher->hash = 0;
 }
 
 const TskDefaultHasherBuilder tsk_default_hasher_builder_;
@@ -12,6 +12,7 @@
 #include <tsk/trait/hasher.h>
 #include <tsk/trait/iterable.h>
 #include <tsk/trait/iterator.h>
+#include <tsk/type_registry.h>
 
 #include <assert.h>
 #include <stdalign.h>
@@ -31,10 +32,22 @@ struct TskDequeType {
 	TskType                deque_type;
 	TskCharacter           deque_type_name[40];
 	TskTypeTraitTable      deque_type_trait_table;
-	TskTypeTraitTableEntry deque_type_trait_table_entries[16];
+	TskTypeTraitTableEntry deque_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          deque_type_layout;
 	const TskType         *element_type;
 };
 
+static inline TskEmpty tsk_deque_shrink_automatically(const TskType *deque_type, TskDeque *deque) {
+	assert(tsk_deque_type_is_valid(deque_type));
+	assert(tsk_deque_is_valid(deque_type, deque));
+
+	if (!deque->automatic_shrink || tsk_deque_length(deque_type, deque) >= tsk_deque_capacity(deque_type, deque) / 4) {
+		return;
+	}
+
+	(void)tsk_deque_shrink_to(deque_type, deque, tsk_deque_length(deque_type, deque) * 2);
+}
+
 TskBoolean tsk_deque_is_valid(const TskType *deque_type, const TskDeque *deque) {
 	assert(tsk_deque_type_is_valid(deque_type));
 
@@ -46,10 +59,11 @@ TskDeque tsk_deque_new(const TskType *deque_type) {
 	assert(tsk_deque_type_is_valid(deque_type));
 
 	TskDeque deque = {
-		.segments        = TSK_NULL,
-		.segments_length = 0,
-		.front_index     = 0,
-		.back_index      = 0,
+		.segments         = TSK_NULL,
+		.segments_length  = 0,
+		.front_index      = 0,
+		.back_index       = 0,
+		.automatic_shrink = TSK_FALSE,
 	};
 
 	assert(tsk_deque_is_valid(deque_type, &deque));
@@ -76,7 +90,8 @@ TskBoolean tsk_deque_clone(const TskType *deque_type, const TskDeque *deque_1, T
 	assert(deque_2 != TSK_NULL);
 
 	if (tsk_deque_is_empty(deque_type, deque_1)) {
-		*deque_2 = tsk_deque_new(deque_type);
+		*deque_2                  = tsk_deque_new(deque_type);
+		deque_2->automatic_shrink = deque_1->automatic_shrink;
 		return TSK_TRUE;
 	}
 
@@ -109,10 +124,11 @@ TskBoolean tsk_deque_clone(const TskType *deque_type, const TskDeque *deque_1, T
 		}
 	}
 
-	deque_2->segments        = segments;
-	deque_2->segments_length = segments_length;
-	deque_2->front_index     = 0;
-	deque_2->back_index      = tsk_deque_length(deque_type, deque_1);
+	deque_2->segments         = segments;
+	deque_2->segments_length  = segments_length;
+	deque_2->front_index      = 0;
+	deque_2->back_index       = tsk_deque_length(deque_type, deque_1);
+	deque_2->automatic_shrink = deque_1->automatic_shrink;
 
 	return TSK_FALSE;
 cleanup:
@@ -145,6 +161,20 @@ TskUSize tsk_deque_capacity(const TskType *deque_type, const TskDeque *deque) {
 
 	return deque->segments_length * TSK_DEQUE_SEGMENT_SIZE;
 }
+TskBoolean tsk_deque_automatic_shrink(const TskType *deque_type, const TskDeque *deque) {
+	assert(tsk_deque_type_is_valid(deque_type));
+	assert(tsk_deque_is_valid(deque_type, deque));
+
+	return deque->automatic_shrink;
+}
+TskEmpty tsk_deque_set_automatic_shrink(const TskType *deque_type, TskDeque *deque, TskBoolean automatic_shrink) {
+	assert(tsk_deque_type_is_valid(deque_type));
+	assert(tsk_deque_is_valid(deque_type, deque));
+
+	deque->automatic_shrink = automatic_shrink;
+
+	tsk_deque_shrink_automatically(deque_type, deque);
+}
 TskAny *tsk_deque_get(const TskType *deque_type, TskDeque *deque, TskUSize index) {
 	assert(tsk_deque_type_is_valid(deque_type));
 	assert(tsk_deque_is_valid(deque_type, deque));
@@ -204,14 +234,72 @@ TskEmpty tsk_deque_clear(const TskType *deque_type, TskDeque *deque) {
 	assert(tsk_deque_is_valid(deque_type, deque));
 	assert(tsk_type_has_trait(tsk_deque_element_type(deque_type), TSK_TRAIT_ID_DROPPABLE));
 
-	for (TskUSize i = 0; i < tsk_deque_length(deque_type, deque); i++) {
-		tsk_trait_droppable_drop(
-		    tsk_deque_element_type(deque_type),
-		    tsk_deque_get(deque_type, deque, i)
-		);
+	if (!tsk_type_layout(tsk_deque_element_type(deque_type))->is_trivially_droppable) {
+		for (TskUSize i = 0; i < tsk_deque_length(deque_type, deque); i++) {
+			tsk_trait_droppable_drop(
+			    tsk_deque_element_type(deque_type),
+			    tsk_deque_get(deque_type, deque, i)
+			);
+		}
 	}
 
 	deque->front_index = deque->back_index = 0;
+
+	tsk_deque_shrink_automatically(deque_type, deque);
+}
+TskBoolean tsk_deque_shrink_to_fit(const TskType *deque_type, TskDeque *deque) {
+	assert(tsk_deque_type_is_valid(deque_type));
+	assert(tsk_deque_is_valid(deque_type, deque));
+
+	return tsk_deque_shrink_to(deque_type, deque, 0);
+}
+TskBoolean tsk_deque_shrink_to(const TskType *deque_type, TskDeque *deque, TskUSize capacity) {
+	assert(tsk_deque_type_is_valid(deque_type));
+	assert(tsk_deque_is_valid(deque_type, deque));
+
+	if (tsk_deque_is_empty(deque_type, deque)) {
+		deque->front_index = deque->back_index = 0;
+	}
+
+	TskUSize first_segment   = deque->front_index / TSK_DEQUE_SEGMENT_SIZE;
+	TskUSize last_segment    = (deque->back_index + TSK_DEQUE_SEGMENT_SIZE - 1) / TSK_DEQUE_SEGMENT_SIZE;
+
+	TskUSize segments_length = (capacity + TSK_DEQUE_SEGMENT_SIZE - 1) / TSK_DEQUE_SEGMENT_SIZE;
+	if (segments_length < last_segment - first_segment) {
+		segments_length = last_segment - first_segment;
+	}
+
+	if (segments_length >= deque->segments_length) {
+		return TSK_TRUE;
+	}
+
+	if (first_segment > deque->segments_length - segments_length) {
+		first_segment = deque->segments_length - segments_length;
+	}
+
+	for (TskUSize i = 0; i < deque->segments_length; i++) {
+		if (i < first_segment || i >= first_segment + segments_length) {
+			free(deque->segments[i]);
+		}
+	}
+
+	if (segments_length == 0) {
+		free(deque->segments);
+		deque->segments = TSK_NULL;
+	} else {
+		memmove(deque->segments, deque->segments + first_segment, segments_length * sizeof(*deque->segments));
+
+		TskAny **segments = realloc(deque->segments, segments_length * sizeof(*segments));
+		if (segments != TSK_NULL) {
+			deque->segments = segments;
+		}
+	}
+
+	deque->segments_length = segments_length;
+	deque->front_index -= first_segment * TSK_DEQUE_SEGMENT_SIZE;
+	deque->back_index -= first_segment * TSK_DEQUE_SEGMENT_SIZE;
+
+	return TSK_TRUE;
 }
 TskBoolean tsk_deque_push_front(const TskType *deque_type, TskDeque *deque, TskAny *element) {
 	assert(tsk_deque_type_is_valid(deque_type));
@@ -280,13 +368,41 @@ TskBoolean tsk_deque_push_back(const TskType *deque_type, TskDeque *deque, TskAn
 		deque->segments_length++;
 	}
 
+	deque->back_index++;
+
 	memcpy(
 	    tsk_deque_back(deque_type, deque),
 	    element,
 	    tsk_trait_complete_size(tsk_deque_element_type(deque_type))
 	);
 
-	deque->back_index++;
+	return TSK_TRUE;
+}
+TskBoolean tsk_deque_pop_front(const TskType *deque_type, TskDeque *deque, TskAny *element) {
+	assert(tsk_deque_type_is_valid(deque_type));
+	assert(tsk_deque_is_valid(deque_type, deque));
+
+	if (tsk_deque_is_empty(deque_type, deque)) {
+		return TSK_FALSE;
+	}
+
+	if (element != TSK_NULL) {
+		memcpy(
+		    element,
+		    tsk_deque_get_const(deque_type, deque, 0),
+		    tsk_trait_complete_size(tsk_deque_element_type(deque_type))
+		);
+	} else {
+		assert(tsk_type_has_trait(tsk_deque_element_type(deque_type), TSK_TRAIT_ID_DROPPABLE));
+		tsk_trait_droppable_drop(
+		    tsk_deque_element_type(deque_type),
+		    tsk_deque_get(deque_type, deque, 0)
+		);
+	}
+
+	deque->front_index++;
+
+	tsk_deque_shrink_automatically(deque_type, deque);
 
 	return TSK_TRUE;
 }
@@ -314,6 +430,8 @@ TskBoolean tsk_deque_pop_back(const TskType *deque_type, TskDeque *deque, TskAny
 
 	deque->back_index--;
 
+	tsk_deque_shrink_automatically(deque_type, deque);
+
 	return TSK_TRUE;
 }
 TskOrdering tsk_deque_compare(const TskType *deque_type, const TskDeque *deque_1, const TskDeque *deque_2) {
@@ -417,13 +535,16 @@ const TskTraitHashable tsk_deque_type_trait_hashable = {
 	.hash = tsk_deque_type_trait_hashable_hash,
 };
 
-#define TSK_DEQUE_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_deque_types_registry = TSK_TYPE_REGISTRY(sizeof(TskDequeType));
 
-TskDequeType tsk_deque_types[TSK_DEQUE_TYPES_CAPACITY];
+static inline TskBoolean tsk_deque_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskDequeType *deque_type_entry = entry;
+	return deque_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_deque_type_is_valid(const TskType *deque_type) {
 	return tsk_type_is_valid(deque_type) &&
-	       &tsk_deque_types[0] <= (const TskDequeType *)deque_type && (const TskDequeType *)deque_type < &tsk_deque_types[TSK_DEQUE_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_deque_types_registry, deque_type);
 }
 const TskType *tsk_deque_type(const TskType *element_type) {
 	assert(tsk_type_is_valid(element_type));
@@ -438,68 +559,70 @@ const TskType *tsk_deque_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_DEQUE_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_deque_types[index].element_type != TSK_NULL) {
-		if (tsk_deque_types[index].element_type == element_type) {
-			return &tsk_deque_types[index].deque_type;
-		}
-		index = (index + 1) & (TSK_DEQUE_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_deque_types_registry, hash, tsk_deque_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskDequeType *)entry)->deque_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_deque_types[index].deque_type.trait_table                                                                                               = &tsk_deque_types[index].deque_type_trait_table;
-	tsk_deque_types[index].deque_type_trait_table.entries                                                                                       = tsk_deque_types[index].deque_type_trait_table_entries;
-	tsk_deque_types[index].deque_type_trait_table.capacity                                                                                      = sizeof(tsk_deque_types[index].deque_type_trait_table_entries) / sizeof(tsk_deque_types[index].deque_type_trait_table_entries[0]);
+	TskDequeType *deque_type_entry                                          = entry;
+
+	deque_type_entry->deque_type.trait_table                                = &deque_type_entry->deque_type_trait_table;
+	deque_type_entry->deque_type.layout                                     = &deque_type_entry->deque_type_layout;
+	deque_type_entry->deque_type_trait_table.entries                        = deque_type_entry->deque_type_trait_table_entries;
+	deque_type_entry->deque_type_trait_table.capacity                       = 0;
 
-	tsk_deque_types[index].deque_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE & (tsk_deque_types[index].deque_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	deque_type_entry->deque_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_COMPLETE,
 		.trait_data = &tsk_deque_type_trait_complete,
 	};
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_DROPPABLE)) {
-		tsk_deque_types[index].deque_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE & (tsk_deque_types[index].deque_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		deque_type_entry->deque_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
 			.trait_data = &tsk_deque_type_trait_droppable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_CLONABLE)) {
-		tsk_deque_types[index].deque_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE & (tsk_deque_types[index].deque_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		deque_type_entry->deque_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_CLONABLE,
 			.trait_data = &tsk_deque_type_trait_clonable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPARABLE)) {
-		tsk_deque_types[index].deque_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE & (tsk_deque_types[index].deque_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		deque_type_entry->deque_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_COMPARABLE,
 			.trait_data = &tsk_deque_type_trait_comparable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE)) {
-		tsk_deque_types[index].deque_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE & (tsk_deque_types[index].deque_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		deque_type_entry->deque_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_EQUATABLE,
 			.trait_data = &tsk_deque_type_trait_equatable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE)) {
-		tsk_deque_types[index].deque_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE & (tsk_deque_types[index].deque_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		deque_type_entry->deque_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_HASHABLE,
 			.trait_data = &tsk_deque_type_trait_hashable,
 		};
 	}
 
-	tsk_deque_types[index].element_type = element_type;
+	deque_type_entry->element_type = element_type;
 
 	(void)snprintf(
-	    tsk_deque_types[index].deque_type_name,
-	    sizeof(tsk_deque_types[index].deque_type_name),
+	    deque_type_entry->deque_type_name,
+	    sizeof(deque_type_entry->deque_type_name),
 	    "TskDeque<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_deque_types[index].deque_type.name = tsk_deque_types[index].deque_type_name;
+	deque_type_entry->deque_type.name = deque_type_entry->deque_type_name;
+
+	const TskType *deque_type         = &deque_type_entry->deque_type;
+
+	(void)tsk_type_layout(deque_type);
 
-	const TskType *deque_type              = &tsk_deque_types[index].deque_type;
+	tsk_type_registry_publish(&tsk_deque_types_registry, entry);
 
 	assert(tsk_deque_type_is_valid(deque_type));
 
@@ -12,6 +12,7 @@
 #include <tsk/trait/hasher.h>
 #include <tsk/trait/iterable.h>
 #include <tsk/trait/iterator.h>
+#include <tsk/type_registry.h>
 
 #include <assert.h>
 #include <stdalign.h>
@@ -24,7 +25,8 @@ struct TskListType {
 	TskType                list_type;
 	TskCharacter           list_type_name[40];
 	TskTypeTraitTable      list_type_trait_table;
-	TskTypeTraitTableEntry list_type_trait_table_entries[16];
+	TskTypeTraitTableEntry list_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          list_type_layout;
 	const TskType         *element_type;
 };
 
@@ -470,13 +472,16 @@ const TskTraitIterableConst tsk_list_type_trait_iterable_const = {
 	.iterator      = tsk_list_type_trait_iterable_const_iterator,
 };
 
-#define TSK_LIST_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_list_types_registry = TSK_TYPE_REGISTRY(sizeof(TskListType));
 
-TskListType tsk_list_types[TSK_LIST_TYPES_CAPACITY];
+static inline TskBoolean tsk_list_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskListType *list_type_entry = entry;
+	return list_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_list_type_is_valid(const TskType *list_type) {
 	return tsk_type_is_valid(list_type) &&
-	       &tsk_list_types[0] <= (const TskListType *)list_type && (const TskListType *)list_type < &tsk_list_types[TSK_LIST_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_list_types_registry, list_type);
 }
 const TskType *tsk_list_type(const TskType *element_type) {
 	assert(tsk_type_is_valid(element_type));
@@ -491,76 +496,78 @@ const TskType *tsk_list_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_LIST_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_list_types[index].element_type != TSK_NULL) {
-		if (tsk_list_types[index].element_type == element_type) {
-			return &tsk_list_types[index].list_type;
-		}
-		index = (index + 1) & (TSK_LIST_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_list_types_registry, hash, tsk_list_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskListType *)entry)->list_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_list_types[index].list_type.trait_table                                                                                             = &tsk_list_types[index].list_type_trait_table;
-	tsk_list_types[index].list_type_trait_table.entries                                                                                     = tsk_list_types[index].list_type_trait_table_entries;
-	tsk_list_types[index].list_type_trait_table.capacity                                                                                    = sizeof(tsk_list_types[index].list_type_trait_table_entries) / sizeof(tsk_list_types[index].list_type_trait_table_entries[0]);
+	TskListType *list_type_entry                                          = entry;
+
+	list_type_entry->list_type.trait_table                                = &list_type_entry->list_type_trait_table;
+	list_type_entry->list_type.layout                                     = &list_type_entry->list_type_layout;
+	list_type_entry->list_type_trait_table.entries                        = list_type_entry->list_type_trait_table_entries;
+	list_type_entry->list_type_trait_table.capacity                       = 0;
 
-	tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_COMPLETE,
 		.trait_data = &tsk_list_type_trait_complete,
 	};
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_DROPPABLE)) {
-		tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
 			.trait_data = &tsk_list_type_trait_droppable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_CLONABLE)) {
-		tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_CLONABLE,
 			.trait_data = &tsk_list_type_trait_clonable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPARABLE)) {
-		tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_COMPARABLE,
 			.trait_data = &tsk_list_type_trait_comparable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE)) {
-		tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_EQUATABLE,
 			.trait_data = &tsk_list_type_trait_equatable,
 		};
 	}
 	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE)) {
-		tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_HASHABLE,
 			.trait_data = &tsk_list_type_trait_hashable,
 		};
 	}
-	tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_ITERABLE,
 		.trait_data = &tsk_list_type_trait_iterable,
 	};
-	tsk_list_types[index].list_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE_CONST & (tsk_list_types[index].list_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	list_type_entry->list_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE_CONST] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_ITERABLE_CONST,
 		.trait_data = &tsk_list_type_trait_iterable_const,
 	};
 
-	tsk_list_types[index].element_type = element_type;
+	list_type_entry->element_type = element_type;
 
 	(void)snprintf(
-	    tsk_list_types[index].list_type_name,
-	    sizeof(tsk_list_types[index].list_type_name),
+	    list_type_entry->list_type_name,
+	    sizeof(list_type_entry->list_type_name),
 	    "TskList<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_list_types[index].list_type.name = tsk_list_types[index].list_type_name;
+	list_type_entry->list_type.name = list_type_entry->list_type_name;
 
-	const TskType *list_type             = &tsk_list_types[index].list_type;
+	const TskType *list_type        = &list_type_entry->list_type;
+
+	(void)tsk_type_layout(list_type);
+
+	tsk_type_registry_publish(&tsk_list_types_registry, entry);
 
 	assert(tsk_list_type_is_valid(list_type));
 
@@ -637,13 +644,16 @@ TSK_TYPE(tsk_list_iterator_type_, TskListIterator,
 );
 // clang-format on
 
-#define TSK_LIST_ITERATOR_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_list_iterator_types_registry = TSK_TYPE_REGISTRY(sizeof(TskListIteratorType));
 
-TskListIteratorType tsk_list_iterator_types[TSK_LIST_ITERATOR_TYPES_CAPACITY];
+static inline TskBoolean tsk_list_iterator_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskListIteratorType *list_iterator_type_entry = entry;
+	return list_iterator_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_list_iterator_type_is_valid(const TskType *list_iterator_type) {
 	return tsk_type_is_valid(list_iterator_type) &&
-	       &tsk_list_iterator_types[0] <= (const TskListIteratorType *)list_iterator_type && (const TskListIteratorType *)list_iterator_type < &tsk_list_iterator_types[TSK_LIST_ITERATOR_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_list_iterator_types_registry, list_iterator_type);
 }
 const TskType *tsk_list_iterator_type(const TskType *element_type) {
 	assert(tsk_type_is_valid(element_type));
@@ -658,30 +668,29 @@ const TskType *tsk_list_iterator_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_LIST_ITERATOR_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_list_iterator_types[index].element_type != TSK_NULL) {
-		if (tsk_list_iterator_types[index].element_type == element_type) {
-			return &tsk_list_iterator_types[index].list_iterator_type;
-		}
-		index = (index + 1) & (TSK_LIST_ITERATOR_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_list_iterator_types_registry, hash, tsk_list_iterator_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskListIteratorType *)entry)->list_iterator_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_list_iterator_types[index].list_iterator_type = *tsk_list_iterator_type_;
-	tsk_list_iterator_types[index].element_type       = element_type;
+	TskListIteratorType *list_iterator_type_entry = entry;
+
+	list_iterator_type_entry->list_iterator_type  = *tsk_list_iterator_type_;
+	list_iterator_type_entry->element_type        = element_type;
 
 	(void)snprintf(
-	    tsk_list_iterator_types[index].list_iterator_type_name,
-	    sizeof(tsk_list_iterator_types[index].list_iterator_type_name),
+	    list_iterator_type_entry->list_iterator_type_name,
+	    sizeof(list_iterator_type_entry->list_iterator_type_name),
 	    "TskListIterator<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_list_iterator_types[index].list_iterator_type.name = tsk_list_iterator_types[index].list_iterator_type_name;
+	list_iterator_type_entry->list_iterator_type.name = list_iterator_type_entry->list_iterator_type_name;
 
-	const TskType *list_iterator_type                      = &tsk_list_iterator_types[index].list_iterator_type;
+	const TskType *list_iterator_type                 = &list_iterator_type_entry->list_iterator_type;
+
+	tsk_type_registry_publish(&tsk_list_iterator_types_registry, entry);
 
 	assert(tsk_list_iterator_type_is_valid(list_iterator_type));
 
@@ -772,13 +781,16 @@ TSK_TYPE(tsk_list_iterator_const_type_, TskListIteratorConst,
 );
 // clang-format on
 
-#define TSK_LIST_ITERATOR_CONST_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_list_iterator_const_types_registry = TSK_TYPE_REGISTRY(sizeof(TskListIteratorConstType));
 
-TskListIteratorConstType tsk_list_iterator_const_types[TSK_LIST_ITERATOR_CONST_TYPES_CAPACITY];
+static inline TskBoolean tsk_list_iterator_const_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskListIteratorConstType *list_iterator_const_type_entry = entry;
+	return list_iterator_const_type_entry->element_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_list_iterator_const_type_is_valid(const TskType *list_iterator_type) {
 	return tsk_type_is_valid(list_iterator_type) &&
-	       &tsk_list_iterator_const_types[0] <= (const TskListIteratorConstType *)list_iterator_type && (const TskListIteratorConstType *)list_iterator_type < &tsk_list_iterator_const_types[TSK_LIST_ITERATOR_CONST_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_list_iterator_const_types_registry, list_iterator_type);
 }
 const TskType *tsk_list_iterator_const_type(const TskType *element_type) {
 	assert(tsk_list_type_is_valid(element_type));
@@ -793,30 +805,29 @@ const TskType *tsk_list_iterator_const_type(const TskType *element_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_LIST_ITERATOR_CONST_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_list_iterator_const_types[index].element_type != TSK_NULL) {
-		if (tsk_list_iterator_const_types[index].element_type == element_type) {
-			return &tsk_list_iterator_const_types[index].list_iterator_const_type;
-		}
-		index = (index + 1) & (TSK_LIST_ITERATOR_CONST_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_list_iterator_const_types_registry, hash, tsk_list_iterator_const_types_equals, &element_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskListIteratorConstType *)entry)->list_iterator_const_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_list_iterator_const_types[index].list_iterator_const_type = *tsk_list_iterator_const_type_;
-	tsk_list_iterator_const_types[index].element_type             = element_type;
+	TskListIteratorConstType *list_iterator_const_type_entry = entry;
+
+	list_iterator_const_type_entry->list_iterator_const_type = *tsk_list_iterator_const_type_;
+	list_iterator_const_type_entry->element_type             = element_type;
 
 	(void)snprintf(
-	    tsk_list_iterator_const_types[index].list_iterator_const_type_name,
-	    sizeof(tsk_list_iterator_const_types[index].list_iterator_const_type_name),
+	    list_iterator_const_type_entry->list_iterator_const_type_name,
+	    sizeof(list_iterator_const_type_entry->list_iterator_const_type_name),
 	    "TskListIteratorConst<%s>",
 	    tsk_type_name(element_type)
 	);
-	tsk_list_iterator_const_types[index].list_iterator_const_type.name = tsk_list_iterator_const_types[index].list_iterator_const_type_name;
+	list_iterator_const_type_entry->list_iterator_const_type.name = list_iterator_const_type_entry->list_iterator_const_type_name;
+
+	const TskType *list_iterator_const_type                       = &list_iterator_const_type_entry->list_iterator_const_type;
 
-	const TskType *list_iterator_const_type                            = &tsk_list_iterator_const_types[index].list_iterator_const_type;
+	tsk_type_registry_publish(&tsk_list_iterator_const_types_registry, entry);
 
 	assert(tsk_list_iterator_const_type_is_valid(list_iterator_const_type));
 
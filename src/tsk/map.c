@@ -1,6 +1,10 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <tsk/map.h>
 
+#include <tsk/array.h>
 #include <tsk/default_hasher.h>
+#include <tsk/internal/map_hash.h>
 #include <tsk/reference.h>
 #include <tsk/trait/builder.h>
 #include <tsk/trait/clonable.h>
@@ -12,583 +16,2655 @@
 #include <tsk/trait/hasher.h>
 #include <tsk/trait/iterable.h>
 #include <tsk/trait/iterator.h>
+#include <tsk/type_registry.h>
 
 #include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+
 typedef struct TskMapType TskMapType;
 struct TskMapType {
-	TskType                map_type;
-	TskCharacter           map_type_name[40];
-	TskTypeTraitTable      map_type_trait_table;
-	TskTypeTraitTableEntry map_type_trait_table_entries[16];
-	const TskType         *key_type;
-	const TskType         *value_type;
+	TskType                 map_type;
+	TskCharacter            map_type_name[64];
+	TskTypeTraitTable       map_type_trait_table;
+	TskTypeTraitTableEntry  map_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout           map_type_layout;
+	const TskType          *key_type;
+	const TskType          *value_type;
+	TskMapEngine            engine;
+	TskMapLayout            layout;
+	const TskTraitHashable *key_hashable_trait;
+	const TskTypeLayout    *key_layout;
+	TskUSize                key_stride;
+	TskUSize                value_offset;
+	TskUSize                value_stride;
+	TskMapHasher            default_hasher;
 };
 
-typedef enum TskMapEntryState {
-	TSK_MAP_ENTRY_STATE_EMPTY,
-	TSK_MAP_ENTRY_STATE_OCCUPIED,
-	TSK_MAP_ENTRY_STATE_DELETED,
-} TskMapEntryState;
+typedef struct TskMapTypeKey TskMapTypeKey;
+struct TskMapTypeKey {
+	const TskType *key_type;
+	const TskType *value_type;
+	TskMapEngine   engine;
+	TskMapLayout   layout;
+};
 
-struct TskMapEntry {
-	TskU64           hash;
-	TskMapEntryState state;
+typedef struct TskMapParallelTask TskMapParallelTask;
+struct TskMapParallelTask {
+	const TskType *map_type;
+	TskMap        *map;
+	const TskMap  *source;
+	const TskType *items_type;
+	TskArrayView   items;
+	TskU64        *hashes;
+	TskUSize      *order;
+	TskUSize      *counts;
+	TskUSize       region_length;
+	TskUSize       start;
+	TskUSize       end;
+	TskUSize       items_start;
+	TskUSize       items_end;
+	TskUSize       length;
+	TskUSize       deleted;
+	TskUSize       deferred;
+	TskBoolean     unique;
+	TskBoolean     failed;
 };
 
+#define TSK_MAP_FIND_MANY_BATCH_LENGTH ((TskUSize)16)
+
+#define TSK_MAP_MIGRATE_LENGTH ((TskUSize)4)
+
+#define TSK_MAP_PARALLEL_MAXIMUM_THREADS ((TskUSize)64)
+#define TSK_MAP_PARALLEL_MINIMUM_REGION_LENGTH ((TskUSize)4096)
+
+#define TSK_MAP_CONTROL_EMPTY ((TskU8)0x80)
+#define TSK_MAP_CONTROL_DELETED ((TskU8)0xFE)
+#define TSK_MAP_CONTROL_SENTINEL ((TskU8)0xFF)
+
+#define TSK_MAP_GROUP_WIDTH ((TskUSize)16)
+
+#define TSK_MAP_ROBIN_HOOD_MAXIMUM_CONTROL ((TskU8)0x7F)
+
+#define TSK_MAP_LOAD_FACTOR_ONE ((TskU32)1 << 16)
+#define TSK_MAP_DEFAULT_MAXIMUM_LOAD_FACTOR (TSK_MAP_LOAD_FACTOR_ONE / 8 * 7)
+
+#define TSK_MAP_SHRINK_MINIMUM_CAPACITY TSK_MAP_GROUP_WIDTH
+
+#define TSK_MAP_INTERLEAVED_MAXIMUM_KEY_SIZE ((TskUSize)8)
+#define TSK_MAP_INTERLEAVED_MAXIMUM_VALUE_SIZE ((TskUSize)16)
+
+static inline TskBoolean tsk_map_control_is_full(TskU8 control) {
+	return (control & 0x80) == 0;
+}
+static inline TskU64 tsk_map_hash_h1(TskU64 hash) {
+	return hash >> 7;
+}
+static inline TskU8 tsk_map_hash_h2(TskU64 hash) {
+	return (TskU8)(hash & 0x7F);
+}
+
+#if defined(__SSE2__)
+static inline TskU32 tsk_map_group_match(const TskU8 *group, TskU8 control) {
+	__m128i controls = _mm_loadu_si128((const __m128i *)(const TskAny *)group);
+	return (TskU32)_mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8((char)control)));
+}
+static inline TskU32 tsk_map_group_match_empty_or_deleted(const TskU8 *group) {
+	__m128i controls = _mm_loadu_si128((const __m128i *)(const TskAny *)group);
+	return (TskU32)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8((char)TSK_MAP_CONTROL_SENTINEL), controls));
+}
+static inline TskU32 tsk_map_group_match_full(const TskU8 *group) {
+	__m128i controls = _mm_loadu_si128((const __m128i *)(const TskAny *)group);
+	return ~(TskU32)_mm_movemask_epi8(controls) & 0xFFFF;
+}
+#else
+static inline TskU64 tsk_map_group_load_word(const TskU8 *bytes) {
+	TskU64 word = 0;
+	for (TskUSize i = 0; i < 8; i++) {
+		word |= (TskU64)bytes[i] << (i * 8);
+	}
+	return word;
+}
+static inline TskU32 tsk_map_group_word_mask(TskU64 word) {
+	return (TskU32)((((word >> 7) & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56);
+}
+static inline TskU32 tsk_map_group_match(const TskU8 *group, TskU8 control) {
+	TskU32 mask = 0;
+	for (TskUSize i = 0; i < TSK_MAP_GROUP_WIDTH; i += 8) {
+		TskU64 word = tsk_map_group_load_word(group + i) ^ (0x0101010101010101ULL * control);
+		word        = ~(((word & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) | word | 0x7F7F7F7F7F7F7F7FULL);
+		mask |= tsk_map_group_word_mask(word) << i;
+	}
+	return mask;
+}
+static inline TskU32 tsk_map_group_match_empty_or_deleted(const TskU8 *group) {
+	TskU32 mask = 0;
+	for (TskUSize i = 0; i < TSK_MAP_GROUP_WIDTH; i += 8) {
+		TskU64 word = tsk_map_group_load_word(group + i);
+		mask |= tsk_map_group_word_mask(word & ~(word << 7)) << i;
+	}
+	return mask;
+}
+static inline TskU32 tsk_map_group_match_full(const TskU8 *group) {
+	TskU32 mask = 0;
+	for (TskUSize i = 0; i < TSK_MAP_GROUP_WIDTH; i += 8) {
+		mask |= tsk_map_group_word_mask(~tsk_map_group_load_word(group + i)) << i;
+	}
+	return mask;
+}
+#endif
+static inline TskU32 tsk_map_group_match_empty(const TskU8 *group) {
+	return tsk_map_group_match(group, TSK_MAP_CONTROL_EMPTY);
+}
+static inline TskUSize tsk_map_mask_first(TskU32 mask) {
+	assert(mask != 0);
+
+#if defined(__GNUC__)
+	return (TskUSize)__builtin_ctz(mask);
+#else
+	TskUSize index = 0;
+	while ((mask & 1) == 0) {
+		mask >>= 1;
+		index++;
+	}
+	return index;
+#endif
+}
+
+static inline TskUSize tsk_map_groups_length(TskUSize capacity) {
+	return (capacity + TSK_MAP_GROUP_WIDTH - 1) / TSK_MAP_GROUP_WIDTH;
+}
+static inline TskEmpty tsk_map_controls_initialize(TskU8 *controls, TskUSize capacity) {
+	assert(controls != TSK_NULL);
+	assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+
+	memset(controls, TSK_MAP_CONTROL_EMPTY, capacity);
+	memset(controls + capacity, TSK_MAP_CONTROL_SENTINEL, (tsk_map_groups_length(capacity) * TSK_MAP_GROUP_WIDTH) - capacity);
+}
+static inline TskU8 *tsk_map_controls_new(TskUSize capacity) {
+	assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+
+	TskU8 *controls = malloc(tsk_map_groups_length(capacity) * TSK_MAP_GROUP_WIDTH);
+	if (controls == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	tsk_map_controls_initialize(controls, capacity);
+
+	return controls;
+}
+
 static inline TskAny *tsk_map_get_key(const TskType *map_type, TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
 	assert(index < tsk_map_capacity(map_type, map));
 
-	return (TskU8 *)map->keys + (index * tsk_trait_complete_size(tsk_map_key_type(map_type)));
+	return (TskU8 *)map->keys + (index * ((const TskMapType *)map_type)->key_stride);
 }
 static inline const TskAny *tsk_map_get_key_const(const TskType *map_type, const TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
 	assert(index < tsk_map_capacity(map_type, map));
 
-	return (const TskU8 *)map->keys + (index * tsk_trait_complete_size(tsk_map_key_type(map_type)));
+	return (const TskU8 *)map->keys + (index * ((const TskMapType *)map_type)->key_stride);
 }
 static inline TskAny *tsk_map_get_value(const TskType *map_type, TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
 	assert(index < tsk_map_capacity(map_type, map));
 
-	return (TskU8 *)map->values + (index * tsk_trait_complete_size(tsk_map_value_type(map_type)));
+	return (TskU8 *)map->values + (index * ((const TskMapType *)map_type)->value_stride);
 }
 static inline const TskAny *tsk_map_get_value_const(const TskType *map_type, const TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
 	assert(index < tsk_map_capacity(map_type, map));
 
-	return (const TskU8 *)map->values + (index * tsk_trait_complete_size(tsk_map_value_type(map_type)));
+	return (const TskU8 *)map->values + (index * ((const TskMapType *)map_type)->value_stride);
 }
-static inline TskU64 tsk_map_hash_key(const TskType *map_type, const TskMap *map, const TskAny *key) {
+static inline TskMapHasher tsk_map_hasher_new(const TskType *hasher_builder_type) {
+	assert(tsk_type_is_valid(hasher_builder_type));
+	assert(tsk_type_has_trait(hasher_builder_type, TSK_TRAIT_ID_BUILDER));
+
+	const TskType *hasher_type = tsk_trait_builder_built_type(hasher_builder_type);
+
+	return (TskMapHasher){
+		.builder_type    = hasher_builder_type,
+		.builder_trait   = tsk_type_trait(hasher_builder_type, TSK_TRAIT_ID_BUILDER),
+		.type            = hasher_type,
+		.size            = tsk_trait_complete_size(hasher_type),
+		.hasher_trait    = tsk_type_trait(hasher_type, TSK_TRAIT_ID_HASHER),
+		.droppable_trait = tsk_type_trait(hasher_type, TSK_TRAIT_ID_DROPPABLE),
+	};
+}
+static inline TskU64 tsk_map_hash_hashable(const TskType *map_type, const TskMap *map, const TskType *hashable_type, const TskTraitHashable *hashable_trait, const TskTypeLayout *hashable_layout, const TskAny *hashable) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
-	assert(key != TSK_NULL);
+	assert(tsk_type_is_valid(hashable_type));
+	assert(hashable_trait != TSK_NULL);
+	assert(hashable_layout != TSK_NULL);
+	assert(hashable != TSK_NULL);
+
+	TskU64 hash = 0;
+	if (hashable_layout->is_bytewise_hashable && tsk_map_hash_word(map, hashable, hashable_layout->size, &hash)) {
+		return hash;
+	}
 
-	const TskType *hasher_builder_type = TSK_NULL;
-	const TskAny  *hasher_builder      = TSK_NULL;
-	if (tsk_value_is_valid(&map->hasher_builder)) {
-		hasher_builder_type = tsk_value_type(&map->hasher_builder);
-		hasher_builder      = tsk_value_data_const(&map->hasher_builder);
-	} else {
-		hasher_builder_type = tsk_default_hasher_builder_type;
-		hasher_builder      = tsk_default_hasher_builder;
+	const TskAny *hasher_builder = tsk_default_hasher_builder;
+	if (map->hasher.builder_type != tsk_default_hasher_builder_type) {
+		hasher_builder = tsk_value_data_const(&map->hasher_builder);
 	}
 
-	const TskType             *hasher_type = tsk_trait_builder_built_type(hasher_builder_type);
-	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
-	tsk_trait_builder_build(
-	    hasher_builder_type,
-	    hasher_builder,
-	    hasher
-	);
+	alignas(max_align_t) TskU8 hasher[map->hasher.size];
+	map->hasher.builder_trait->build(map->hasher.builder_type, hasher_builder, hasher);
 
-	tsk_trait_hashable_hash(tsk_map_key_type(map_type), key, hasher_type, &hasher);
-	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
+	if (hashable_layout->is_bytewise_hashable) {
+		map->hasher.hasher_trait->combine(map->hasher.type, hasher, hashable, hashable_layout->size);
+	} else {
+		hashable_trait->hash(hashable_type, hashable, map->hasher.type, hasher);
+	}
+	hash = map->hasher.hasher_trait->finalize(map->hasher.type, hasher);
 
-	tsk_trait_droppable_drop(hasher_type, hasher);
+	if (map->hasher.droppable_trait->drop != TSK_NULL) {
+		map->hasher.droppable_trait->drop(map->hasher.type, hasher);
+	}
 
-	return hash;
+	return tsk_map_hash_mix(hash);
 }
-
-TskBoolean tsk_map_is_valid(const TskType *map_type, const TskMap *map) {
+static inline TskU64 tsk_map_hash_key(const TskType *map_type, const TskMap *map, const TskAny *key) {
 	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
 
-	return map != NULL && ((map->entries != TSK_NULL && map->keys != TSK_NULL && map->values != TSK_NULL) || map->capacity == 0) && map->length <= map->capacity;
+	const TskMapType *map_type_data = (const TskMapType *)map_type;
+	return tsk_map_hash_hashable(
+	    map_type,
+	    map,
+	    map_type_data->key_type,
+	    map_type_data->key_hashable_trait,
+	    map_type_data->key_layout,
+	    key
+	);
 }
-TskMap tsk_map_new(const TskType *map_type) {
+static inline TskBoolean tsk_map_key_equals(const TskType *map_type, const TskMap *map, TskUSize index, const TskAny *key, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2)) {
 	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(key != TSK_NULL);
 
-	TskMap map = {
-		.hasher_builder = {
-		    .type = TSK_NULL,
-		},
-		.entries  = TSK_NULL,
-		.keys     = TSK_NULL,
-		.values   = TSK_NULL,
-		.length   = 0,
-		.capacity = 0,
-	};
-
-	assert(tsk_map_is_valid(map_type, &map));
-
-	return map;
-}
-TskBoolean tsk_map_with_hasher_builder(const TskType *map_type, TskMap *map, const TskType *hasher_builder_type, TskAny *hasher_builder) {
-	assert(tsk_map_type_is_valid(map_type));
-	assert(map != TSK_NULL);
-	assert(tsk_type_is_valid(hasher_builder_type));
-	assert(tsk_type_has_trait(hasher_builder_type, TSK_TRAIT_ID_COMPLETE));
-	assert(tsk_type_has_trait(hasher_builder_type, TSK_TRAIT_ID_BUILDER));
-	assert(tsk_type_has_trait(tsk_trait_builder_built_type(hasher_builder_type), TSK_TRAIT_ID_HASHER));
-	assert(hasher_builder != TSK_NULL);
+	if (equals != TSK_NULL) {
+		return equals(key, tsk_map_get_key_const(map_type, map, index));
+	}
 
-	if (!tsk_value_new(&map->hasher_builder, hasher_builder_type)) {
-		return TSK_FALSE;
+	const TskMapType *map_type_data = (const TskMapType *)map_type;
+	if (map_type_data->key_layout->is_bitwise_equatable) {
+		return memcmp(tsk_map_get_key_const(map_type, map, index), key, map_type_data->key_layout->size) == 0;
 	}
 
-	memcpy(
-	    tsk_value_data(&map->hasher_builder),
-	    hasher_builder,
-	    tsk_trait_complete_size(hasher_builder_type)
+	return tsk_trait_equatable_equals(
+	    tsk_map_key_type(map_type),
+	    tsk_map_get_key_const(map_type, map, index),
+	    key
 	);
-	map->entries  = TSK_NULL;
-	map->keys     = TSK_NULL;
-	map->values   = TSK_NULL;
-	map->length   = 0;
-	map->capacity = 0;
-
+}
+static inline TskBoolean tsk_map_swiss_table_find(const TskType *map_type, const TskMap *map, TskU64 hash, const TskAny *key, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2), TskUSize *index) {
+	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(index != TSK_NULL);
+
+	TskU8    h2          = tsk_map_hash_h2(hash);
+	TskUSize groups_mask = tsk_map_groups_length(tsk_map_capacity(map_type, map)) - 1;
+	TskUSize group_index = (TskUSize)tsk_map_hash_h1(hash) & groups_mask;
+	for (TskUSize i = 0; i <= groups_mask; i++) {
+		const TskU8 *group = map->controls + (group_index * TSK_MAP_GROUP_WIDTH);
+		for (TskU32 mask = tsk_map_group_match(group, h2); mask != 0; mask &= mask - 1) {
+			TskUSize slot_index = (group_index * TSK_MAP_GROUP_WIDTH) + tsk_map_mask_first(mask);
+			if (tsk_map_key_equals(map_type, map, slot_index, key, equals)) {
+				*index = slot_index;
+				return TSK_TRUE;
+			}
+		}
+		if (tsk_map_group_match_empty(group) != 0) {
+			break;
+		}
+		group_index = (group_index + i + 1) & groups_mask;
+	}
 
-	return TSK_TRUE;
+	return TSK_FALSE;
 }
-TskEmpty tsk_map_drop(const TskType *map_type, TskMap *map) {
+static inline TskUSize tsk_map_swiss_table_prepare_insert(const TskType *map_type, const TskMap *map, TskU64 hash, TskU8 *control) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_map_length(map_type, map) < tsk_map_capacity(map_type, map));
+	assert(control != TSK_NULL);
 
-	tsk_map_clear(map_type, map);
+	*control             = tsk_map_hash_h2(hash);
 
-	if (tsk_value_is_valid(&map->hasher_builder)) {
-		tsk_value_drop(&map->hasher_builder);
-	}
+	TskUSize groups_mask = tsk_map_groups_length(tsk_map_capacity(map_type, map)) - 1;
+	TskUSize group_index = (TskUSize)tsk_map_hash_h1(hash) & groups_mask;
+	for (TskUSize i = 0;; i++) {
+		assert(i <= groups_mask);
 
-	free(map->entries);
-	if (tsk_trait_complete_size(tsk_map_key_type(map_type)) != 0) {
-		free(map->keys);
-	}
-	if (tsk_trait_complete_size(tsk_map_value_type(map_type)) != 0) {
-		free(map->values);
+		TskU32 mask = tsk_map_group_match_empty_or_deleted(map->controls + (group_index * TSK_MAP_GROUP_WIDTH));
+		if (mask != 0) {
+			return (group_index * TSK_MAP_GROUP_WIDTH) + tsk_map_mask_first(mask);
+		}
+		group_index = (group_index + i + 1) & groups_mask;
 	}
-
-	map->entries  = TSK_NULL;
-	map->keys     = TSK_NULL;
-	map->values   = TSK_NULL;
-	map->capacity = 0;
 }
-TskBoolean tsk_map_clone(const TskType *map_type, const TskMap *map_1, TskMap *map_2) {
+static inline TskBoolean tsk_map_swiss_table_find_or_prepare_insert(const TskType *map_type, const TskMap *map, TskU64 hash, const TskAny *key, TskUSize *index, TskU8 *control) {
 	assert(tsk_map_type_is_valid(map_type));
-	assert(tsk_map_is_valid(map_type, map_1));
-	assert(map_2 != TSK_NULL);
-
-	if (tsk_map_is_empty(map_type, map_1)) {
-		*map_2 = tsk_map_new(map_type);
-		return TSK_TRUE;
-	}
-
-	TskMap map = tsk_map_new(map_type);
-	if (!tsk_map_reserve_additional(map_type, &map, tsk_map_length(map_type, map_1))) {
-		return TSK_FALSE;
-	}
-
-	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map_1); i++) {
-		if (map_1->entries[i].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-			TskUSize index = map_1->entries[i].hash % tsk_map_capacity(map_type, &map);
-			while (map.entries[index].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-				index = (index + 1) % tsk_map_capacity(map_type, &map);
-			}
-
-			if (!tsk_trait_clonable_clone(
-			        tsk_map_key_type(map_type),
-			        tsk_map_get_key_const(map_type, map_1, i),
-			        tsk_map_get_key(map_type, &map, index)
-			    )) {
-				tsk_map_drop(map_type, &map);
-				return TSK_FALSE;
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_map_length(map_type, map) < tsk_map_capacity(map_type, map));
+	assert(key != TSK_NULL);
+	assert(index != TSK_NULL);
+	assert(control != TSK_NULL);
+
+	TskU8    h2           = tsk_map_hash_h2(hash);
+	TskUSize groups_mask  = tsk_map_groups_length(tsk_map_capacity(map_type, map)) - 1;
+	TskUSize group_index  = (TskUSize)tsk_map_hash_h1(hash) & groups_mask;
+	TskUSize insert_index = tsk_map_capacity(map_type, map);
+	for (TskUSize i = 0; i <= groups_mask; i++) {
+		const TskU8 *group = map->controls + (group_index * TSK_MAP_GROUP_WIDTH);
+		for (TskU32 mask = tsk_map_group_match(group, h2); mask != 0; mask &= mask - 1) {
+			TskUSize slot_index = (group_index * TSK_MAP_GROUP_WIDTH) + tsk_map_mask_first(mask);
+			if (tsk_map_key_equals(map_type, map, slot_index, key, TSK_NULL)) {
+				*index = slot_index;
+				return TSK_TRUE;
 			}
-
-			if (!tsk_trait_clonable_clone(
-			        tsk_map_value_type(map_type),
-			        tsk_map_get_value_const(map_type, map_1, i),
-			        tsk_map_get_value(map_type, &map, index)
-			    )) {
-				tsk_trait_droppable_drop(
-				    tsk_map_key_type(map_type),
-				    tsk_map_get_key(map_type, &map, index)
-				);
-				tsk_map_drop(map_type, &map);
-				return TSK_FALSE;
+		}
+		if (insert_index == tsk_map_capacity(map_type, map)) {
+			TskU32 mask = tsk_map_group_match_empty_or_deleted(group);
+			if (mask != 0) {
+				insert_index = (group_index * TSK_MAP_GROUP_WIDTH) + tsk_map_mask_first(mask);
 			}
-
-			map.entries[index] = map_1->entries[i];
 		}
+		if (tsk_map_group_match_empty(group) != 0) {
+			break;
+		}
+		group_index = (group_index + i + 1) & groups_mask;
 	}
 
-	map.length = map_1->length;
-
-	*map_2     = map;
+	assert(insert_index < tsk_map_capacity(map_type, map));
 
-	return TSK_TRUE;
+	*index   = insert_index;
+	*control = h2;
+	return TSK_FALSE;
 }
-const TskType *tsk_map_key_type(const TskType *map_type) {
+static inline TskEmpty tsk_map_swiss_table_erase(const TskType *map_type, TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(tsk_map_control_is_full(map->controls[index]));
 
-	return ((const TskMapType *)map_type)->key_type;
+	if (tsk_map_group_match_empty(map->controls + ((index / TSK_MAP_GROUP_WIDTH) * TSK_MAP_GROUP_WIDTH)) != 0) {
+		map->controls[index] = TSK_MAP_CONTROL_EMPTY;
+	} else {
+		map->controls[index] = TSK_MAP_CONTROL_DELETED;
+		map->deleted++;
+	}
 }
-const TskType *tsk_map_value_type(const TskType *map_type) {
+static inline TskUSize tsk_map_swiss_table_probe_distance(const TskType *map_type, const TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(tsk_map_control_is_full(map->controls[index]));
 
-	return ((const TskMapType *)map_type)->value_type;
+	TskU64   hash        = tsk_map_hash_key(map_type, map, tsk_map_get_key_const(map_type, map, index));
+	TskUSize groups_mask = tsk_map_groups_length(tsk_map_capacity(map_type, map)) - 1;
+	TskUSize group_index = (TskUSize)tsk_map_hash_h1(hash) & groups_mask;
+	TskUSize i           = 0;
+	while (group_index != index / TSK_MAP_GROUP_WIDTH) {
+		assert(i < groups_mask);
+
+		group_index = (group_index + i + 1) & groups_mask;
+		i++;
+	}
+
+	return i;
 }
-TskUSize tsk_map_length(const TskType *map_type, const TskMap *map) {
+
+static inline TskUSize tsk_map_robin_hood_probe_distance(const TskType *map_type, const TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(tsk_map_control_is_full(map->controls[index]));
 
-	return map->length;
+	if (map->controls[index] < TSK_MAP_ROBIN_HOOD_MAXIMUM_CONTROL) {
+		return map->controls[index];
+	}
+
+	TskU64 hash = tsk_map_hash_key(map_type, map, tsk_map_get_key_const(map_type, map, index));
+	return (index - (TskUSize)tsk_map_hash_h1(hash)) & (tsk_map_capacity(map_type, map) - 1);
 }
-TskBoolean tsk_map_is_empty(const TskType *map_type, const TskMap *map) {
+static inline TskU8 tsk_map_robin_hood_control(TskUSize probe_distance) {
+	return probe_distance < TSK_MAP_ROBIN_HOOD_MAXIMUM_CONTROL ? (TskU8)probe_distance : TSK_MAP_ROBIN_HOOD_MAXIMUM_CONTROL;
+}
+static inline TskEmpty tsk_map_robin_hood_move(const TskType *map_type, TskMap *map, TskUSize from, TskUSize to) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(from < tsk_map_capacity(map_type, map));
+	assert(to < tsk_map_capacity(map_type, map));
 
-	return tsk_map_length(map_type, map) == 0;
+	memcpy(
+	    tsk_map_get_key(map_type, map, to),
+	    tsk_map_get_key_const(map_type, map, from),
+	    tsk_trait_complete_size(tsk_map_key_type(map_type))
+	);
+	memcpy(
+	    tsk_map_get_value(map_type, map, to),
+	    tsk_map_get_value_const(map_type, map, from),
+	    tsk_trait_complete_size(tsk_map_value_type(map_type))
+	);
 }
-TskUSize tsk_map_capacity(const TskType *map_type, const TskMap *map) {
+static inline TskEmpty tsk_map_robin_hood_make_room(const TskType *map_type, TskMap *map, TskUSize index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_map_length(map_type, map) < tsk_map_capacity(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
 
-	return map->capacity;
-}
-TskUSize tsk_map_maximum_capacity(const TskType *map_type) {
-	assert(tsk_map_type_is_valid(map_type));
+	TskUSize mask        = tsk_map_capacity(map_type, map) - 1;
 
-	TskUSize entry_size   = sizeof(TskMapEntry);
-	TskUSize key_size     = tsk_trait_complete_size(tsk_map_key_type(map_type));
-	TskUSize value_size   = tsk_trait_complete_size(tsk_map_value_type(map_type));
+	TskUSize empty_index = index;
+	while (tsk_map_control_is_full(map->controls[empty_index])) {
+		empty_index = (empty_index + 1) & mask;
+	}
 
-	TskUSize maximum_size = entry_size > key_size ? entry_size : key_size;
-	maximum_size          = maximum_size > value_size ? maximum_size : value_size;
+	while (empty_index != index) {
+		TskUSize previous_index    = (empty_index - 1) & mask;
+		map->controls[empty_index] = tsk_map_robin_hood_control(tsk_map_robin_hood_probe_distance(map_type, map, previous_index) + 1);
+		tsk_map_robin_hood_move(map_type, map, previous_index, empty_index);
+		empty_index = previous_index;
+	}
 
-	return SIZE_MAX / maximum_size;
+	map->controls[index] = TSK_MAP_CONTROL_EMPTY;
 }
-TskF32 tsk_map_load_factor(const TskType *map_type, const TskMap *map) {
+static inline TskBoolean tsk_map_robin_hood_find(const TskType *map_type, const TskMap *map, TskU64 hash, const TskAny *key, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2), TskUSize *index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(index != TSK_NULL);
 
-	if (tsk_map_capacity(map_type, map) == 0) {
-		return 0.0F;
+	TskUSize mask       = tsk_map_capacity(map_type, map) - 1;
+	TskUSize slot_index = (TskUSize)tsk_map_hash_h1(hash) & mask;
+	for (TskUSize probe_distance = 0; probe_distance <= mask; probe_distance++) {
+		if (!tsk_map_control_is_full(map->controls[slot_index])) {
+			break;
+		}
+
+		TskUSize slot_probe_distance = tsk_map_robin_hood_probe_distance(map_type, map, slot_index);
+		if (slot_probe_distance < probe_distance) {
+			break;
+		}
+
+		if (slot_probe_distance == probe_distance && tsk_map_key_equals(map_type, map, slot_index, key, equals)) {
+			*index = slot_index;
+			return TSK_TRUE;
+		}
+
+		slot_index = (slot_index + 1) & mask;
 	}
 
-	return (TskF32)tsk_map_length(map_type, map) / (TskF32)tsk_map_capacity(map_type, map);
+	return TSK_FALSE;
 }
-TskF32 tsk_map_maximum_load_factor(const TskType *map_type) {
+static inline TskUSize tsk_map_robin_hood_prepare_insert(const TskType *map_type, TskMap *map, TskU64 hash, TskU8 *control) {
 	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_map_length(map_type, map) < tsk_map_capacity(map_type, map));
+	assert(control != TSK_NULL);
+
+	TskUSize mask           = tsk_map_capacity(map_type, map) - 1;
+	TskUSize slot_index     = (TskUSize)tsk_map_hash_h1(hash) & mask;
+	TskUSize probe_distance = 0;
+	while (tsk_map_control_is_full(map->controls[slot_index]) &&
+	       tsk_map_robin_hood_probe_distance(map_type, map, slot_index) >= probe_distance) {
+		slot_index = (slot_index + 1) & mask;
+		probe_distance++;
+	}
 
-	return 0.5F;
+	*control = tsk_map_robin_hood_control(probe_distance);
+	return slot_index;
 }
-TskAny *tsk_map_get(const TskType *map_type, TskMap *map, const TskAny *key) {
+static inline TskBoolean tsk_map_robin_hood_find_or_prepare_insert(const TskType *map_type, TskMap *map, TskU64 hash, const TskAny *key, TskUSize *index, TskU8 *control) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_map_length(map_type, map) < tsk_map_capacity(map_type, map));
 	assert(key != TSK_NULL);
+	assert(index != TSK_NULL);
+	assert(control != TSK_NULL);
+
+	TskUSize mask           = tsk_map_capacity(map_type, map) - 1;
+	TskUSize slot_index     = (TskUSize)tsk_map_hash_h1(hash) & mask;
+	TskUSize probe_distance = 0;
+	while (tsk_map_control_is_full(map->controls[slot_index])) {
+		TskUSize slot_probe_distance = tsk_map_robin_hood_probe_distance(map_type, map, slot_index);
+		if (slot_probe_distance < probe_distance) {
+			break;
+		}
 
-	if (tsk_map_is_empty(map_type, map)) {
-		return TSK_NULL;
+		if (slot_probe_distance == probe_distance && tsk_map_key_equals(map_type, map, slot_index, key, TSK_NULL)) {
+			*index = slot_index;
+			return TSK_TRUE;
+		}
+
+		slot_index = (slot_index + 1) & mask;
+		probe_distance++;
 	}
 
-	TskU64   hash           = tsk_map_hash_key(map_type, map, key);
-	TskUSize starting_index = hash % tsk_map_capacity(map_type, map);
-	TskUSize index          = starting_index;
-	while (map->entries[index].state != TSK_MAP_ENTRY_STATE_EMPTY) {
-		if (map->entries[index].state == TSK_MAP_ENTRY_STATE_OCCUPIED &&
-		    map->entries[index].hash == hash &&
-		    tsk_trait_equatable_equals(
-		        tsk_map_key_type(map_type),
-		        tsk_map_get_key_const(map_type, map, index),
-		        key
-		    )) {
-			return tsk_map_get_value(map_type, map, index);
-		}
-		index = (index + 1) % tsk_map_capacity(map_type, map);
-		if (index == starting_index) {
-			break;
-		}
+	*index   = slot_index;
+	*control = tsk_map_robin_hood_control(probe_distance);
+	return TSK_FALSE;
+}
+static inline TskEmpty tsk_map_robin_hood_erase(const TskType *map_type, TskMap *map, TskUSize index) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(tsk_map_control_is_full(map->controls[index]));
+
+	TskUSize mask       = tsk_map_capacity(map_type, map) - 1;
+	TskUSize next_index = (index + 1) & mask;
+	while (tsk_map_control_is_full(map->controls[next_index]) && map->controls[next_index] != 0) {
+		map->controls[index] = tsk_map_robin_hood_control(tsk_map_robin_hood_probe_distance(map_type, map, next_index) - 1);
+		tsk_map_robin_hood_move(map_type, map, next_index, index);
+		index      = next_index;
+		next_index = (next_index + 1) & mask;
 	}
 
-	return TSK_NULL;
+	map->controls[index] = TSK_MAP_CONTROL_EMPTY;
 }
-const TskAny *tsk_map_get_const(const TskType *map_type, const TskMap *map, const TskAny *key) {
+
+static inline TskBoolean tsk_map_find(const TskType *map_type, const TskMap *map, TskU64 hash, const TskAny *key, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2), TskUSize *index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
 	assert(key != TSK_NULL);
+	assert(index != TSK_NULL);
 
-	if (tsk_map_is_empty(map_type, map)) {
-		return TSK_NULL;
+	if (tsk_map_capacity(map_type, map) == 0) {
+		return TSK_FALSE;
 	}
 
-	TskU64   hash           = tsk_map_hash_key(map_type, map, key);
-	TskUSize starting_index = hash % tsk_map_capacity(map_type, map);
-	TskUSize index          = starting_index;
-	while (map->entries[index].state != TSK_MAP_ENTRY_STATE_EMPTY) {
-		if (map->entries[index].state == TSK_MAP_ENTRY_STATE_OCCUPIED &&
-		    map->entries[index].hash == hash &&
-		    tsk_trait_equatable_equals(
-		        tsk_map_key_type(map_type),
-		        tsk_map_get_key_const(map_type, map, index),
-		        key
-		    )) {
-			return tsk_map_get_value_const(map_type, map, index);
-		}
-		index = (index + 1) % tsk_map_capacity(map_type, map);
-		if (index == starting_index) {
-			break;
-		}
+	switch (tsk_map_engine(map_type)) {
+		case TSK_MAP_ENGINE_SWISS_TABLE: return tsk_map_swiss_table_find(map_type, map, hash, key, equals, index);
+		case TSK_MAP_ENGINE_ROBIN_HOOD: return tsk_map_robin_hood_find(map_type, map, hash, key, equals, index);
 	}
 
-	return TSK_NULL;
+	return TSK_FALSE;
 }
-TskEmpty tsk_map_clear(const TskType *map_type, TskMap *map) {
+static inline TskUSize tsk_map_prepare_insert(const TskType *map_type, TskMap *map, TskU64 hash, TskU8 *control) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
-	assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
-	assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
 
-	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map); i++) {
-		if (map->entries[i].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-			tsk_trait_droppable_drop(
-			    tsk_map_key_type(map_type),
-			    tsk_map_get_key(map_type, map, i)
-			);
-			tsk_trait_droppable_drop(
-			    tsk_map_value_type(map_type),
-			    tsk_map_get_value(map_type, map, i)
-			);
+	switch (tsk_map_engine(map_type)) {
+		case TSK_MAP_ENGINE_SWISS_TABLE: return tsk_map_swiss_table_prepare_insert(map_type, map, hash, control);
+		case TSK_MAP_ENGINE_ROBIN_HOOD: return tsk_map_robin_hood_prepare_insert(map_type, map, hash, control);
+	}
+
+	return 0;
+}
+static inline TskBoolean tsk_map_find_or_prepare_insert(const TskType *map_type, TskMap *map, TskU64 hash, const TskAny *key, TskUSize *index, TskU8 *control) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	switch (tsk_map_engine(map_type)) {
+		case TSK_MAP_ENGINE_SWISS_TABLE: return tsk_map_swiss_table_find_or_prepare_insert(map_type, map, hash, key, index, control);
+		case TSK_MAP_ENGINE_ROBIN_HOOD: return tsk_map_robin_hood_find_or_prepare_insert(map_type, map, hash, key, index, control);
+	}
+
+	return TSK_FALSE;
+}
+static inline TskEmpty tsk_map_erase(const TskType *map_type, TskMap *map, TskUSize index) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	switch (tsk_map_engine(map_type)) {
+		case TSK_MAP_ENGINE_SWISS_TABLE: tsk_map_swiss_table_erase(map_type, map, index); break;
+		case TSK_MAP_ENGINE_ROBIN_HOOD: tsk_map_robin_hood_erase(map_type, map, index); break;
+	}
+}
+static inline TskUSize tsk_map_probe_distance(const TskType *map_type, const TskMap *map, TskUSize index) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	switch (tsk_map_engine(map_type)) {
+		case TSK_MAP_ENGINE_SWISS_TABLE: return tsk_map_swiss_table_probe_distance(map_type, map, index);
+		case TSK_MAP_ENGINE_ROBIN_HOOD: return tsk_map_robin_hood_probe_distance(map_type, map, index);
+	}
+
+	return 0;
+}
+static inline TskUSize tsk_map_home_index(const TskType *map_type, const TskMap *map, TskU64 hash) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_map_capacity(map_type, map) != 0);
+
+	switch (tsk_map_engine(map_type)) {
+		case TSK_MAP_ENGINE_SWISS_TABLE: return ((TskUSize)tsk_map_hash_h1(hash) & (tsk_map_groups_length(tsk_map_capacity(map_type, map)) - 1)) * TSK_MAP_GROUP_WIDTH;
+		case TSK_MAP_ENGINE_ROBIN_HOOD: return (TskUSize)tsk_map_hash_h1(hash) & (tsk_map_capacity(map_type, map) - 1);
+	}
+
+	return 0;
+}
+static inline TskUSize tsk_map_slots_length(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (map->previous == TSK_NULL) {
+		return tsk_map_capacity(map_type, map);
+	}
+
+	return tsk_map_capacity(map_type, map) + tsk_map_capacity(map_type, map->previous);
+}
+static inline TskMap *tsk_map_slot_table(const TskType *map_type, TskMap *map, TskUSize *index) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index != TSK_NULL);
+	assert(*index < tsk_map_slots_length(map_type, map));
+
+	if (*index < tsk_map_capacity(map_type, map)) {
+		return map;
+	}
+
+	*index -= tsk_map_capacity(map_type, map);
+	return map->previous;
+}
+static inline const TskMap *tsk_map_slot_table_const(const TskType *map_type, const TskMap *map, TskUSize *index) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index != TSK_NULL);
+	assert(*index < tsk_map_slots_length(map_type, map));
+
+	if (*index < tsk_map_capacity(map_type, map)) {
+		return map;
+	}
+
+	*index -= tsk_map_capacity(map_type, map);
+	return map->previous;
+}
+static inline TskBoolean tsk_map_next_full_slot(const TskType *map_type, const TskMap *map, TskUSize *index) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index != TSK_NULL);
+
+	while (*index < tsk_map_slots_length(map_type, map)) {
+		TskUSize      table_index = *index;
+		const TskMap *table       = tsk_map_slot_table_const(map_type, map, &table_index);
+
+		TskUSize      offset      = table_index % TSK_MAP_GROUP_WIDTH;
+		TskU32        mask        = tsk_map_group_match_full(table->controls + (table_index - offset)) >> offset;
+		if (mask != 0) {
+			*index += tsk_map_mask_first(mask);
+			return TSK_TRUE;
 		}
+
+		TskUSize remaining = tsk_map_capacity(map_type, table) - table_index;
+		*index += remaining < TSK_MAP_GROUP_WIDTH - offset ? remaining : TSK_MAP_GROUP_WIDTH - offset;
 	}
 
-	map->length = 0;
+	return TSK_FALSE;
 }
-TskBoolean tsk_map_reserve(const TskType *map_type, TskMap *map, TskUSize capacity) {
+static inline TskBoolean tsk_map_find_slot(const TskType *map_type, const TskMap *map, TskU64 hash, const TskAny *key, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2), TskUSize *index) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(index != TSK_NULL);
 
-	if (capacity <= tsk_map_capacity(map_type, map)) {
+	if (tsk_map_find(map_type, map, hash, key, equals, index)) {
 		return TSK_TRUE;
 	}
 
-	if (capacity > tsk_map_maximum_capacity(map_type)) {
+	if (map->previous != TSK_NULL && tsk_map_find(map_type, map->previous, hash, key, equals, index)) {
+		*index += tsk_map_capacity(map_type, map);
+		return TSK_TRUE;
+	}
+
+	return TSK_FALSE;
+}
+static inline TskEmpty tsk_map_prefetch(const TskAny *address) {
+#if defined(__GNUC__)
+	__builtin_prefetch(address);
+#else
+	(TskEmpty) address;
+#endif
+}
+static inline TskUSize tsk_map_find_many(const TskType *map_type, const TskMap *map, const TskType *keys_type, TskArrayViewConst keys, TskUSize start, TskUSize *indices) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(!tsk_map_is_empty(map_type, map));
+	assert(tsk_array_view_const_is_valid(keys_type, keys));
+	assert(start < tsk_array_view_const_length(keys_type, keys));
+	assert(indices != TSK_NULL);
+
+	TskUSize length = tsk_array_view_const_length(keys_type, keys) - start;
+	if (length > TSK_MAP_FIND_MANY_BATCH_LENGTH) {
+		length = TSK_MAP_FIND_MANY_BATCH_LENGTH;
+	}
+
+	TskU64 hashes[TSK_MAP_FIND_MANY_BATCH_LENGTH];
+	for (TskUSize i = 0; i < length; i++) {
+		hashes[i]      = tsk_map_hash_key(map_type, map, tsk_array_view_const_get(keys_type, keys, start + i));
+
+		TskUSize index = tsk_map_home_index(map_type, map, hashes[i]);
+		tsk_map_prefetch(map->controls + index);
+		tsk_map_prefetch(tsk_map_get_key_const(map_type, map, index));
+		tsk_map_prefetch(tsk_map_get_value_const(map_type, map, index));
+	}
+
+	for (TskUSize i = 0; i < length; i++) {
+		if (!tsk_map_find_slot(map_type, map, hashes[i], tsk_array_view_const_get(keys_type, keys, start + i), TSK_NULL, &indices[i])) {
+			indices[i] = tsk_map_slots_length(map_type, map);
+		}
+	}
+
+	return length;
+}
+static inline TskEmpty tsk_map_occupy(const TskType *map_type, TskMap *map, TskUSize index, TskU8 control) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(tsk_map_engine(map_type) == TSK_MAP_ENGINE_ROBIN_HOOD || !tsk_map_control_is_full(map->controls[index]));
+	assert(tsk_map_control_is_full(control));
+
+	if (tsk_map_engine(map_type) == TSK_MAP_ENGINE_ROBIN_HOOD) {
+		tsk_map_robin_hood_make_room(map_type, map, index);
+	}
+	if (map->controls[index] == TSK_MAP_CONTROL_DELETED) {
+		map->deleted--;
+	}
+	map->controls[index] = control;
+
+	map->length++;
+}
+static inline TskEmpty tsk_map_insert_at(const TskType *map_type, TskMap *map, TskUSize index, TskU8 control, TskAny *key, TskAny *value) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	tsk_map_occupy(map_type, map, index, control);
+
+	memcpy(
+	    tsk_map_get_key(map_type, map, index),
+	    key,
+	    tsk_trait_complete_size(tsk_map_key_type(map_type))
+	);
+	memcpy(
+	    tsk_map_get_value(map_type, map, index),
+	    value,
+	    tsk_trait_complete_size(tsk_map_value_type(map_type))
+	);
+}
+static inline TskEmpty tsk_map_replace_at(const TskType *map_type, TskMap *map, TskUSize index, TskAny *key, TskAny *value) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index < tsk_map_capacity(map_type, map));
+	assert(tsk_map_control_is_full(map->controls[index]));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+	assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+	assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+
+	tsk_trait_droppable_drop(
+	    tsk_map_key_type(map_type),
+	    key
+	);
+	tsk_trait_droppable_drop(
+	    tsk_map_value_type(map_type),
+	    tsk_map_get_value(map_type, map, index)
+	);
+	memcpy(
+	    tsk_map_get_value(map_type, map, index),
+	    value,
+	    tsk_trait_complete_size(tsk_map_value_type(map_type))
+	);
+}
+static inline TskEmpty tsk_map_insert_hashed(const TskType *map_type, TskMap *map, TskU64 hash, TskAny *key, TskAny *value, TskBoolean unique) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(map->previous == TSK_NULL);
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	TskUSize index   = 0;
+	TskU8    control = 0;
+	if (unique) {
+		assert(!tsk_map_find(map_type, map, hash, key, TSK_NULL, &index));
+
+		index = tsk_map_prepare_insert(map_type, map, hash, &control);
+	} else if (tsk_map_find_or_prepare_insert(map_type, map, hash, key, &index, &control)) {
+		tsk_map_replace_at(map_type, map, index, key, value);
+		return;
+	}
+
+	tsk_map_insert_at(map_type, map, index, control, key, value);
+}
+static inline TskUSize tsk_map_insert_many(const TskType *map_type, TskMap *map, const TskType *items_type, TskArrayView items, TskUSize start, TskBoolean unique) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(map->previous == TSK_NULL);
+	assert(tsk_array_view_is_valid(items_type, items));
+	assert(start < tsk_array_view_length(items_type, items));
+
+	const TskType *item_type = tsk_array_view_element_type(items_type);
+
+	TskUSize length          = tsk_array_view_length(items_type, items) - start;
+	if (length > TSK_MAP_FIND_MANY_BATCH_LENGTH) {
+		length = TSK_MAP_FIND_MANY_BATCH_LENGTH;
+	}
+	assert(map->length + length <= tsk_map_capacity(map_type, map));
+
+	TskU64 hashes[TSK_MAP_FIND_MANY_BATCH_LENGTH];
+	for (TskUSize i = 0; i < length; i++) {
+		hashes[i]      = tsk_map_hash_key(map_type, map, tsk_tuple_get(item_type, tsk_array_view_get(items_type, items, start + i), 0));
+
+		TskUSize index = tsk_map_home_index(map_type, map, hashes[i]);
+		tsk_map_prefetch(map->controls + index);
+		if (!unique) {
+			tsk_map_prefetch(tsk_map_get_key_const(map_type, map, index));
+		}
+	}
+
+	for (TskUSize i = 0; i < length; i++) {
+		TskTuple *item = tsk_array_view_get(items_type, items, start + i);
+		tsk_map_insert_hashed(map_type, map, hashes[i], tsk_tuple_get(item_type, item, 0), tsk_tuple_get(item_type, item, 1), unique);
+	}
+
+	return length;
+}
+static inline TskBoolean tsk_map_element_is_convertible(const TskType *element_type, const TskType *source_type) {
+	assert(tsk_type_is_valid(element_type));
+	assert(tsk_type_is_valid(source_type));
+
+	return source_type == element_type ||
+	       (tsk_reference_type_is_valid(source_type) && tsk_reference_referenced_type(source_type) == element_type) ||
+	       (tsk_reference_const_type_is_valid(source_type) && tsk_reference_const_referenced_type(source_type) == element_type);
+}
+static inline TskBoolean tsk_map_element_convert(const TskType *element_type, const TskType *source_type, TskAny *source, TskAny *element) {
+	assert(tsk_map_element_is_convertible(element_type, source_type));
+	assert(source != TSK_NULL);
+	assert(element != TSK_NULL);
+
+	if (source_type == element_type) {
+		memcpy(element, source, tsk_trait_complete_size(element_type));
+		return TSK_TRUE;
+	}
+
+	const TskAny *referenced = TSK_NULL;
+	if (tsk_reference_type_is_valid(source_type)) {
+		referenced = tsk_reference_dereference(source_type, source);
+	} else {
+		referenced = tsk_reference_const_dereference(source_type, source);
+	}
+
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_CLONABLE));
+	return tsk_trait_clonable_clone(element_type, referenced, element);
+}
+static inline TskBoolean tsk_map_item_is_convertible(const TskType *map_type, const TskType *source_type) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_type_is_valid(source_type));
+
+	if (tsk_map_element_is_convertible(tsk_map_item_type(map_type), source_type)) {
+		return TSK_TRUE;
+	}
+
+	return tsk_tuple_type_is_valid(source_type) &&
+	       tsk_tuple_length(source_type) == 2 &&
+	       tsk_map_element_is_convertible(tsk_map_key_type(map_type), tsk_tuple_element_type(source_type, 0)) &&
+	       tsk_map_element_is_convertible(tsk_map_value_type(map_type), tsk_tuple_element_type(source_type, 1));
+}
+static inline TskBoolean tsk_map_item_convert(const TskType *map_type, const TskType *source_type, TskAny *source, TskTuple *item) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_item_is_convertible(map_type, source_type));
+	assert(source != TSK_NULL);
+	assert(item != TSK_NULL);
+
+	const TskType *item_type = tsk_map_item_type(map_type);
+	if (tsk_map_element_is_convertible(item_type, source_type)) {
+		return tsk_map_element_convert(item_type, source_type, source, item);
+	}
+
+	if (!tsk_map_element_convert(
+	        tsk_map_key_type(map_type),
+	        tsk_tuple_element_type(source_type, 0),
+	        tsk_tuple_get(source_type, source, 0),
+	        tsk_tuple_get(item_type, item, 0)
+	    )) {
+		return TSK_FALSE;
+	}
+	if (!tsk_map_element_convert(
+	        tsk_map_value_type(map_type),
+	        tsk_tuple_element_type(source_type, 1),
+	        tsk_tuple_get(source_type, source, 1),
+	        tsk_tuple_get(item_type, item, 1)
+	    )) {
+		assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+
+		tsk_trait_droppable_drop(
+		    tsk_map_key_type(map_type),
+		    tsk_tuple_get(item_type, item, 0)
+		);
 		return TSK_FALSE;
 	}
 
-	TskMapEntry *entries = calloc(capacity, sizeof(TskMapEntry));
-	if (entries == TSK_NULL) {
+	return TSK_TRUE;
+}
+static inline TskEmpty tsk_map_swap_bytes(TskU8 *bytes_1, TskU8 *bytes_2, TskUSize size) {
+	for (TskUSize i = 0; i < size; i++) {
+		TskU8 byte = bytes_1[i];
+		bytes_1[i] = bytes_2[i];
+		bytes_2[i] = byte;
+	}
+}
+static inline TskEmpty tsk_map_rehash_in_place(const TskType *map_type, TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map); i++) {
+		if (tsk_map_control_is_full(map->controls[i])) {
+			map->controls[i] = TSK_MAP_CONTROL_DELETED;
+		} else if (map->controls[i] == TSK_MAP_CONTROL_DELETED) {
+			map->controls[i] = TSK_MAP_CONTROL_EMPTY;
+		}
+	}
+
+	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map); i++) {
+		while (map->controls[i] == TSK_MAP_CONTROL_DELETED) {
+			TskU64   hash    = tsk_map_hash_key(map_type, map, tsk_map_get_key_const(map_type, map, i));
+			TskU8    control = 0;
+			TskUSize index   = tsk_map_swiss_table_prepare_insert(map_type, map, hash, &control);
+
+			if (index / TSK_MAP_GROUP_WIDTH == i / TSK_MAP_GROUP_WIDTH) {
+				map->controls[i] = control;
+				break;
+			}
+
+			TskU8 previous_control = map->controls[index];
+			map->controls[index]   = control;
+			tsk_map_swap_bytes(
+			    tsk_map_get_key(map_type, map, i),
+			    tsk_map_get_key(map_type, map, index),
+			    tsk_trait_complete_size(tsk_map_key_type(map_type))
+			);
+			tsk_map_swap_bytes(
+			    tsk_map_get_value(map_type, map, i),
+			    tsk_map_get_value(map_type, map, index),
+			    tsk_trait_complete_size(tsk_map_value_type(map_type))
+			);
+			map->controls[i] = previous_control;
+		}
+	}
+
+	map->deleted = 0;
+}
+
+static inline TskBoolean tsk_map_allocate(const TskType *map_type, TskUSize capacity, TskU8 **controls, TskAny **keys, TskAny **values) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+	assert(controls != TSK_NULL);
+	assert(keys != TSK_NULL);
+	assert(values != TSK_NULL);
+
+	const TskMapType *map_type_data = (const TskMapType *)map_type;
+	if (map_type_data->layout == TSK_MAP_LAYOUT_INTERLEAVED) {
+		TskU8 *slots = malloc((capacity * map_type_data->key_stride) + (tsk_map_groups_length(capacity) * TSK_MAP_GROUP_WIDTH));
+		if (slots == TSK_NULL) {
+			return TSK_FALSE;
+		}
+
+		*controls = slots + (capacity * map_type_data->key_stride);
+		*keys     = slots;
+		*values   = slots + map_type_data->value_offset;
+		tsk_map_controls_initialize(*controls, capacity);
+
+		return TSK_TRUE;
+	}
+
+	*controls = tsk_map_controls_new(capacity);
+	if (*controls == TSK_NULL) {
 		return TSK_FALSE;
 	}
 
-	TskAny *keys = TSK_NULL;
 	if (tsk_trait_complete_size(tsk_map_key_type(map_type)) == 0) {
-		keys = (TskAny *)tsk_trait_complete_alignment(tsk_map_key_type(map_type)); // NOLINT(performance-no-int-to-ptr)
+		*keys = (TskAny *)tsk_trait_complete_alignment(tsk_map_key_type(map_type)); // NOLINT(performance-no-int-to-ptr)
 	} else {
-		keys = malloc(capacity * tsk_trait_complete_size(tsk_map_key_type(map_type)));
-		if (keys == TSK_NULL) {
-			free(entries);
+		*keys = malloc(capacity * tsk_trait_complete_size(tsk_map_key_type(map_type)));
+		if (*keys == TSK_NULL) {
+			free(*controls);
 			return TSK_FALSE;
 		}
 	}
 
-	TskAny *values = TSK_NULL;
 	if (tsk_trait_complete_size(tsk_map_value_type(map_type)) == 0) {
-		values = (TskAny *)tsk_trait_complete_alignment(tsk_map_value_type(map_type)); // NOLINT(performance-no-int-to-ptr)
+		*values = (TskAny *)tsk_trait_complete_alignment(tsk_map_value_type(map_type)); // NOLINT(performance-no-int-to-ptr)
 	} else {
-		values = malloc(capacity * tsk_trait_complete_size(tsk_map_value_type(map_type)));
-		if (values == TSK_NULL) {
-			free(entries);
+		*values = malloc(capacity * tsk_trait_complete_size(tsk_map_value_type(map_type)));
+		if (*values == TSK_NULL) {
+			free(*controls);
 			if (tsk_trait_complete_size(tsk_map_key_type(map_type)) != 0) {
-				free(keys);
+				free(*keys);
 			}
 			return TSK_FALSE;
 		}
 	}
 
-	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map); i++) {
-		if (map->entries[i].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-			TskUSize index = map->entries[i].hash % capacity;
-			while (entries[index].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-				index = (index + 1) % capacity;
-			}
+	return TSK_TRUE;
+}
+static inline TskEmpty tsk_map_deallocate(const TskType *map_type, TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (tsk_map_layout(map_type) == TSK_MAP_LAYOUT_INTERLEAVED) {
+		free(map->keys);
+	} else {
+		free(map->controls);
+		if (tsk_trait_complete_size(tsk_map_key_type(map_type)) != 0) {
+			free(map->keys);
+		}
+		if (tsk_trait_complete_size(tsk_map_value_type(map_type)) != 0) {
+			free(map->values);
+		}
+	}
+
+	map->controls = TSK_NULL;
+	map->keys     = TSK_NULL;
+	map->values   = TSK_NULL;
+	map->capacity = 0;
+}
+static inline TskEmpty tsk_map_release_previous(const TskType *map_type, TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(map->previous != TSK_NULL && tsk_map_is_empty(map_type, map->previous));
+
+	tsk_map_deallocate(map_type, map->previous);
+	free(map->previous);
+
+	map->previous        = TSK_NULL;
+	map->migration_index = 0;
+}
+static inline TskEmpty tsk_map_migrate_at(const TskType *map_type, TskMap *map, TskUSize index) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(map->previous != TSK_NULL);
+	assert(index < tsk_map_capacity(map_type, map->previous));
+	assert(tsk_map_control_is_full(map->previous->controls[index]));
+
+	TskMap  *previous  = map->previous;
+
+	TskU64   hash      = tsk_map_hash_key(map_type, map, tsk_map_get_key_const(map_type, previous, index));
+	TskU8    control   = 0;
+	TskUSize new_index = tsk_map_prepare_insert(map_type, map, hash, &control);
+	tsk_map_insert_at(
+	    map_type,
+	    map,
+	    new_index,
+	    control,
+	    tsk_map_get_key(map_type, previous, index),
+	    tsk_map_get_value(map_type, previous, index)
+	);
+
+	tsk_map_erase(map_type, previous, index);
+	previous->length--;
+
+	if (tsk_map_is_empty(map_type, previous)) {
+		tsk_map_release_previous(map_type, map);
+	}
+}
+static inline TskEmpty tsk_map_migrate(const TskType *map_type, TskMap *map, TskUSize length) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	for (TskUSize i = 0; i < length && map->previous != TSK_NULL; i++) {
+		assert(map->migration_index < tsk_map_capacity(map_type, map->previous));
+
+		if (tsk_map_control_is_full(map->previous->controls[map->migration_index])) {
+			tsk_map_migrate_at(map_type, map, map->migration_index);
+		} else {
+			map->migration_index++;
+		}
+	}
+}
+static inline TskEmpty tsk_map_migrate_key(const TskType *map_type, TskMap *map, TskU64 hash, const TskAny *key) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+
+	TskUSize index = 0;
+	if (map->previous != TSK_NULL && tsk_map_find(map_type, map->previous, hash, key, TSK_NULL, &index)) {
+		tsk_map_migrate_at(map_type, map, index);
+	}
+}
+static inline TskBoolean tsk_map_reserve_incrementally(const TskType *map_type, TskMap *map, TskUSize capacity) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(map->previous == TSK_NULL);
+	assert(!tsk_map_is_empty(map_type, map));
+	assert(capacity >= tsk_map_length(map_type, map) && (capacity & (capacity - 1)) == 0);
+
+	TskMap *previous = malloc(sizeof(TskMap));
+	if (previous == TSK_NULL) {
+		return TSK_FALSE;
+	}
+
+	TskU8  *controls = TSK_NULL;
+	TskAny *keys     = TSK_NULL;
+	TskAny *values   = TSK_NULL;
+	if (!tsk_map_allocate(map_type, capacity, &controls, &keys, &values)) {
+		free(previous);
+		return TSK_FALSE;
+	}
+
+	*previous            = *map;
+
+	map->controls        = controls;
+	map->keys            = keys;
+	map->values          = values;
+	map->length          = 0;
+	map->deleted         = 0;
+	map->capacity        = capacity;
+	map->previous        = previous;
+	map->migration_index = 0;
+
+	return TSK_TRUE;
+}
+
+static inline TskBoolean tsk_map_resize(const TskType *map_type, TskMap *map, TskUSize capacity) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(capacity <= tsk_map_maximum_capacity(map_type));
+
+	tsk_map_migrate(map_type, map, SIZE_MAX);
+
+	if (capacity == 0) {
+		assert(tsk_map_is_empty(map_type, map));
+		tsk_map_deallocate(map_type, map);
+		map->deleted = 0;
+		return TSK_TRUE;
+	}
+
+	TskUSize power_of_two_capacity = 1;
+	while (power_of_two_capacity < capacity) {
+		power_of_two_capacity *= 2;
+	}
+	capacity         = power_of_two_capacity;
+
+	TskU8  *controls = TSK_NULL;
+	TskAny *keys     = TSK_NULL;
+	TskAny *values   = TSK_NULL;
+	if (!tsk_map_allocate(map_type, capacity, &controls, &keys, &values)) {
+		return TSK_FALSE;
+	}
+
+	TskMap new_map = {
+		.hasher_builder      = map->hasher_builder,
+		.hasher              = map->hasher,
+		.controls            = controls,
+		.keys                = keys,
+		.values              = values,
+		.length              = 0,
+		.deleted             = 0,
+		.capacity            = capacity,
+		.maximum_load_factor = map->maximum_load_factor,
+		.incremental_resize  = map->incremental_resize,
+		.automatic_shrink    = map->automatic_shrink,
+		.previous            = TSK_NULL,
+		.migration_index     = 0,
+	};
+
+	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map); i++) {
+		if (tsk_map_control_is_full(map->controls[i])) {
+			TskU64   hash    = tsk_map_hash_key(map_type, map, tsk_map_get_key_const(map_type, map, i));
+			TskU8    control = 0;
+			TskUSize index   = tsk_map_prepare_insert(map_type, &new_map, hash, &control);
+			tsk_map_insert_at(
+			    map_type,
+			    &new_map,
+			    index,
+			    control,
+			    tsk_map_get_key(map_type, map, i),
+			    tsk_map_get_value(map_type, map, i)
+			);
+		}
+	}
+	assert(tsk_map_length(map_type, &new_map) == tsk_map_length(map_type, map));
+
+	tsk_map_deallocate(map_type, map);
+
+	map->controls = controls;
+	map->keys     = keys;
+	map->values   = values;
+	map->deleted  = 0;
+	map->capacity = capacity;
+
+	return TSK_TRUE;
+}
+static inline TskUSize tsk_map_maximum_length(const TskType *map_type, const TskMap *map, TskUSize capacity) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return ((capacity / TSK_MAP_LOAD_FACTOR_ONE) * map->maximum_load_factor) +
+	       (((capacity % TSK_MAP_LOAD_FACTOR_ONE) * map->maximum_load_factor) / TSK_MAP_LOAD_FACTOR_ONE);
+}
+static inline TskUSize tsk_map_fitting_capacity(const TskType *map_type, const TskMap *map, TskUSize length) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (length == 0) {
+		return 0;
+	}
+
+	TskUSize capacity = 1;
+	while (tsk_map_maximum_length(map_type, map, capacity) < length) {
+		capacity *= 2;
+	}
+
+	return capacity;
+}
+static inline TskEmpty tsk_map_shrink_automatically(const TskType *map_type, TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (!map->automatic_shrink || map->previous != TSK_NULL ||
+	    tsk_map_length(map_type, map) >= tsk_map_maximum_length(map_type, map, tsk_map_capacity(map_type, map)) / 4) {
+		return;
+	}
+
+	TskUSize capacity = tsk_map_fitting_capacity(map_type, map, tsk_map_length(map_type, map) * 2);
+	if (capacity != 0 && capacity < TSK_MAP_SHRINK_MINIMUM_CAPACITY) {
+		capacity = TSK_MAP_SHRINK_MINIMUM_CAPACITY;
+	}
+
+	if (capacity >= tsk_map_capacity(map_type, map)) {
+		return;
+	}
+
+	if (map->incremental_resize && !tsk_map_is_empty(map_type, map)) {
+		(void)tsk_map_reserve_incrementally(map_type, map, capacity);
+		return;
+	}
+
+	(void)tsk_map_resize(map_type, map, capacity);
+}
+
+static inline TskUSize tsk_map_parallel_region_length(const TskType *map_type, const TskMap *map, TskUSize threads_length) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (threads_length > TSK_MAP_PARALLEL_MAXIMUM_THREADS) {
+		threads_length = TSK_MAP_PARALLEL_MAXIMUM_THREADS;
+	}
+	if (threads_length <= 1) {
+		return tsk_map_capacity(map_type, map);
+	}
+
+	TskUSize region_length = (tsk_map_capacity(map_type, map) + threads_length - 1) / threads_length;
+	if (region_length < TSK_MAP_PARALLEL_MINIMUM_REGION_LENGTH) {
+		region_length = TSK_MAP_PARALLEL_MINIMUM_REGION_LENGTH;
+	}
+	region_length = tsk_map_groups_length(region_length) * TSK_MAP_GROUP_WIDTH;
+	if (region_length > tsk_map_capacity(map_type, map)) {
+		region_length = tsk_map_capacity(map_type, map);
+	}
+
+	return region_length;
+}
+static inline TskUSize tsk_map_parallel_tasks(const TskType *map_type, TskMap *map, TskUSize region_length, TskMapParallelTask *tasks) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(region_length != 0);
+	assert(tasks != TSK_NULL);
+
+	TskUSize tasks_length = (tsk_map_capacity(map_type, map) + region_length - 1) / region_length;
+	assert(tasks_length <= TSK_MAP_PARALLEL_MAXIMUM_THREADS);
+
+	for (TskUSize i = 0; i < tasks_length; i++) {
+		tasks[i] = (TskMapParallelTask){
+			.map_type      = map_type,
+			.map           = map,
+			.region_length = region_length,
+			.start         = i * region_length,
+			.end           = (i + 1) * region_length,
+		};
+		if (tasks[i].end > tsk_map_capacity(map_type, map)) {
+			tasks[i].end = tsk_map_capacity(map_type, map);
+		}
+	}
+
+	return tasks_length;
+}
+static inline TskEmpty tsk_map_parallel_run(TskMapParallelTask *tasks, TskUSize tasks_length, void *(*function)(void *task)) {
+	assert(tasks != TSK_NULL);
+	assert(tasks_length != 0 && tasks_length <= TSK_MAP_PARALLEL_MAXIMUM_THREADS);
+	assert(function != TSK_NULL);
+
+	pthread_t  threads[TSK_MAP_PARALLEL_MAXIMUM_THREADS];
+	TskBoolean started[TSK_MAP_PARALLEL_MAXIMUM_THREADS];
+	for (TskUSize i = 1; i < tasks_length; i++) {
+		started[i] = pthread_create(&threads[i], TSK_NULL, function, &tasks[i]) == 0;
+	}
+
+	(void)function(&tasks[0]);
+
+	for (TskUSize i = 1; i < tasks_length; i++) {
+		if (started[i]) {
+			(void)pthread_join(threads[i], TSK_NULL);
+		} else {
+			(void)function(&tasks[i]);
+		}
+	}
+}
+static inline TskUSize tsk_map_parallel_region(const TskType *map_type, const TskMap *map, TskUSize region_length, TskU64 hash) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(region_length != 0);
+
+	return tsk_map_home_index(map_type, map, hash) / region_length;
+}
+static inline TskBoolean tsk_map_swiss_table_insert_in_region(const TskType *map_type, TskMap *map, TskMapParallelTask *task, TskU64 hash, TskAny *key, TskAny *value) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(task != TSK_NULL);
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	TskU8    h2           = tsk_map_hash_h2(hash);
+	TskUSize groups_mask  = tsk_map_groups_length(tsk_map_capacity(map_type, map)) - 1;
+	TskUSize group_index  = (TskUSize)tsk_map_hash_h1(hash) & groups_mask;
+	TskUSize insert_index = tsk_map_capacity(map_type, map);
+	for (TskUSize i = 0; i <= groups_mask; i++) {
+		if (group_index * TSK_MAP_GROUP_WIDTH < task->start || group_index * TSK_MAP_GROUP_WIDTH >= task->end) {
+			return TSK_FALSE;
+		}
+
+		const TskU8 *group = map->controls + (group_index * TSK_MAP_GROUP_WIDTH);
+		if (!task->unique) {
+			for (TskU32 mask = tsk_map_group_match(group, h2); mask != 0; mask &= mask - 1) {
+				TskUSize slot_index = (group_index * TSK_MAP_GROUP_WIDTH) + tsk_map_mask_first(mask);
+				if (tsk_map_key_equals(map_type, map, slot_index, key, TSK_NULL)) {
+					tsk_map_replace_at(map_type, map, slot_index, key, value);
+					return TSK_TRUE;
+				}
+			}
+		}
+		if (insert_index == tsk_map_capacity(map_type, map)) {
+			TskU32 mask = tsk_map_group_match_empty_or_deleted(group);
+			if (mask != 0) {
+				insert_index = (group_index * TSK_MAP_GROUP_WIDTH) + tsk_map_mask_first(mask);
+				if (task->unique) {
+					break;
+				}
+			}
+		}
+		if (tsk_map_group_match_empty(group) != 0) {
+			break;
+		}
+		group_index = (group_index + i + 1) & groups_mask;
+	}
+	assert(insert_index < tsk_map_capacity(map_type, map));
+
+	if (map->controls[insert_index] == TSK_MAP_CONTROL_DELETED) {
+		task->deleted++;
+	}
+	map->controls[insert_index] = h2;
+	task->length++;
+
+	memcpy(
+	    tsk_map_get_key(map_type, map, insert_index),
+	    key,
+	    tsk_trait_complete_size(tsk_map_key_type(map_type))
+	);
+	memcpy(
+	    tsk_map_get_value(map_type, map, insert_index),
+	    value,
+	    tsk_trait_complete_size(tsk_map_value_type(map_type))
+	);
+
+	return TSK_TRUE;
+}
+static inline TskBoolean tsk_map_robin_hood_insert_in_region(const TskType *map_type, TskMap *map, TskMapParallelTask *task, TskU64 hash, TskAny *key, TskAny *value) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(task != TSK_NULL);
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	TskUSize slot_index     = (TskUSize)tsk_map_hash_h1(hash) & (tsk_map_capacity(map_type, map) - 1);
+	TskUSize probe_distance = 0;
+	assert(task->start <= slot_index && slot_index < task->end);
+
+	while (tsk_map_control_is_full(map->controls[slot_index])) {
+		TskUSize slot_probe_distance = tsk_map_robin_hood_probe_distance(map_type, map, slot_index);
+		if (slot_probe_distance < probe_distance) {
+			break;
+		}
+
+		if (!task->unique && slot_probe_distance == probe_distance && tsk_map_key_equals(map_type, map, slot_index, key, TSK_NULL)) {
+			tsk_map_replace_at(map_type, map, slot_index, key, value);
+			return TSK_TRUE;
+		}
+
+		slot_index++;
+		probe_distance++;
+		if (slot_index >= task->end) {
+			return TSK_FALSE;
+		}
+	}
+
+	TskUSize empty_index = slot_index;
+	while (tsk_map_control_is_full(map->controls[empty_index])) {
+		empty_index++;
+		if (empty_index >= task->end) {
+			return TSK_FALSE;
+		}
+	}
+
+	tsk_map_robin_hood_make_room(map_type, map, slot_index);
+	map->controls[slot_index] = tsk_map_robin_hood_control(probe_distance);
+	task->length++;
+
+	memcpy(
+	    tsk_map_get_key(map_type, map, slot_index),
+	    key,
+	    tsk_trait_complete_size(tsk_map_key_type(map_type))
+	);
+	memcpy(
+	    tsk_map_get_value(map_type, map, slot_index),
+	    value,
+	    tsk_trait_complete_size(tsk_map_value_type(map_type))
+	);
+
+	return TSK_TRUE;
+}
+static void *tsk_map_parallel_task_hash(void *argument) {
+	TskMapParallelTask *task      = argument;
+	const TskType      *item_type = tsk_array_view_element_type(task->items_type);
+
+	for (TskUSize i = task->items_start; i < task->items_end; i++) {
+		const TskAny *key = tsk_tuple_get(item_type, tsk_array_view_get(task->items_type, task->items, i), 0);
+		task->hashes[i]   = tsk_map_hash_key(task->map_type, task->map, key);
+		task->counts[tsk_map_parallel_region(task->map_type, task->map, task->region_length, task->hashes[i])]++;
+	}
+
+	return TSK_NULL;
+}
+static void *tsk_map_parallel_task_scatter(void *argument) {
+	TskMapParallelTask *task = argument;
+
+	for (TskUSize i = task->items_start; i < task->items_end; i++) {
+		TskUSize region                     = tsk_map_parallel_region(task->map_type, task->map, task->region_length, task->hashes[i]);
+		task->order[task->counts[region]++] = i;
+	}
+
+	return TSK_NULL;
+}
+static void *tsk_map_parallel_task_insert(void *argument) {
+	TskMapParallelTask *task      = argument;
+	const TskType      *item_type = tsk_array_view_element_type(task->items_type);
+
+	for (TskUSize i = task->items_start; i < task->items_end; i++) {
+		TskUSize  item_index = task->order[i];
+		TskTuple *item       = tsk_array_view_get(task->items_type, task->items, item_index);
+		TskAny   *key        = tsk_tuple_get(item_type, item, 0);
+		TskAny   *value      = tsk_tuple_get(item_type, item, 1);
+
+		TskBoolean inserted  = TSK_FALSE;
+		switch (tsk_map_engine(task->map_type)) {
+			case TSK_MAP_ENGINE_SWISS_TABLE: inserted = tsk_map_swiss_table_insert_in_region(task->map_type, task->map, task, task->hashes[item_index], key, value); break;
+			case TSK_MAP_ENGINE_ROBIN_HOOD: inserted = tsk_map_robin_hood_insert_in_region(task->map_type, task->map, task, task->hashes[item_index], key, value); break;
+		}
+
+		if (!inserted) {
+			task->order[task->items_start + task->deferred] = item_index;
+			task->deferred++;
+		}
+	}
+
+	return TSK_NULL;
+}
+static void *tsk_map_parallel_task_drop(void *argument) {
+	TskMapParallelTask *task = argument;
+
+	for (TskUSize i = task->start; i < task->end; i++) {
+		if (tsk_map_control_is_full(task->map->controls[i])) {
+			tsk_trait_droppable_drop(
+			    tsk_map_key_type(task->map_type),
+			    tsk_map_get_key(task->map_type, task->map, i)
+			);
+			tsk_trait_droppable_drop(
+			    tsk_map_value_type(task->map_type),
+			    tsk_map_get_value(task->map_type, task->map, i)
+			);
+		}
+	}
+
+	return TSK_NULL;
+}
+static void *tsk_map_parallel_task_clone(void *argument) {
+	TskMapParallelTask *task = argument;
+
+	for (TskUSize i = task->start; i < task->end; i++) {
+		if (!tsk_map_control_is_full(task->source->controls[i])) {
+			continue;
+		}
+
+		if (!tsk_trait_clonable_clone(
+		        tsk_map_key_type(task->map_type),
+		        tsk_map_get_key_const(task->map_type, task->source, i),
+		        tsk_map_get_key(task->map_type, task->map, i)
+		    )) {
+			task->end    = i;
+			task->failed = TSK_TRUE;
+			break;
+		}
+
+		if (!tsk_trait_clonable_clone(
+		        tsk_map_value_type(task->map_type),
+		        tsk_map_get_value_const(task->map_type, task->source, i),
+		        tsk_map_get_value(task->map_type, task->map, i)
+		    )) {
+			tsk_trait_droppable_drop(
+			    tsk_map_key_type(task->map_type),
+			    tsk_map_get_key(task->map_type, task->map, i)
+			);
+			task->end    = i;
+			task->failed = TSK_TRUE;
+			break;
+		}
+
+		task->length++;
+	}
+
+	memcpy(task->map->controls + task->start, task->source->controls + task->start, task->end - task->start);
+
+	return TSK_NULL;
+}
+
+TskBoolean tsk_map_is_valid(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	return map != NULL &&
+	       ((map->controls != TSK_NULL && map->keys != TSK_NULL && map->values != TSK_NULL) || map->capacity == 0) &&
+	       (map->capacity & (map->capacity - 1)) == 0 &&
+	       map->hasher.builder_type != TSK_NULL &&
+	       map->maximum_load_factor > 0 && map->maximum_load_factor <= TSK_MAP_LOAD_FACTOR_ONE &&
+	       map->length + map->deleted <= map->capacity &&
+	       (map->previous == TSK_NULL || map->migration_index < map->previous->capacity);
+}
+TskMap tsk_map_new(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	TskMap map = {
+		.hasher_builder = {
+		    .type = TSK_NULL,
+		},
+		.hasher              = ((const TskMapType *)map_type)->default_hasher,
+		.controls            = TSK_NULL,
+		.keys                = TSK_NULL,
+		.values              = TSK_NULL,
+		.length              = 0,
+		.deleted             = 0,
+		.capacity            = 0,
+		.maximum_load_factor = TSK_MAP_DEFAULT_MAXIMUM_LOAD_FACTOR,
+		.incremental_resize  = TSK_FALSE,
+		.automatic_shrink    = TSK_FALSE,
+		.previous            = TSK_NULL,
+		.migration_index     = 0,
+	};
+
+	assert(tsk_map_is_valid(map_type, &map));
+
+	return map;
+}
+TskBoolean tsk_map_with_hasher_builder(const TskType *map_type, TskMap *map, const TskType *hasher_builder_type, TskAny *hasher_builder) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(map != TSK_NULL);
+	assert(tsk_type_is_valid(hasher_builder_type));
+	assert(tsk_type_has_trait(hasher_builder_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(hasher_builder_type, TSK_TRAIT_ID_BUILDER));
+	assert(tsk_type_has_trait(tsk_trait_builder_built_type(hasher_builder_type), TSK_TRAIT_ID_HASHER));
+	assert(hasher_builder != TSK_NULL);
+
+	if (!tsk_value_new(&map->hasher_builder, hasher_builder_type)) {
+		return TSK_FALSE;
+	}
+
+	memcpy(
+	    tsk_value_data(&map->hasher_builder),
+	    hasher_builder,
+	    tsk_trait_complete_size(hasher_builder_type)
+	);
+	map->hasher              = tsk_map_hasher_new(hasher_builder_type);
+	map->controls            = TSK_NULL;
+	map->keys                = TSK_NULL;
+	map->values              = TSK_NULL;
+	map->length              = 0;
+	map->deleted             = 0;
+	map->capacity            = 0;
+	map->maximum_load_factor = TSK_MAP_DEFAULT_MAXIMUM_LOAD_FACTOR;
+	map->incremental_resize  = TSK_FALSE;
+	map->automatic_shrink    = TSK_FALSE;
+	map->previous            = TSK_NULL;
+	map->migration_index     = 0;
+
+	assert(tsk_map_is_valid(map_type, map));
+
+	return TSK_TRUE;
+}
+TskEmpty tsk_map_drop(const TskType *map_type, TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	tsk_map_clear(map_type, map);
+
+	if (tsk_value_is_valid(&map->hasher_builder)) {
+		tsk_value_drop(&map->hasher_builder);
+	}
+
+	tsk_map_deallocate(map_type, map);
+}
+TskBoolean tsk_map_clone(const TskType *map_type, const TskMap *map_1, TskMap *map_2) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map_1));
+	assert(map_2 != TSK_NULL);
+
+	TskMap map;
+	if (!tsk_map_clone_empty(map_type, map_1, &map)) {
+		return TSK_FALSE;
+	}
+
+	if (tsk_map_is_empty(map_type, map_1)) {
+		*map_2 = map;
+		return TSK_TRUE;
+	}
+
+	if (!tsk_map_reserve(map_type, &map, tsk_map_capacity(map_type, map_1))) {
+		tsk_map_drop(map_type, &map);
+		return TSK_FALSE;
+	}
+	assert(tsk_map_capacity(map_type, &map) == tsk_map_capacity(map_type, map_1));
+
+	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map_1); i++) {
+		if (tsk_map_control_is_full(map_1->controls[i])) {
+			if (!tsk_trait_clonable_clone(
+			        tsk_map_key_type(map_type),
+			        tsk_map_get_key_const(map_type, map_1, i),
+			        tsk_map_get_key(map_type, &map, i)
+			    )) {
+				tsk_map_drop(map_type, &map);
+				return TSK_FALSE;
+			}
+
+			if (!tsk_trait_clonable_clone(
+			        tsk_map_value_type(map_type),
+			        tsk_map_get_value_const(map_type, map_1, i),
+			        tsk_map_get_value(map_type, &map, i)
+			    )) {
+				tsk_trait_droppable_drop(
+				    tsk_map_key_type(map_type),
+				    tsk_map_get_key(map_type, &map, i)
+				);
+				tsk_map_drop(map_type, &map);
+				return TSK_FALSE;
+			}
+
+			map.length++;
+		}
+		map.controls[i] = map_1->controls[i];
+	}
+	map.deleted = map_1->deleted;
+
+	if (map_1->previous != TSK_NULL) {
+		for (TskUSize i = 0; i < tsk_map_capacity(map_type, map_1->previous); i++) {
+			if (tsk_map_control_is_full(map_1->previous->controls[i])) {
+				const TskAny *key     = tsk_map_get_key_const(map_type, map_1->previous, i);
+				TskU64        hash    = tsk_map_hash_key(map_type, &map, key);
+				TskU8         control = 0;
+				TskUSize      index   = tsk_map_prepare_insert(map_type, &map, hash, &control);
+				tsk_map_occupy(map_type, &map, index, control);
+
+				if (!tsk_trait_clonable_clone(
+				        tsk_map_key_type(map_type),
+				        key,
+				        tsk_map_get_key(map_type, &map, index)
+				    )) {
+					tsk_map_erase(map_type, &map, index);
+					map.length--;
+					tsk_map_drop(map_type, &map);
+					return TSK_FALSE;
+				}
+
+				if (!tsk_trait_clonable_clone(
+				        tsk_map_value_type(map_type),
+				        tsk_map_get_value_const(map_type, map_1->previous, i),
+				        tsk_map_get_value(map_type, &map, index)
+				    )) {
+					tsk_trait_droppable_drop(
+					    tsk_map_key_type(map_type),
+					    tsk_map_get_key(map_type, &map, index)
+					);
+					tsk_map_erase(map_type, &map, index);
+					map.length--;
+					tsk_map_drop(map_type, &map);
+					return TSK_FALSE;
+				}
+			}
+		}
+	}
+
+	*map_2 = map;
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_parallel_clone(const TskType *map_type, const TskMap *map_1, TskMap *map_2, TskUSize threads_length) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map_1));
+	assert(map_2 != TSK_NULL);
+
+	TskUSize region_length = tsk_map_parallel_region_length(map_type, map_1, threads_length);
+	if (map_1->previous != TSK_NULL || region_length == tsk_map_capacity(map_type, map_1)) {
+		return tsk_map_clone(map_type, map_1, map_2);
+	}
+
+	TskMap map;
+	if (!tsk_map_clone_empty(map_type, map_1, &map)) {
+		return TSK_FALSE;
+	}
+
+	if (!tsk_map_reserve(map_type, &map, tsk_map_capacity(map_type, map_1))) {
+		tsk_map_drop(map_type, &map);
+		return TSK_FALSE;
+	}
+	assert(tsk_map_capacity(map_type, &map) == tsk_map_capacity(map_type, map_1));
+
+	TskMapParallelTask tasks[TSK_MAP_PARALLEL_MAXIMUM_THREADS];
+	TskUSize           tasks_length = tsk_map_parallel_tasks(map_type, &map, region_length, tasks);
+	for (TskUSize i = 0; i < tasks_length; i++) {
+		tasks[i].source = map_1;
+	}
+
+	tsk_map_parallel_run(tasks, tasks_length, tsk_map_parallel_task_clone);
+
+	TskBoolean failed = TSK_FALSE;
+	for (TskUSize i = 0; i < tasks_length; i++) {
+		map.length += tasks[i].length;
+		failed = failed || tasks[i].failed;
+	}
+
+	if (failed) {
+		tsk_map_drop(map_type, &map);
+		return TSK_FALSE;
+	}
+
+	map.deleted = map_1->deleted;
+
+	*map_2      = map;
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_clone_empty(const TskType *map_type, const TskMap *map_1, TskMap *map_2) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map_1));
+	assert(map_2 != TSK_NULL);
+
+	TskMap map = tsk_map_new(map_type);
+	if (tsk_value_is_valid(&map_1->hasher_builder)) {
+		const TskType             *hasher_builder_type = tsk_value_type(&map_1->hasher_builder);
+		alignas(max_align_t) TskU8 hasher_builder[tsk_trait_complete_size(hasher_builder_type)];
+		if (!tsk_trait_clonable_clone(
+		        hasher_builder_type,
+		        tsk_value_data_const(&map_1->hasher_builder),
+		        hasher_builder
+		    )) {
+			return TSK_FALSE;
+		}
+
+		if (!tsk_map_with_hasher_builder(map_type, &map, hasher_builder_type, hasher_builder)) {
+			tsk_trait_droppable_drop(hasher_builder_type, hasher_builder);
+			return TSK_FALSE;
+		}
+	}
+
+	map.maximum_load_factor = map_1->maximum_load_factor;
+	map.incremental_resize  = map_1->incremental_resize;
+	map.automatic_shrink    = map_1->automatic_shrink;
+
+	*map_2                  = map;
+
+	return TSK_TRUE;
+}
+const TskType *tsk_map_key_type(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	return ((const TskMapType *)map_type)->key_type;
+}
+const TskType *tsk_map_value_type(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	return ((const TskMapType *)map_type)->value_type;
+}
+const TskType *tsk_map_item_type(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	return tsk_tuple_type(
+	    (const TskType *[]){
+	        tsk_map_key_type(map_type),
+	        tsk_map_value_type(map_type),
+	    },
+	    2
+	);
+}
+TskUSize tsk_map_length(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (map->previous != TSK_NULL) {
+		return map->length + map->previous->length;
+	}
+
+	return map->length;
+}
+TskBoolean tsk_map_is_empty(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return tsk_map_length(map_type, map) == 0;
+}
+TskUSize tsk_map_capacity(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return map->capacity;
+}
+TskUSize tsk_map_maximum_capacity(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	TskUSize key_stride       = ((const TskMapType *)map_type)->key_stride;
+	TskUSize value_stride     = ((const TskMapType *)map_type)->value_stride;
+
+	TskUSize maximum_size     = key_stride > value_stride ? key_stride : value_stride;
+	maximum_size              = maximum_size > 1 ? maximum_size : 1;
+
+	TskUSize maximum_capacity = 1;
+	while (maximum_capacity <= ((SIZE_MAX - TSK_MAP_GROUP_WIDTH) / maximum_size) / 2) {
+		maximum_capacity *= 2;
+	}
+
+	return maximum_capacity;
+}
+TskF32 tsk_map_load_factor(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (tsk_map_capacity(map_type, map) == 0) {
+		return 0.0F;
+	}
+
+	return (TskF32)tsk_map_length(map_type, map) / (TskF32)tsk_map_capacity(map_type, map);
+}
+TskF32 tsk_map_maximum_load_factor(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return (TskF32)map->maximum_load_factor / (TskF32)TSK_MAP_LOAD_FACTOR_ONE;
+}
+TskBoolean tsk_map_set_maximum_load_factor(const TskType *map_type, TskMap *map, TskF32 maximum_load_factor) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(maximum_load_factor > 0.0F && maximum_load_factor <= 1.0F);
+
+	TskU32 previous_maximum_load_factor = map->maximum_load_factor;
+	map->maximum_load_factor            = (TskU32)((maximum_load_factor * (TskF32)TSK_MAP_LOAD_FACTOR_ONE) + 0.5F);
+	if (map->maximum_load_factor == 0) {
+		map->maximum_load_factor = 1;
+	}
+
+	if (!tsk_map_reserve_additional(map_type, map, 0)) {
+		map->maximum_load_factor = previous_maximum_load_factor;
+		return TSK_FALSE;
+	}
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_incremental_resize(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return map->incremental_resize;
+}
+TskEmpty tsk_map_set_incremental_resize(const TskType *map_type, TskMap *map, TskBoolean incremental_resize) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (!incremental_resize) {
+		tsk_map_migrate(map_type, map, SIZE_MAX);
+	}
+
+	map->incremental_resize = incremental_resize;
+}
+TskBoolean tsk_map_automatic_shrink(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return map->automatic_shrink;
+}
+TskEmpty tsk_map_set_automatic_shrink(const TskType *map_type, TskMap *map, TskBoolean automatic_shrink) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	map->automatic_shrink = automatic_shrink;
+
+	tsk_map_shrink_automatically(map_type, map);
+}
+TskBoolean tsk_map_is_resizing(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return map->previous != TSK_NULL;
+}
+TskU64 tsk_map_hash(const TskType *map_type, const TskMap *map, const TskType *hashable_type, const TskAny *hashable) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_type_is_valid(hashable_type));
+	assert(tsk_type_has_trait(hashable_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(hashable_type, TSK_TRAIT_ID_HASHABLE));
+	assert(hashable != TSK_NULL);
+
+	if (hashable_type == tsk_map_key_type(map_type)) {
+		return tsk_map_hash_key(map_type, map, hashable);
+	}
+
+	return tsk_map_hash_hashable(
+	    map_type,
+	    map,
+	    hashable_type,
+	    tsk_type_trait(hashable_type, TSK_TRAIT_ID_HASHABLE),
+	    tsk_type_layout(hashable_type),
+	    hashable
+	);
+}
+TskAny *tsk_map_get(const TskType *map_type, TskMap *map, const TskAny *key) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return TSK_NULL;
+	}
+
+	return tsk_map_get_with_hash(map_type, map, key, tsk_map_hash_key(map_type, map, key));
+}
+TskAny *tsk_map_get_with_hash(const TskType *map_type, TskMap *map, const TskAny *key, TskU64 hash) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(hash == tsk_map_hash_key(map_type, map, key));
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return TSK_NULL;
+	}
+
+	TskUSize index = 0;
+	if (!tsk_map_find_slot(map_type, map, hash, key, TSK_NULL, &index)) {
+		return TSK_NULL;
+	}
+
+	TskMap *table = tsk_map_slot_table(map_type, map, &index);
+	return tsk_map_get_value(map_type, table, index);
+}
+TskAny *tsk_map_get_heterogeneous(const TskType *map_type, TskMap *map, const TskAny *key, TskU64 hash, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2)) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(equals != TSK_NULL);
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return TSK_NULL;
+	}
+
+	TskUSize index = 0;
+	if (!tsk_map_find_slot(map_type, map, hash, key, equals, &index)) {
+		return TSK_NULL;
+	}
+
+	TskMap *table = tsk_map_slot_table(map_type, map, &index);
+	return tsk_map_get_value(map_type, table, index);
+}
+const TskAny *tsk_map_get_const(const TskType *map_type, const TskMap *map, const TskAny *key) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return TSK_NULL;
+	}
+
+	return tsk_map_get_const_with_hash(map_type, map, key, tsk_map_hash_key(map_type, map, key));
+}
+const TskAny *tsk_map_get_const_with_hash(const TskType *map_type, const TskMap *map, const TskAny *key, TskU64 hash) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(hash == tsk_map_hash_key(map_type, map, key));
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return TSK_NULL;
+	}
+
+	TskUSize index = 0;
+	if (!tsk_map_find_slot(map_type, map, hash, key, TSK_NULL, &index)) {
+		return TSK_NULL;
+	}
+
+	const TskMap *table = tsk_map_slot_table_const(map_type, map, &index);
+	return tsk_map_get_value_const(map_type, table, index);
+}
+const TskAny *tsk_map_key_const(const TskType *map_type, const TskMap *map, const TskAny *key) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return TSK_NULL;
+	}
+
+	TskUSize index = 0;
+	if (!tsk_map_find_slot(map_type, map, tsk_map_hash_key(map_type, map, key), key, TSK_NULL, &index)) {
+		return TSK_NULL;
+	}
+
+	const TskMap *table = tsk_map_slot_table_const(map_type, map, &index);
+	return tsk_map_get_key_const(map_type, table, index);
+}
+const TskAny *tsk_map_get_const_heterogeneous(const TskType *map_type, const TskMap *map, const TskAny *key, TskU64 hash, TskBoolean (*equals)(const TskAny *key_1, const TskAny *key_2)) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(equals != TSK_NULL);
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return TSK_NULL;
+	}
+
+	TskUSize index = 0;
+	if (!tsk_map_find_slot(map_type, map, hash, key, equals, &index)) {
+		return TSK_NULL;
+	}
+
+	const TskMap *table = tsk_map_slot_table_const(map_type, map, &index);
+	return tsk_map_get_value_const(map_type, table, index);
+}
+TskUSize tsk_map_get_many(const TskType *map_type, TskMap *map, TskArrayViewConst keys, TskArrayView values) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_array_view_const_is_valid(tsk_array_view_const_type(tsk_map_key_type(map_type)), keys));
+	assert(tsk_array_view_is_valid(tsk_array_view_type(tsk_reference_type(tsk_map_value_type(map_type))), values));
+	assert(tsk_array_view_const_length(tsk_array_view_const_type(tsk_map_key_type(map_type)), keys) == tsk_array_view_length(tsk_array_view_type(tsk_reference_type(tsk_map_value_type(map_type))), values));
+
+	const TskType *keys_type   = tsk_array_view_const_type(tsk_map_key_type(map_type));
+	const TskType *values_type = tsk_array_view_type(tsk_reference_type(tsk_map_value_type(map_type)));
+
+	if (tsk_map_is_empty(map_type, map)) {
+		for (TskUSize i = 0; i < tsk_array_view_length(values_type, values); i++) {
+			*(TskAny **)tsk_array_view_get(values_type, values, i) = TSK_NULL;
+		}
+		return 0;
+	}
+
+	TskUSize found = 0;
+	for (TskUSize start = 0; start < tsk_array_view_length(values_type, values);) {
+		TskUSize indices[TSK_MAP_FIND_MANY_BATCH_LENGTH];
+		TskUSize length = tsk_map_find_many(map_type, map, keys_type, keys, start, indices);
+		for (TskUSize i = 0; i < length; i++) {
+			TskAny *value = TSK_NULL;
+			if (indices[i] != tsk_map_slots_length(map_type, map)) {
+				TskMap *table = tsk_map_slot_table(map_type, map, &indices[i]);
+				value         = tsk_map_get_value(map_type, table, indices[i]);
+				found++;
+			}
+			*(TskAny **)tsk_array_view_get(values_type, values, start + i) = value;
+		}
+		start += length;
+	}
+
+	return found;
+}
+TskUSize tsk_map_get_many_const(const TskType *map_type, const TskMap *map, TskArrayViewConst keys, TskArrayView values) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_array_view_const_is_valid(tsk_array_view_const_type(tsk_map_key_type(map_type)), keys));
+	assert(tsk_array_view_is_valid(tsk_array_view_type(tsk_reference_const_type(tsk_map_value_type(map_type))), values));
+	assert(tsk_array_view_const_length(tsk_array_view_const_type(tsk_map_key_type(map_type)), keys) == tsk_array_view_length(tsk_array_view_type(tsk_reference_const_type(tsk_map_value_type(map_type))), values));
+
+	const TskType *keys_type   = tsk_array_view_const_type(tsk_map_key_type(map_type));
+	const TskType *values_type = tsk_array_view_type(tsk_reference_const_type(tsk_map_value_type(map_type)));
+
+	if (tsk_map_is_empty(map_type, map)) {
+		for (TskUSize i = 0; i < tsk_array_view_length(values_type, values); i++) {
+			*(const TskAny **)tsk_array_view_get(values_type, values, i) = TSK_NULL;
+		}
+		return 0;
+	}
+
+	TskUSize found = 0;
+	for (TskUSize start = 0; start < tsk_array_view_length(values_type, values);) {
+		TskUSize indices[TSK_MAP_FIND_MANY_BATCH_LENGTH];
+		TskUSize length = tsk_map_find_many(map_type, map, keys_type, keys, start, indices);
+		for (TskUSize i = 0; i < length; i++) {
+			const TskAny *value = TSK_NULL;
+			if (indices[i] != tsk_map_slots_length(map_type, map)) {
+				const TskMap *table = tsk_map_slot_table_const(map_type, map, &indices[i]);
+				value               = tsk_map_get_value_const(map_type, table, indices[i]);
+				found++;
+			}
+			*(const TskAny **)tsk_array_view_get(values_type, values, start + i) = value;
+		}
+		start += length;
+	}
+
+	return found;
+}
+TskEmpty tsk_map_prefetch_with_hash(const TskType *map_type, const TskMap *map, TskU64 hash) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return;
+	}
+
+	TskUSize index = tsk_map_home_index(map_type, map, hash);
+	tsk_map_prefetch(map->controls + index);
+	tsk_map_prefetch(tsk_map_get_key_const(map_type, map, index));
+}
+TskBoolean tsk_map_next_key(const TskType *map_type, const TskMap *map, TskUSize *index, const TskAny **key) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(index != TSK_NULL);
+	assert(key != TSK_NULL);
+
+	if (!tsk_map_next_full_slot(map_type, map, index)) {
+		return TSK_FALSE;
+	}
+
+	TskUSize      table_index = *index;
+	const TskMap *table       = tsk_map_slot_table_const(map_type, map, &table_index);
+	*key                      = tsk_map_get_key_const(map_type, table, table_index);
+
+	(*index)++;
+
+	return TSK_TRUE;
+}
+TskEmpty tsk_map_clear(const TskType *map_type, TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+	assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+
+	if (!tsk_type_layout(tsk_map_key_type(map_type))->is_trivially_droppable || !tsk_type_layout(tsk_map_value_type(map_type))->is_trivially_droppable) {
+		for (TskUSize i = 0; i < tsk_map_slots_length(map_type, map); i++) {
+			TskUSize index = i;
+			TskMap  *table = tsk_map_slot_table(map_type, map, &index);
+			if (tsk_map_control_is_full(table->controls[index])) {
+				tsk_trait_droppable_drop(
+				    tsk_map_key_type(map_type),
+				    tsk_map_get_key(map_type, table, index)
+				);
+				tsk_trait_droppable_drop(
+				    tsk_map_value_type(map_type),
+				    tsk_map_get_value(map_type, table, index)
+				);
+			}
+		}
+	}
+
+	if (map->previous != TSK_NULL) {
+		map->previous->length = 0;
+		tsk_map_release_previous(map_type, map);
+	}
+
+	if (tsk_map_capacity(map_type, map) != 0) {
+		memset(map->controls, TSK_MAP_CONTROL_EMPTY, tsk_map_capacity(map_type, map));
+	}
+
+	map->length  = 0;
+	map->deleted = 0;
+
+	tsk_map_shrink_automatically(map_type, map);
+}
+TskEmpty tsk_map_parallel_clear(const TskType *map_type, TskMap *map, TskUSize threads_length) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+	assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+
+	TskUSize region_length = tsk_map_parallel_region_length(map_type, map, threads_length);
+	if (map->previous != TSK_NULL || region_length == tsk_map_capacity(map_type, map)) {
+		tsk_map_clear(map_type, map);
+		return;
+	}
+
+	TskMapParallelTask tasks[TSK_MAP_PARALLEL_MAXIMUM_THREADS];
+	TskUSize           tasks_length = tsk_map_parallel_tasks(map_type, map, region_length, tasks);
+	tsk_map_parallel_run(tasks, tasks_length, tsk_map_parallel_task_drop);
+
+	memset(map->controls, TSK_MAP_CONTROL_EMPTY, tsk_map_capacity(map_type, map));
+
+	map->length  = 0;
+	map->deleted = 0;
+
+	tsk_map_shrink_automatically(map_type, map);
+}
+TskBoolean tsk_map_reserve(const TskType *map_type, TskMap *map, TskUSize capacity) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (capacity <= tsk_map_capacity(map_type, map)) {
+		return TSK_TRUE;
+	}
+
+	if (capacity > tsk_map_maximum_capacity(map_type)) {
+		return TSK_FALSE;
+	}
+
+	return tsk_map_resize(map_type, map, capacity);
+}
+TskBoolean tsk_map_reserve_additional(const TskType *map_type, TskMap *map, TskUSize additional) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	if (additional <= tsk_map_capacity(map_type, map) - tsk_map_length(map_type, map) &&
+	    tsk_map_maximum_length(map_type, map, tsk_map_capacity(map_type, map)) >= tsk_map_length(map_type, map) + map->deleted + additional) {
+		return TSK_TRUE;
+	}
+
+	TskUSize maximum_capacity = tsk_map_maximum_capacity(map_type);
+	if (additional > maximum_capacity - tsk_map_length(map_type, map)) {
+		return TSK_FALSE;
+	}
+
+	tsk_map_migrate(map_type, map, SIZE_MAX);
+
+	if (map->deleted != 0 &&
+	    tsk_map_maximum_length(map_type, map, tsk_map_capacity(map_type, map) - (tsk_map_capacity(map_type, map) / 8)) >= tsk_map_length(map_type, map) + additional) {
+		if (map->incremental_resize) {
+			return tsk_map_reserve_incrementally(map_type, map, tsk_map_capacity(map_type, map));
+		}
+
+		tsk_map_rehash_in_place(map_type, map);
+		return TSK_TRUE;
+	}
+
+	TskUSize capacity = tsk_map_capacity(map_type, map);
+	do {
+		if (capacity == 0) {
+			capacity = 1;
+		} else if (capacity > maximum_capacity / 2) {
+			capacity = maximum_capacity;
+			break;
+		} else {
+			capacity *= 2;
+		}
+	} while (tsk_map_maximum_length(map_type, map, capacity) < tsk_map_length(map_type, map) + additional);
+	assert(capacity >= tsk_map_length(map_type, map) + additional);
+
+	if (map->incremental_resize && !tsk_map_is_empty(map_type, map)) {
+		return tsk_map_reserve_incrementally(map_type, map, capacity);
+	}
+
+	return tsk_map_reserve(map_type, map, capacity);
+}
+TskBoolean tsk_map_shrink_to_fit(const TskType *map_type, TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	return tsk_map_shrink_to(map_type, map, 0);
+}
+TskBoolean tsk_map_shrink_to(const TskType *map_type, TskMap *map, TskUSize capacity) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	tsk_map_migrate(map_type, map, SIZE_MAX);
+
+	TskUSize minimum_capacity = tsk_map_fitting_capacity(map_type, map, tsk_map_length(map_type, map));
+	if (capacity < minimum_capacity) {
+		capacity = minimum_capacity;
+	}
+
+	if (capacity >= tsk_map_capacity(map_type, map)) {
+		return TSK_TRUE;
+	}
+
+	TskUSize power_of_two_capacity = capacity != 0 ? 1 : 0;
+	while (power_of_two_capacity < capacity) {
+		power_of_two_capacity *= 2;
+	}
+	capacity = power_of_two_capacity;
+
+	if (capacity == tsk_map_capacity(map_type, map)) {
+		return TSK_TRUE;
+	}
+
+	return tsk_map_resize(map_type, map, capacity);
+}
+TskBoolean tsk_map_insert(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	return tsk_map_insert_with_hash(map_type, map, key, value, tsk_map_hash_key(map_type, map, key));
+}
+TskBoolean tsk_map_insert_with_hash(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value, TskU64 hash) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+	assert(hash == tsk_map_hash_key(map_type, map, key));
+
+	if (!tsk_map_reserve_additional(map_type, map, 1)) {
+		return TSK_FALSE;
+	}
+
+	tsk_map_migrate(map_type, map, TSK_MAP_MIGRATE_LENGTH);
+	tsk_map_migrate_key(map_type, map, hash, key);
+
+	TskUSize index   = 0;
+	TskU8    control = 0;
+	if (tsk_map_find_or_prepare_insert(map_type, map, hash, key, &index, &control)) {
+		tsk_map_replace_at(map_type, map, index, key, value);
+		return TSK_TRUE;
+	}
+
+	tsk_map_insert_at(map_type, map, index, control, key, value);
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_extend(const TskType *map_type, TskMap *map, TskArrayView items, TskBoolean unique) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_array_view_is_valid(tsk_array_view_type(tsk_map_item_type(map_type)), items));
+
+	const TskType *items_type = tsk_array_view_type(tsk_map_item_type(map_type));
+
+	if (tsk_array_view_is_empty(items_type, items)) {
+		return TSK_TRUE;
+	}
+
+	if (!tsk_map_reserve_additional(map_type, map, tsk_array_view_length(items_type, items))) {
+		return TSK_FALSE;
+	}
+
+	tsk_map_migrate(map_type, map, SIZE_MAX);
+
+	for (TskUSize start = 0; start < tsk_array_view_length(items_type, items);) {
+		start += tsk_map_insert_many(map_type, map, items_type, items, start, unique);
+	}
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_extend_from_iterator(const TskType *map_type, TskMap *map, const TskType *iterator_type, TskAny *iterator, TskBoolean unique) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_type_has_trait(iterator_type, TSK_TRAIT_ID_ITERATOR));
+	assert(tsk_map_item_is_convertible(map_type, tsk_trait_iterator_item_type(iterator_type)));
+	assert(iterator != TSK_NULL);
+
+	const TskType *item_type   = tsk_map_item_type(map_type);
+	const TskType *items_type  = tsk_array_type(item_type);
+	const TskType *source_type = tsk_trait_iterator_item_type(iterator_type);
+
+	TskArray items             = tsk_array_new(items_type);
+	alignas(max_align_t) TskU8 source[tsk_trait_complete_size(source_type)];
+	alignas(max_align_t) TskU8 item[tsk_trait_complete_size(item_type)];
+	while (tsk_trait_iterator_next(iterator_type, iterator, source)) {
+		if (!tsk_map_item_convert(map_type, source_type, source, item)) {
+			tsk_array_drop(items_type, &items);
+			return TSK_FALSE;
+		}
+		if (!tsk_array_push_back(items_type, &items, item)) {
+			tsk_tuple_drop(item_type, item);
+			tsk_array_drop(items_type, &items);
+			return TSK_FALSE;
+		}
+	}
+
+	if (!tsk_map_extend(map_type, map, tsk_array_view(items_type, &items), unique)) {
+		tsk_array_drop(items_type, &items);
+		return TSK_FALSE;
+	}
+
+	items.length = 0;
+	tsk_array_drop(items_type, &items);
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_from_iterator(const TskType *map_type, TskMap *map, const TskType *iterator_type, TskAny *iterator, TskBoolean unique) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(map != TSK_NULL);
+	assert(tsk_type_has_trait(iterator_type, TSK_TRAIT_ID_ITERATOR));
+	assert(tsk_map_item_is_convertible(map_type, tsk_trait_iterator_item_type(iterator_type)));
+	assert(iterator != TSK_NULL);
+
+	*map = tsk_map_new(map_type);
+	if (!tsk_map_extend_from_iterator(map_type, map, iterator_type, iterator, unique)) {
+		tsk_map_drop(map_type, map);
+		return TSK_FALSE;
+	}
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_parallel_extend(const TskType *map_type, TskMap *map, TskArrayView items, TskBoolean unique, TskUSize threads_length) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(tsk_array_view_is_valid(tsk_array_view_type(tsk_map_item_type(map_type)), items));
+
+	const TskType *items_type = tsk_array_view_type(tsk_map_item_type(map_type));
+	const TskType *item_type  = tsk_map_item_type(map_type);
+
+	TskUSize length           = tsk_array_view_length(items_type, items);
+	if (length == 0) {
+		return TSK_TRUE;
+	}
+
+	if (!tsk_map_reserve_additional(map_type, map, length)) {
+		return TSK_FALSE;
+	}
+
+	tsk_map_migrate(map_type, map, SIZE_MAX);
+
+	TskUSize region_length = tsk_map_parallel_region_length(map_type, map, threads_length);
+	if (region_length == tsk_map_capacity(map_type, map)) {
+		return tsk_map_extend(map_type, map, items, unique);
+	}
+
+	TskMapParallelTask tasks[TSK_MAP_PARALLEL_MAXIMUM_THREADS];
+	TskUSize           tasks_length = tsk_map_parallel_tasks(map_type, map, region_length, tasks);
+
+	TskU64            *hashes       = malloc(length * sizeof(TskU64));
+	TskUSize          *order        = malloc(length * sizeof(TskUSize));
+	TskUSize          *counts       = calloc(tasks_length * tasks_length, sizeof(TskUSize));
+	if (hashes == TSK_NULL || order == TSK_NULL || counts == TSK_NULL) {
+		free(counts);
+		free(order);
+		free(hashes);
+		return tsk_map_extend(map_type, map, items, unique);
+	}
+
+	for (TskUSize i = 0; i < tasks_length; i++) {
+		tasks[i].items_type  = items_type;
+		tasks[i].items       = items;
+		tasks[i].hashes      = hashes;
+		tasks[i].order       = order;
+		tasks[i].counts      = counts + (i * tasks_length);
+		tasks[i].items_start = (i * length) / tasks_length;
+		tasks[i].items_end   = ((i + 1) * length) / tasks_length;
+		tasks[i].unique      = unique;
+	}
 
-			entries[index] = map->entries[i];
-			memcpy(
-			    (TskU8 *)keys + (index * tsk_trait_complete_size(tsk_map_key_type(map_type))),
-			    tsk_map_get_key_const(map_type, map, i),
-			    tsk_trait_complete_size(tsk_map_key_type(map_type))
-			);
-			memcpy(
-			    (TskU8 *)values + (index * tsk_trait_complete_size(tsk_map_value_type(map_type))),
-			    tsk_map_get_value_const(map_type, map, i),
-			    tsk_trait_complete_size(tsk_map_value_type(map_type))
-			);
+	tsk_map_parallel_run(tasks, tasks_length, tsk_map_parallel_task_hash);
+
+	TskUSize region_starts[TSK_MAP_PARALLEL_MAXIMUM_THREADS + 1];
+	TskUSize offset = 0;
+	for (TskUSize region = 0; region < tasks_length; region++) {
+		region_starts[region] = offset;
+		for (TskUSize i = 0; i < tasks_length; i++) {
+			TskUSize count                      = counts[(i * tasks_length) + region];
+			counts[(i * tasks_length) + region] = offset;
+			offset += count;
 		}
 	}
+	region_starts[tasks_length] = offset;
+	assert(offset == length);
 
-	free(map->entries);
-	if (tsk_trait_complete_size(tsk_map_key_type(map_type)) != 0) {
-		free(map->keys);
+	tsk_map_parallel_run(tasks, tasks_length, tsk_map_parallel_task_scatter);
+
+	for (TskUSize i = 0; i < tasks_length; i++) {
+		tasks[i].items_start = region_starts[i];
+		tasks[i].items_end   = region_starts[i + 1];
 	}
-	if (tsk_trait_complete_size(tsk_map_value_type(map_type)) != 0) {
-		free(map->values);
+
+	tsk_map_parallel_run(tasks, tasks_length, tsk_map_parallel_task_insert);
+
+	for (TskUSize i = 0; i < tasks_length; i++) {
+		map->length += tasks[i].length;
+		map->deleted -= tasks[i].deleted;
 	}
 
-	map->entries  = entries;
-	map->keys     = keys;
-	map->values   = values;
-	map->capacity = capacity;
+	for (TskUSize i = 0; i < tasks_length; i++) {
+		for (TskUSize j = tasks[i].items_start; j < tasks[i].items_start + tasks[i].deferred; j++) {
+			TskTuple *item = tsk_array_view_get(items_type, items, order[j]);
+			tsk_map_insert_hashed(map_type, map, hashes[order[j]], tsk_tuple_get(item_type, item, 0), tsk_tuple_get(item_type, item, 1), unique);
+		}
+	}
+
+	free(counts);
+	free(order);
+	free(hashes);
 
 	return TSK_TRUE;
 }
-TskBoolean tsk_map_reserve_additional(const TskType *map_type, TskMap *map, TskUSize additional) {
+TskAny *tsk_map_get_or_insert(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
 
-	TskUSize maximum_capacity = tsk_map_maximum_capacity(map_type);
-	if (additional > maximum_capacity - tsk_map_length(map_type, map)) {
-		return TSK_FALSE;
-	}
-
-	if ((TskF32)tsk_map_capacity(map_type, map) >= (TskF32)(tsk_map_length(map_type, map) + additional) / tsk_map_maximum_load_factor(map_type)) {
-		assert(tsk_map_capacity(map_type, map) >= tsk_map_length(map_type, map) + additional);
-		return TSK_TRUE;
-	}
-
-	TskUSize capacity = tsk_map_capacity(map_type, map);
-	do {
-		if (capacity == 0) {
-			capacity = 1;
-		} else if (capacity > maximum_capacity / 2) {
-			capacity = maximum_capacity;
-			break;
-		} else {
-			capacity *= 2;
-		}
-	} while ((TskF32)capacity < (TskF32)(tsk_map_length(map_type, map) + additional) / tsk_map_maximum_load_factor(map_type));
-	assert(capacity >= tsk_map_length(map_type, map) + additional);
-
-	return tsk_map_reserve(map_type, map, capacity);
+	return tsk_map_get_or_insert_with_hash(map_type, map, key, value, tsk_map_hash_key(map_type, map, key));
 }
-TskBoolean tsk_map_insert(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value) {
+TskAny *tsk_map_get_or_insert_with_hash(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value, TskU64 hash) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
 	assert(key != TSK_NULL);
 	assert(value != TSK_NULL);
+	assert(hash == tsk_map_hash_key(map_type, map, key));
 
 	if (!tsk_map_reserve_additional(map_type, map, 1)) {
-		return TSK_FALSE;
+		return TSK_NULL;
 	}
 
-	TskU64   hash           = tsk_map_hash_key(map_type, map, key);
-	TskUSize starting_index = hash % tsk_map_capacity(map_type, map);
-	TskUSize index          = starting_index;
-	while (map->entries[index].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-		if (map->entries[index].hash == hash &&
-		    tsk_trait_equatable_equals(
-		        tsk_map_key_type(map_type),
-		        tsk_map_get_key_const(map_type, map, index),
-		        key
-		    )) {
-			assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
-			assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
-
-			tsk_trait_droppable_drop(
-			    tsk_map_key_type(map_type),
-			    key
-			);
-			tsk_trait_droppable_drop(
-			    tsk_map_value_type(map_type),
-			    tsk_map_get_value(map_type, map, index)
-			);
-			memcpy(
-			    tsk_map_get_value(map_type, map, index),
-			    value,
-			    tsk_trait_complete_size(tsk_map_value_type(map_type))
-			);
-
-			return TSK_TRUE;
-		}
-		index = (index + 1) % tsk_map_capacity(map_type, map);
-		if (index == starting_index) {
-			return TSK_FALSE;
-		}
+	tsk_map_migrate(map_type, map, TSK_MAP_MIGRATE_LENGTH);
+	tsk_map_migrate_key(map_type, map, hash, key);
+
+	TskUSize index   = 0;
+	TskU8    control = 0;
+	if (tsk_map_find_or_prepare_insert(map_type, map, hash, key, &index, &control)) {
+		assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+		assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+
+		tsk_trait_droppable_drop(
+		    tsk_map_key_type(map_type),
+		    key
+		);
+		tsk_trait_droppable_drop(
+		    tsk_map_value_type(map_type),
+		    value
+		);
+
+		return tsk_map_get_value(map_type, map, index);
 	}
 
-	map->entries[index].hash  = hash;
-	map->entries[index].state = TSK_MAP_ENTRY_STATE_OCCUPIED;
-
-	memcpy(
-	    tsk_map_get_key(map_type, map, index),
-	    key,
-	    tsk_trait_complete_size(tsk_map_key_type(map_type))
-	);
-	memcpy(
-	    tsk_map_get_value(map_type, map, index),
-	    value,
-	    tsk_trait_complete_size(tsk_map_value_type(map_type))
-	);
+	tsk_map_insert_at(map_type, map, index, control, key, value);
 
-	map->length++;
+	return tsk_map_get_value(map_type, map, index);
+}
+TskBoolean tsk_map_entry(const TskType *map_type, TskMap *map, const TskAny *key, TskMapEntry *entry) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(entry != TSK_NULL);
 
-	return TSK_TRUE;
+	return tsk_map_entry_with_hash(map_type, map, key, tsk_map_hash_key(map_type, map, key), entry);
 }
-TskAny *tsk_map_get_or_insert(const TskType *map_type, TskMap *map, TskAny *key, TskAny *value) {
+TskBoolean tsk_map_entry_with_hash(const TskType *map_type, TskMap *map, const TskAny *key, TskU64 hash, TskMapEntry *entry) {
 	assert(tsk_map_type_is_valid(map_type));
 	assert(tsk_map_is_valid(map_type, map));
 	assert(key != TSK_NULL);
-	assert(value != TSK_NULL);
+	assert(hash == tsk_map_hash_key(map_type, map, key));
+	assert(entry != TSK_NULL);
 
 	if (!tsk_map_reserve_additional(map_type, map, 1)) {
-		return TSK_NULL;
+		return TSK_FALSE;
 	}
 
-	TskU64   hash           = tsk_map_hash_key(map_type, map, key);
-	TskUSize starting_index = hash % tsk_map_capacity(map_type, map);
-	TskUSize index          = starting_index;
-	while (map->entries[index].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-		if (map->entries[index].hash == hash &&
-		    tsk_trait_equatable_equals(
-		        tsk_map_key_type(map_type),
-		        tsk_map_get_key_const(map_type, map, index),
-		        key
-		    )) {
-			assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
-			assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+	tsk_map_migrate(map_type, map, TSK_MAP_MIGRATE_LENGTH);
+	tsk_map_migrate_key(map_type, map, hash, key);
 
-			tsk_trait_droppable_drop(
-			    tsk_map_key_type(map_type),
-			    key
-			);
-			tsk_trait_droppable_drop(
-			    tsk_map_value_type(map_type),
-			    value
-			);
+	TskUSize   index    = 0;
+	TskU8      control  = 0;
+	TskBoolean occupied = tsk_map_find_or_prepare_insert(map_type, map, hash, key, &index, &control);
 
-			return tsk_map_get_value(map_type, map, index);
-		}
-		index = (index + 1) % tsk_map_capacity(map_type, map);
-		if (index == starting_index) {
-			return TSK_FALSE;
-		}
-	}
+	*entry              = (TskMapEntry){
+		.map      = map,
+		.hash     = hash,
+		.index    = index,
+		.control  = control,
+		.occupied = occupied,
+	};
 
-	map->entries[index].hash  = hash;
-	map->entries[index].state = TSK_MAP_ENTRY_STATE_OCCUPIED;
+	return TSK_TRUE;
+}
+TskBoolean tsk_map_entry_is_valid(const TskType *map_type, const TskMapEntry *entry) {
+	return tsk_map_type_is_valid(map_type) &&
+	       entry != TSK_NULL &&
+	       tsk_map_is_valid(map_type, entry->map) &&
+	       entry->index < tsk_map_capacity(map_type, entry->map) &&
+	       (entry->occupied ? tsk_map_control_is_full(entry->map->controls[entry->index])
+	                        : tsk_map_engine(map_type) == TSK_MAP_ENGINE_ROBIN_HOOD || !tsk_map_control_is_full(entry->map->controls[entry->index]));
+}
+TskBoolean tsk_map_entry_is_occupied(const TskType *map_type, const TskMapEntry *entry) {
+	assert(tsk_map_entry_is_valid(map_type, entry));
 
-	memcpy(
-	    tsk_map_get_key(map_type, map, index),
-	    key,
-	    tsk_trait_complete_size(tsk_map_key_type(map_type))
-	);
-	memcpy(
-	    tsk_map_get_value(map_type, map, index),
-	    value,
-	    tsk_trait_complete_size(tsk_map_value_type(map_type))
-	);
+	return entry->occupied;
+}
+const TskAny *tsk_map_entry_key(const TskType *map_type, const TskMapEntry *entry) {
+	assert(tsk_map_entry_is_valid(map_type, entry));
+	assert(tsk_map_entry_is_occupied(map_type, entry));
 
-	map->length++;
+	return tsk_map_get_key_const(map_type, entry->map, entry->index);
+}
+TskAny *tsk_map_entry_value(const TskType *map_type, TskMapEntry *entry) {
+	assert(tsk_map_entry_is_valid(map_type, entry));
+	assert(tsk_map_entry_is_occupied(map_type, entry));
 
-	return tsk_map_get_value(map_type, map, index);
+	return tsk_map_get_value(map_type, entry->map, entry->index);
+}
+TskAny *tsk_map_entry_insert(const TskType *map_type, TskMapEntry *entry, TskAny *key, TskAny *value) {
+	assert(tsk_map_entry_is_valid(map_type, entry));
+	assert(!tsk_map_entry_is_occupied(map_type, entry));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+	assert(entry->hash == tsk_map_hash_key(map_type, entry->map, key));
+
+	tsk_map_insert_at(map_type, entry->map, entry->index, entry->control, key, value);
+	entry->occupied = TSK_TRUE;
+
+	return tsk_map_get_value(map_type, entry->map, entry->index);
 }
 TskBoolean tsk_map_remove(const TskType *map_type, TskMap *map, const TskAny *key, TskAny *value) {
 	assert(tsk_map_type_is_valid(map_type));
@@ -596,53 +2672,58 @@ TskBoolean tsk_map_remove(const TskType *map_type, TskMap *map, const TskAny *ke
 	assert(key != TSK_NULL);
 	assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
 
+	return tsk_map_remove_with_hash(map_type, map, key, value, tsk_map_hash_key(map_type, map, key));
+}
+TskBoolean tsk_map_remove_with_hash(const TskType *map_type, TskMap *map, const TskAny *key, TskAny *value, TskU64 hash) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+	assert(key != TSK_NULL);
+	assert(tsk_type_has_trait(tsk_map_key_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+	assert(hash == tsk_map_hash_key(map_type, map, key));
+
 	if (tsk_map_is_empty(map_type, map)) {
 		return TSK_FALSE;
 	}
 
-	TskU64   hash           = tsk_map_hash_key(map_type, map, key);
-	TskUSize starting_index = hash % tsk_map_capacity(map_type, map);
-	TskUSize index          = starting_index;
-	while (map->entries[index].state != TSK_MAP_ENTRY_STATE_EMPTY) {
-		if (map->entries[index].state == TSK_MAP_ENTRY_STATE_OCCUPIED &&
-		    map->entries[index].hash == hash &&
-		    tsk_trait_equatable_equals(
-		        tsk_map_key_type(map_type),
-		        tsk_map_get_key_const(map_type, map, index),
-		        key
-		    )) {
-			map->entries[index].state = TSK_MAP_ENTRY_STATE_DELETED;
+	tsk_map_migrate(map_type, map, TSK_MAP_MIGRATE_LENGTH);
 
-			tsk_trait_droppable_drop(
-			    tsk_map_key_type(map_type),
-			    tsk_map_get_key(map_type, map, index)
-			);
+	TskUSize index = 0;
+	if (!tsk_map_find_slot(map_type, map, hash, key, TSK_NULL, &index)) {
+		return TSK_FALSE;
+	}
 
-			if (value != TSK_NULL) {
-				memcpy(
-				    value,
-				    tsk_map_get_value_const(map_type, map, index),
-				    tsk_trait_complete_size(tsk_map_value_type(map_type))
-				);
-			} else {
-				assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
-				tsk_trait_droppable_drop(
-				    tsk_map_value_type(map_type),
-				    tsk_map_get_value(map_type, map, index)
-				);
-			}
+	TskMap *table = tsk_map_slot_table(map_type, map, &index);
 
-			map->length--;
+	tsk_trait_droppable_drop(
+	    tsk_map_key_type(map_type),
+	    tsk_map_get_key(map_type, table, index)
+	);
 
-			return TSK_TRUE;
-		}
-		index = (index + 1) % tsk_map_capacity(map_type, map);
-		if (index == starting_index) {
-			break;
-		}
+	if (value != TSK_NULL) {
+		memcpy(
+		    value,
+		    tsk_map_get_value_const(map_type, table, index),
+		    tsk_trait_complete_size(tsk_map_value_type(map_type))
+		);
+	} else {
+		assert(tsk_type_has_trait(tsk_map_value_type(map_type), TSK_TRAIT_ID_DROPPABLE));
+		tsk_trait_droppable_drop(
+		    tsk_map_value_type(map_type),
+		    tsk_map_get_value(map_type, table, index)
+		);
 	}
 
-	return TSK_FALSE;
+	tsk_map_erase(map_type, table, index);
+
+	table->length--;
+
+	if (table == map->previous && tsk_map_is_empty(map_type, table)) {
+		tsk_map_release_previous(map_type, map);
+	}
+
+	tsk_map_shrink_automatically(map_type, map);
+
+	return TSK_TRUE;
 }
 TskBoolean tsk_map_equals(const TskType *map_type, const TskMap *map_1, const TskMap *map_2) {
 	assert(tsk_map_type_is_valid(map_type));
@@ -654,21 +2735,28 @@ TskBoolean tsk_map_equals(const TskType *map_type, const TskMap *map_1, const Ts
 		return TSK_FALSE;
 	}
 
-	for (TskUSize i = 0; i < tsk_map_capacity(map_type, map_1); i++) {
-		if (map_1->entries[i].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-			const TskAny *key_1   = tsk_map_get_key_const(map_type, map_1, i);
-			const TskAny *value_1 = tsk_map_get_value_const(map_type, map_1, i);
+	const TskTypeLayout *value_layout = tsk_type_layout(tsk_map_value_type(map_type));
+	for (TskUSize i = 0; i < tsk_map_slots_length(map_type, map_1); i++) {
+		TskUSize      index = i;
+		const TskMap *table = tsk_map_slot_table_const(map_type, map_1, &index);
+		if (tsk_map_control_is_full(table->controls[index])) {
+			const TskAny *key_1   = tsk_map_get_key_const(map_type, table, index);
+			const TskAny *value_1 = tsk_map_get_value_const(map_type, table, index);
 
 			const TskAny *value_2 = tsk_map_get_const(map_type, map_2, key_1);
 			if (value_2 == TSK_NULL) {
 				return TSK_FALSE;
 			}
 
-			if (!tsk_trait_equatable_equals(
-			        tsk_map_value_type(map_type),
-			        value_1,
-			        value_2
-			    )) {
+			if (value_layout->is_bitwise_equatable) {
+				if (memcmp(value_1, value_2, value_layout->size) != 0) {
+					return TSK_FALSE;
+				}
+			} else if (!tsk_trait_equatable_equals(
+			               tsk_map_value_type(map_type),
+			               value_1,
+			               value_2
+			           )) {
 				return TSK_FALSE;
 			}
 		}
@@ -676,6 +2764,36 @@ TskBoolean tsk_map_equals(const TskType *map_type, const TskMap *map_1, const Ts
 
 	return TSK_TRUE;
 }
+TskMapStatistics tsk_map_statistics(const TskType *map_type, const TskMap *map) {
+	assert(tsk_map_type_is_valid(map_type));
+	assert(tsk_map_is_valid(map_type, map));
+
+	TskMapStatistics statistics = {
+		.maximum_probe_distance = 0,
+		.average_probe_distance = 0.0F,
+	};
+
+	if (tsk_map_is_empty(map_type, map)) {
+		return statistics;
+	}
+
+	TskUSize total_probe_distance = 0;
+	for (TskUSize i = 0; i < tsk_map_slots_length(map_type, map); i++) {
+		TskUSize      index = i;
+		const TskMap *table = tsk_map_slot_table_const(map_type, map, &index);
+		if (tsk_map_control_is_full(table->controls[index])) {
+			TskUSize probe_distance = tsk_map_probe_distance(map_type, table, index);
+			if (probe_distance > statistics.maximum_probe_distance) {
+				statistics.maximum_probe_distance = probe_distance;
+			}
+			total_probe_distance += probe_distance;
+		}
+	}
+	statistics.average_probe_distance = (TskF32)total_probe_distance / (TskF32)tsk_map_length(map_type, map);
+
+	return statistics;
+}
+
 
 TskEmpty tsk_map_type_trait_droppable_drop(const TskType *droppable_type, TskAny *droppable) {
 	tsk_map_drop(droppable_type, droppable);
@@ -687,13 +2805,13 @@ TskBoolean tsk_map_type_trait_equatable_equals(const TskType *equatable_type, co
 	return tsk_map_equals(equatable_type, equatable_1, equatable_2);
 }
 const TskType *tsk_map_type_trait_iterable_iterator_type(const TskType *iterable_type) {
-	return tsk_map_iterator_type(tsk_map_key_type(iterable_type), tsk_map_value_type(iterable_type));
+	return tsk_map_iterator_type_with_map_type(iterable_type);
 }
 TskEmpty tsk_map_type_trait_iterable_iterator(const TskType *iterable_type, TskAny *iterable, TskAny *iterator) {
 	*(TskMapIterator *)iterator = tsk_map_iterator(iterable_type, iterable);
 }
 const TskType *tsk_map_type_trait_iterable_const_iterator_type(const TskType *iterable_type) {
-	return tsk_map_iterator_const_type(tsk_map_key_type(iterable_type), tsk_map_value_type(iterable_type));
+	return tsk_map_iterator_const_type_with_map_type(iterable_type);
 }
 TskEmpty tsk_map_type_trait_iterable_const_iterator(const TskType *iterable_type, const TskAny *iterable, TskAny *iterator) {
 	*(TskMapIteratorConst *)iterator = tsk_map_iterator_const(iterable_type, iterable);
@@ -721,21 +2839,59 @@ const TskTraitIterableConst tsk_map_type_trait_iterable_const = {
 	.iterator      = tsk_map_type_trait_iterable_const_iterator,
 };
 
-#define TSK_MAP_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_map_types_registry = TSK_TYPE_REGISTRY(sizeof(TskMapType));
 
-TskMapType tsk_map_types[TSK_MAP_TYPES_CAPACITY];
+static inline TskBoolean tsk_map_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskMapType *map_type_entry  = entry;
+	const TskMapTypeKey *map_type_key = key;
+	return map_type_entry->key_type == map_type_key->key_type &&
+	       map_type_entry->value_type == map_type_key->value_type &&
+	       map_type_entry->engine == map_type_key->engine &&
+	       map_type_entry->layout == map_type_key->layout;
+}
 
 TskBoolean tsk_map_type_is_valid(const TskType *map_type) {
 	return tsk_type_is_valid(map_type) &&
-	       &tsk_map_types[0] <= (const TskMapType *)map_type && (const TskMapType *)map_type < &tsk_map_types[TSK_MAP_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_map_types_registry, map_type);
+}
+TskMapEngine tsk_map_engine(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	return ((const TskMapType *)map_type)->engine;
+}
+TskMapLayout tsk_map_layout(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
+	return ((const TskMapType *)map_type)->layout;
 }
 const TskType *tsk_map_type(const TskType *key_type, const TskType *value_type) {
+	return tsk_map_type_with_engine(key_type, value_type, TSK_MAP_ENGINE_SWISS_TABLE);
+}
+const TskType *tsk_map_type_with_engine(const TskType *key_type, const TskType *value_type, TskMapEngine engine) {
+	assert(tsk_type_is_valid(key_type));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_EQUATABLE));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_HASHABLE));
+	assert(tsk_type_is_valid(value_type));
+	assert(tsk_type_has_trait(value_type, TSK_TRAIT_ID_COMPLETE));
+
+	TskMapLayout layout = TSK_MAP_LAYOUT_SPLIT;
+	if (tsk_trait_complete_size(key_type) != 0 &&
+	    tsk_trait_complete_size(key_type) <= TSK_MAP_INTERLEAVED_MAXIMUM_KEY_SIZE &&
+	    tsk_trait_complete_size(value_type) <= TSK_MAP_INTERLEAVED_MAXIMUM_VALUE_SIZE) {
+		layout = TSK_MAP_LAYOUT_INTERLEAVED;
+	}
+
+	return tsk_map_type_with_layout(key_type, value_type, engine, layout);
+}
+const TskType *tsk_map_type_with_layout(const TskType *key_type, const TskType *value_type, TskMapEngine engine, TskMapLayout layout) {
 	assert(tsk_type_is_valid(key_type));
 	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_COMPLETE));
 	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_EQUATABLE));
 	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_HASHABLE));
 	assert(tsk_type_is_valid(value_type));
 	assert(tsk_type_has_trait(value_type, TSK_TRAIT_ID_COMPLETE));
+	assert(layout == TSK_MAP_LAYOUT_SPLIT || tsk_trait_complete_size(key_type) != 0);
 
 	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
 	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
@@ -743,70 +2899,105 @@ const TskType *tsk_map_type(const TskType *key_type, const TskType *value_type)
 
 	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&key_type, sizeof(key_type));     // NOLINT(bugprone-sizeof-expression)
 	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&value_type, sizeof(value_type)); // NOLINT(bugprone-sizeof-expression)
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&engine, sizeof(engine));
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&layout, sizeof(layout));
 	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_MAP_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_map_types[index].key_type != TSK_NULL) {
-		if (tsk_map_types[index].key_type == key_type && tsk_map_types[index].value_type == value_type) {
-			return &tsk_map_types[index].map_type;
-		}
-		index = (index + 1) & (TSK_MAP_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_map_types_registry, hash, tsk_map_types_equals, &(TskMapTypeKey){ .key_type = key_type, .value_type = value_type, .engine = engine, .layout = layout }, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskMapType *)entry)->map_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_map_types[index].map_type.trait_table                                                                                           = &tsk_map_types[index].map_type_trait_table;
-	tsk_map_types[index].map_type_trait_table.entries                                                                                   = tsk_map_types[index].map_type_trait_table_entries;
-	tsk_map_types[index].map_type_trait_table.capacity                                                                                  = sizeof(tsk_map_types[index].map_type_trait_table_entries) / sizeof(tsk_map_types[index].map_type_trait_table_entries[0]);
+	TskMapType *map_type_entry                                          = entry;
 
-	tsk_map_types[index].map_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE & (tsk_map_types[index].map_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	map_type_entry->map_type.trait_table                                = &map_type_entry->map_type_trait_table;
+	map_type_entry->map_type.layout                                     = &map_type_entry->map_type_layout;
+	map_type_entry->map_type_trait_table.entries                        = map_type_entry->map_type_trait_table_entries;
+	map_type_entry->map_type_trait_table.capacity                       = 0;
+
+	map_type_entry->map_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_COMPLETE,
 		.trait_data = &tsk_map_type_trait_complete,
 	};
 	if (tsk_type_has_trait(key_type, TSK_TRAIT_ID_DROPPABLE) && tsk_type_has_trait(value_type, TSK_TRAIT_ID_DROPPABLE)) {
-		tsk_map_types[index].map_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE & (tsk_map_types[index].map_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		map_type_entry->map_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
 			.trait_data = &tsk_map_type_trait_droppable,
 		};
 	}
 	if (tsk_type_has_trait(key_type, TSK_TRAIT_ID_CLONABLE) && tsk_type_has_trait(value_type, TSK_TRAIT_ID_CLONABLE)) {
-		tsk_map_types[index].map_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE & (tsk_map_types[index].map_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		map_type_entry->map_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_CLONABLE,
 			.trait_data = &tsk_map_type_trait_clonable,
 		};
 	}
 	if (tsk_type_has_trait(key_type, TSK_TRAIT_ID_EQUATABLE) && tsk_type_has_trait(value_type, TSK_TRAIT_ID_EQUATABLE)) {
-		tsk_map_types[index].map_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE & (tsk_map_types[index].map_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		map_type_entry->map_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_EQUATABLE,
 			.trait_data = &tsk_map_type_trait_equatable,
 		};
 	}
-	tsk_map_types[index].map_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE & (tsk_map_types[index].map_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	map_type_entry->map_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_ITERABLE,
 		.trait_data = &tsk_map_type_trait_iterable,
 	};
-	tsk_map_types[index].map_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE_CONST & (tsk_map_types[index].map_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	map_type_entry->map_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE_CONST] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_ITERABLE_CONST,
 		.trait_data = &tsk_map_type_trait_iterable_const,
 	};
 
-	tsk_map_types[index].key_type   = key_type;
-	tsk_map_types[index].value_type = value_type;
+	map_type_entry->key_type           = key_type;
+	map_type_entry->value_type         = value_type;
+	map_type_entry->engine             = engine;
+	map_type_entry->layout             = layout;
+	map_type_entry->key_hashable_trait = tsk_type_trait(key_type, TSK_TRAIT_ID_HASHABLE);
+	map_type_entry->key_layout         = tsk_type_layout(key_type);
+	map_type_entry->default_hasher     = tsk_map_hasher_new(tsk_default_hasher_builder_type);
+
+	switch (layout) {
+		case TSK_MAP_LAYOUT_SPLIT:
+			map_type_entry->key_stride   = tsk_trait_complete_size(key_type);
+			map_type_entry->value_offset = 0;
+			map_type_entry->value_stride = tsk_trait_complete_size(value_type);
+			break;
+		case TSK_MAP_LAYOUT_INTERLEAVED: {
+			TskUSize alignment = tsk_trait_complete_alignment(key_type);
+			if (alignment < tsk_trait_complete_alignment(value_type)) {
+				alignment = tsk_trait_complete_alignment(value_type);
+			}
+
+			TskUSize value_offset        = tsk_trait_complete_size(key_type);
+			value_offset                 = (value_offset + tsk_trait_complete_alignment(value_type) - 1) / tsk_trait_complete_alignment(value_type) * tsk_trait_complete_alignment(value_type);
+			TskUSize slot_size           = value_offset + tsk_trait_complete_size(value_type);
+			slot_size                    = (slot_size + alignment - 1) / alignment * alignment;
+
+			map_type_entry->key_stride   = slot_size;
+			map_type_entry->value_offset = value_offset;
+			map_type_entry->value_stride = slot_size;
+			break;
+		}
+	}
 
 	(void)snprintf(
-	    tsk_map_types[index].map_type_name,
-	    sizeof(tsk_map_types[index].map_type_name),
-	    "TskMap<%s, %s>",
+	    map_type_entry->map_type_name,
+	    sizeof(map_type_entry->map_type_name),
+	    "Tsk%s%sMap<%s, %s>",
+	    layout == TSK_MAP_LAYOUT_INTERLEAVED ? "Interleaved" : "",
+	    engine == TSK_MAP_ENGINE_ROBIN_HOOD ? "RobinHood" : "",
 	    tsk_type_name(key_type),
 	    tsk_type_name(value_type)
 	);
-	tsk_map_types[index].map_type.name = tsk_map_types[index].map_type_name;
+	map_type_entry->map_type.name = map_type_entry->map_type_name;
 
-	const TskType *map_type            = &tsk_map_types[index].map_type;
+	const TskType *map_type       = &map_type_entry->map_type;
+
+	(void)tsk_type_layout(map_type);
+
+	tsk_type_registry_publish(&tsk_map_types_registry, entry);
 
 	assert(tsk_map_type_is_valid(map_type));
 
@@ -816,15 +3007,22 @@ const TskType *tsk_map_type(const TskType *key_type, const TskType *value_type)
 typedef struct TskMapIteratorType TskMapIteratorType;
 struct TskMapIteratorType {
 	TskType        map_iterator_type;
-	TskCharacter   map_iterator_type_name[40];
+	TskCharacter   map_iterator_type_name[64];
+	const TskType *map_type;
 	const TskType *key_type;
 	const TskType *value_type;
+	const TskType *item_type;
 };
 
 TskBoolean tsk_map_iterator_is_valid(const TskType *map_iterator_type, const TskMapIterator *map_iterator) {
 	assert(tsk_map_iterator_type_is_valid(map_iterator_type));
 
-	return map_iterator != TSK_NULL && tsk_map_is_valid(tsk_map_type(tsk_map_iterator_key_type(map_iterator_type), tsk_map_iterator_value_type(map_iterator_type)), map_iterator->map);
+	return map_iterator != TSK_NULL && tsk_map_is_valid(tsk_map_iterator_map_type(map_iterator_type), map_iterator->map);
+}
+const TskType *tsk_map_iterator_map_type(const TskType *map_iterator_type) {
+	assert(tsk_map_iterator_type_is_valid(map_iterator_type));
+
+	return ((const TskMapIteratorType *)map_iterator_type)->map_type;
 }
 const TskType *tsk_map_iterator_key_type(const TskType *map_iterator_type) {
 	assert(tsk_map_iterator_type_is_valid(map_iterator_type));
@@ -839,45 +3037,30 @@ const TskType *tsk_map_iterator_value_type(const TskType *map_iterator_type) {
 const TskType *tsk_map_iterator_item_type(const TskType *map_iterator_type) {
 	assert(tsk_map_iterator_type_is_valid(map_iterator_type));
 
-	return tsk_tuple_type(
-	    (const TskType *[]){
-	        tsk_reference_const_type(tsk_map_iterator_key_type(map_iterator_type)),
-	        tsk_reference_type(tsk_map_iterator_value_type(map_iterator_type)),
-	    },
-	    2
-	);
+	return ((const TskMapIteratorType *)map_iterator_type)->item_type;
 }
 TskBoolean tsk_map_iterator_next(const TskType *map_iterator_type, TskMapIterator *map_iterator, TskTuple *item) {
 	assert(tsk_map_iterator_type_is_valid(map_iterator_type));
 	assert(tsk_map_iterator_is_valid(map_iterator_type, map_iterator));
 
-	const TskType *map_type  = tsk_map_type(tsk_map_iterator_key_type(map_iterator_type), tsk_map_iterator_value_type(map_iterator_type));
+	const TskType *map_type  = tsk_map_iterator_map_type(map_iterator_type);
 	const TskType *item_type = tsk_map_iterator_item_type(map_iterator_type);
 
-	while (map_iterator->index < tsk_map_capacity(map_type, map_iterator->map)) {
-		if (map_iterator->map->entries[map_iterator->index].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-			const TskAny *key   = tsk_map_get_key_const(map_type, map_iterator->map, map_iterator->index);
-			TskAny       *value = tsk_map_get_value(map_type, map_iterator->map, map_iterator->index);
+	if (!tsk_map_next_full_slot(map_type, map_iterator->map, &map_iterator->index)) {
+		return TSK_FALSE;
+	}
 
-			memcpy(
-			    tsk_tuple_get(item_type, item, 0),
-			    &key,
-			    tsk_trait_complete_size(tsk_tuple_element_type(item_type, 0))
-			);
-			memcpy(
-			    tsk_tuple_get(item_type, item, 1),
-			    &value,
-			    tsk_trait_complete_size(tsk_tuple_element_type(item_type, 1))
-			);
+	TskUSize      index = map_iterator->index;
+	TskMap       *table = tsk_map_slot_table(map_type, map_iterator->map, &index);
+	const TskAny *key   = tsk_map_get_key_const(map_type, table, index);
+	TskAny       *value = tsk_map_get_value(map_type, table, index);
 
-			map_iterator->index++;
+	memcpy(tsk_tuple_get(item_type, item, 0), &key, sizeof(key));
+	memcpy(tsk_tuple_get(item_type, item, 1), &value, sizeof(value));
 
-			return TSK_TRUE;
-		}
-		map_iterator->index++;
-	}
+	map_iterator->index++;
 
-	return TSK_FALSE;
+	return TSK_TRUE;
 }
 
 const TskType *tsk_map_iterator_type_trait_iterator_item_type(const TskType *iterator_type) {
@@ -909,13 +3092,16 @@ TSK_TYPE(tsk_map_iterator_type_, TskMapIterator,
 );
 // clang-format on
 
-#define TSK_MAP_ITERATOR_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_map_iterator_types_registry = TSK_TYPE_REGISTRY(sizeof(TskMapIteratorType));
 
-TskMapIteratorType tsk_map_iterator_types[TSK_MAP_ITERATOR_TYPES_CAPACITY];
+static inline TskBoolean tsk_map_iterator_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskMapIteratorType *map_iterator_type_entry = entry;
+	return map_iterator_type_entry->map_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_map_iterator_type_is_valid(const TskType *map_iterator_type) {
 	return tsk_type_is_valid(map_iterator_type) &&
-	       &tsk_map_iterator_types[0] <= (const TskMapIteratorType *)map_iterator_type && (const TskMapIteratorType *)map_iterator_type < &tsk_map_iterator_types[TSK_MAP_ITERATOR_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_map_iterator_types_registry, map_iterator_type);
 }
 const TskType *tsk_map_iterator_type(const TskType *key_type, const TskType *value_type) {
 	assert(tsk_type_is_valid(key_type));
@@ -925,42 +3111,55 @@ const TskType *tsk_map_iterator_type(const TskType *key_type, const TskType *val
 	assert(tsk_type_is_valid(value_type));
 	assert(tsk_type_has_trait(value_type, TSK_TRAIT_ID_COMPLETE));
 
+	return tsk_map_iterator_type_with_map_type(tsk_map_type(key_type, value_type));
+}
+const TskType *tsk_map_iterator_type_with_map_type(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
 	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
 	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
 	tsk_trait_builder_build(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher);
 
-	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&key_type, sizeof(key_type));     // NOLINT(bugprone-sizeof-expression)
-	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&value_type, sizeof(value_type)); // NOLINT(bugprone-sizeof-expression)
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&map_type, sizeof(map_type)); // NOLINT(bugprone-sizeof-expression)
 	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_MAP_ITERATOR_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_map_iterator_types[index].key_type != TSK_NULL) {
-		if (tsk_map_iterator_types[index].key_type == key_type && tsk_map_iterator_types[index].value_type == value_type) {
-			return &tsk_map_iterator_types[index].map_iterator_type;
-		}
-		index = (index + 1) & (TSK_MAP_ITERATOR_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_map_iterator_types_registry, hash, tsk_map_iterator_types_equals, &map_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskMapIteratorType *)entry)->map_iterator_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_map_iterator_types[index].map_iterator_type = *tsk_map_iterator_type_;
-	tsk_map_iterator_types[index].key_type          = key_type;
-	tsk_map_iterator_types[index].value_type        = value_type;
+	TskMapIteratorType *map_iterator_type_entry = entry;
+
+	map_iterator_type_entry->map_iterator_type  = *tsk_map_iterator_type_;
+	map_iterator_type_entry->map_type           = map_type;
+	map_iterator_type_entry->key_type           = tsk_map_key_type(map_type);
+	map_iterator_type_entry->value_type         = tsk_map_value_type(map_type);
+	map_iterator_type_entry->item_type          = tsk_tuple_type(
+	    (const TskType *[]){
+	        tsk_reference_const_type(tsk_map_key_type(map_type)),
+	        tsk_reference_type(tsk_map_value_type(map_type)),
+	    },
+	    2
+	);
 
 	(void)snprintf(
-	    tsk_map_iterator_types[index].map_iterator_type_name,
-	    sizeof(tsk_map_iterator_types[index].map_iterator_type_name),
-	    "TskMapIterator<%s, %s>",
-	    tsk_type_name(key_type),
-	    tsk_type_name(value_type)
+	    map_iterator_type_entry->map_iterator_type_name,
+	    sizeof(map_iterator_type_entry->map_iterator_type_name),
+	    "Tsk%s%sMapIterator<%s, %s>",
+	    tsk_map_layout(map_type) == TSK_MAP_LAYOUT_INTERLEAVED ? "Interleaved" : "",
+	    tsk_map_engine(map_type) == TSK_MAP_ENGINE_ROBIN_HOOD ? "RobinHood" : "",
+	    tsk_type_name(tsk_map_key_type(map_type)),
+	    tsk_type_name(tsk_map_value_type(map_type))
 	);
-	tsk_map_iterator_types[index].map_iterator_type.name = tsk_map_iterator_types[index].map_iterator_type_name;
+	map_iterator_type_entry->map_iterator_type.name = map_iterator_type_entry->map_iterator_type_name;
 
-	const TskType *map_iterator_type                     = &tsk_map_iterator_types[index].map_iterator_type;
+	const TskType *map_iterator_type                = &map_iterator_type_entry->map_iterator_type;
+
+	tsk_type_registry_publish(&tsk_map_iterator_types_registry, entry);
 
 	assert(tsk_map_iterator_type_is_valid(map_iterator_type));
 
@@ -976,7 +3175,7 @@ TskMapIterator tsk_map_iterator(const TskType *map_type, TskMap *map) {
 		.index = 0,
 	};
 
-	assert(tsk_map_iterator_is_valid(tsk_map_iterator_type(tsk_map_key_type(map_type), tsk_map_value_type(map_type)), &map_iterator));
+	assert(tsk_map_iterator_is_valid(tsk_map_iterator_type_with_map_type(map_type), &map_iterator));
 
 	return map_iterator;
 }
@@ -984,15 +3183,22 @@ TskMapIterator tsk_map_iterator(const TskType *map_type, TskMap *map) {
 typedef struct TskMapIteratorConstType TskMapIteratorConstType;
 struct TskMapIteratorConstType {
 	TskType        map_iterator_const_type;
-	TskCharacter   map_iterator_const_type_name[40];
+	TskCharacter   map_iterator_const_type_name[64];
+	const TskType *map_type;
 	const TskType *key_type;
 	const TskType *value_type;
+	const TskType *item_type;
 };
 
 TskBoolean tsk_map_iterator_const_is_valid(const TskType *map_iterator_type, const TskMapIteratorConst *map_iterator) {
 	assert(tsk_map_iterator_const_type_is_valid(map_iterator_type));
 
-	return map_iterator != TSK_NULL && tsk_map_is_valid(tsk_map_type(tsk_map_iterator_const_key_type(map_iterator_type), tsk_map_iterator_const_value_type(map_iterator_type)), map_iterator->map);
+	return map_iterator != TSK_NULL && tsk_map_is_valid(tsk_map_iterator_const_map_type(map_iterator_type), map_iterator->map);
+}
+const TskType *tsk_map_iterator_const_map_type(const TskType *map_iterator_type) {
+	assert(tsk_map_iterator_const_type_is_valid(map_iterator_type));
+
+	return ((const TskMapIteratorConstType *)map_iterator_type)->map_type;
 }
 const TskType *tsk_map_iterator_const_key_type(const TskType *map_iterator_type) {
 	assert(tsk_map_iterator_const_type_is_valid(map_iterator_type));
@@ -1007,45 +3213,30 @@ const TskType *tsk_map_iterator_const_value_type(const TskType *map_iterator_typ
 const TskType *tsk_map_iterator_const_item_type(const TskType *map_iterator_type) {
 	assert(tsk_map_iterator_const_type_is_valid(map_iterator_type));
 
-	return tsk_tuple_type(
-	    (const TskType *[]){
-	        tsk_reference_const_type(tsk_map_iterator_const_key_type(map_iterator_type)),
-	        tsk_reference_const_type(tsk_map_iterator_const_value_type(map_iterator_type)),
-	    },
-	    2
-	);
+	return ((const TskMapIteratorConstType *)map_iterator_type)->item_type;
 }
 TskBoolean tsk_map_iterator_const_next(const TskType *map_iterator_type, TskMapIteratorConst *map_iterator, TskTuple *item) {
 	assert(tsk_map_iterator_const_type_is_valid(map_iterator_type));
 	assert(tsk_map_iterator_const_is_valid(map_iterator_type, map_iterator));
 
-	const TskType *map_type  = tsk_map_type(tsk_map_iterator_const_key_type(map_iterator_type), tsk_map_iterator_const_value_type(map_iterator_type));
+	const TskType *map_type  = tsk_map_iterator_const_map_type(map_iterator_type);
 	const TskType *item_type = tsk_map_iterator_const_item_type(map_iterator_type);
 
-	while (map_iterator->index < tsk_map_capacity(map_type, map_iterator->map)) {
-		if (map_iterator->map->entries[map_iterator->index].state == TSK_MAP_ENTRY_STATE_OCCUPIED) {
-			const TskAny *key   = tsk_map_get_key_const(map_type, map_iterator->map, map_iterator->index);
-			const TskAny *value = tsk_map_get_value_const(map_type, map_iterator->map, map_iterator->index);
+	if (!tsk_map_next_full_slot(map_type, map_iterator->map, &map_iterator->index)) {
+		return TSK_FALSE;
+	}
 
-			memcpy(
-			    tsk_tuple_get(item_type, item, 0),
-			    &key,
-			    tsk_trait_complete_size(tsk_tuple_element_type(item_type, 0))
-			);
-			memcpy(
-			    tsk_tuple_get(item_type, item, 1),
-			    &value,
-			    tsk_trait_complete_size(tsk_tuple_element_type(item_type, 1))
-			);
+	TskUSize      index = map_iterator->index;
+	const TskMap *table = tsk_map_slot_table_const(map_type, map_iterator->map, &index);
+	const TskAny *key   = tsk_map_get_key_const(map_type, table, index);
+	const TskAny *value = tsk_map_get_value_const(map_type, table, index);
 
-			map_iterator->index++;
+	memcpy(tsk_tuple_get(item_type, item, 0), &key, sizeof(key));
+	memcpy(tsk_tuple_get(item_type, item, 1), &value, sizeof(value));
 
-			return TSK_TRUE;
-		}
-		map_iterator->index++;
-	}
+	map_iterator->index++;
 
-	return TSK_FALSE;
+	return TSK_TRUE;
 }
 
 const TskType *tsk_map_iterator_const_type_trait_iterator_item_type(const TskType *iterator_type) {
@@ -1077,13 +3268,16 @@ TSK_TYPE(tsk_map_iterator_const_type_, TskMapIteratorConst,
 );
 // clang-format on
 
-#define TSK_MAP_ITERATOR_CONST_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_map_iterator_const_types_registry = TSK_TYPE_REGISTRY(sizeof(TskMapIteratorConstType));
 
-TskMapIteratorConstType tsk_map_iterator_const_types[TSK_MAP_ITERATOR_CONST_TYPES_CAPACITY];
+static inline TskBoolean tsk_map_iterator_const_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskMapIteratorConstType *map_iterator_const_type_entry = entry;
+	return map_iterator_const_type_entry->map_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_map_iterator_const_type_is_valid(const TskType *map_iterator_type) {
 	return tsk_type_is_valid(map_iterator_type) &&
-	       &tsk_map_iterator_const_types[0] <= (const TskMapIteratorConstType *)map_iterator_type && (const TskMapIteratorConstType *)map_iterator_type < &tsk_map_iterator_const_types[TSK_MAP_ITERATOR_CONST_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_map_iterator_const_types_registry, map_iterator_type);
 }
 const TskType *tsk_map_iterator_const_type(const TskType *key_type, const TskType *value_type) {
 	assert(tsk_type_is_valid(key_type));
@@ -1093,42 +3287,55 @@ const TskType *tsk_map_iterator_const_type(const TskType *key_type, const TskTyp
 	assert(tsk_type_is_valid(value_type));
 	assert(tsk_type_has_trait(value_type, TSK_TRAIT_ID_COMPLETE));
 
+	return tsk_map_iterator_const_type_with_map_type(tsk_map_type(key_type, value_type));
+}
+const TskType *tsk_map_iterator_const_type_with_map_type(const TskType *map_type) {
+	assert(tsk_map_type_is_valid(map_type));
+
 	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
 	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
 	tsk_trait_builder_build(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher);
 
-	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&key_type, sizeof(key_type));     // NOLINT(bugprone-sizeof-expression)
-	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&value_type, sizeof(value_type)); // NOLINT(bugprone-sizeof-expression)
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&map_type, sizeof(map_type)); // NOLINT(bugprone-sizeof-expression)
 	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_MAP_ITERATOR_CONST_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_map_iterator_const_types[index].key_type != TSK_NULL) {
-		if (tsk_map_iterator_const_types[index].key_type == key_type && tsk_map_iterator_const_types[index].value_type == value_type) {
-			return &tsk_map_iterator_const_types[index].map_iterator_const_type;
-		}
-		index = (index + 1) & (TSK_MAP_ITERATOR_CONST_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_map_iterator_const_types_registry, hash, tsk_map_iterator_const_types_equals, &map_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskMapIteratorConstType *)entry)->map_iterator_const_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_map_iterator_const_types[index].map_iterator_const_type = *tsk_map_iterator_const_type_;
-	tsk_map_iterator_const_types[index].key_type                = key_type;
-	tsk_map_iterator_const_types[index].value_type              = value_type;
+	TskMapIteratorConstType *map_iterator_const_type_entry = entry;
+
+	map_iterator_const_type_entry->map_iterator_const_type = *tsk_map_iterator_const_type_;
+	map_iterator_const_type_entry->map_type                = map_type;
+	map_iterator_const_type_entry->key_type                = tsk_map_key_type(map_type);
+	map_iterator_const_type_entry->value_type              = tsk_map_value_type(map_type);
+	map_iterator_const_type_entry->item_type               = tsk_tuple_type(
+	    (const TskType *[]){
+	        tsk_reference_const_type(tsk_map_key_type(map_type)),
+	        tsk_reference_const_type(tsk_map_value_type(map_type)),
+	    },
+	    2
+	);
 
 	(void)snprintf(
-	    tsk_map_iterator_const_types[index].map_iterator_const_type_name,
-	    sizeof(tsk_map_iterator_const_types[index].map_iterator_const_type_name),
-	    "TskMapIteratorConst<%s, %s>",
-	    tsk_type_name(key_type),
-	    tsk_type_name(value_type)
+	    map_iterator_const_type_entry->map_iterator_const_type_name,
+	    sizeof(map_iterator_const_type_entry->map_iterator_const_type_name),
+	    "Tsk%s%sMapIteratorConst<%s, %s>",
+	    tsk_map_layout(map_type) == TSK_MAP_LAYOUT_INTERLEAVED ? "Interleaved" : "",
+	    tsk_map_engine(map_type) == TSK_MAP_ENGINE_ROBIN_HOOD ? "RobinHood" : "",
+	    tsk_type_name(tsk_map_key_type(map_type)),
+	    tsk_type_name(tsk_map_value_type(map_type))
 	);
-	tsk_map_iterator_const_types[index].map_iterator_const_type.name = tsk_map_iterator_const_types[index].map_iterator_const_type_name;
+	map_iterator_const_type_entry->map_iterator_const_type.name = map_iterator_const_type_entry->map_iterator_const_type_name;
+
+	const TskType *map_iterator_type                            = &map_iterator_const_type_entry->map_iterator_const_type;
 
-	const TskType *map_iterator_type                                 = &tsk_map_iterator_const_types[index].map_iterator_const_type;
+	tsk_type_registry_publish(&tsk_map_iterator_const_types_registry, entry);
 
 	assert(tsk_map_iterator_const_type_is_valid(map_iterator_type));
 
@@ -1144,7 +3351,7 @@ TskMapIteratorConst tsk_map_iterator_const(const TskType *map_type, const TskMap
 		.index = 0,
 	};
 
-	assert(tsk_map_iterator_const_is_valid(tsk_map_iterator_const_type(tsk_map_key_type(map_type), tsk_map_value_type(map_type)), &map_iterator));
+	assert(tsk_map_iterator_const_is_valid(tsk_map_iterator_const_type_with_map_type(map_type), &map_iterator));
 
 	return map_iterator;
 }
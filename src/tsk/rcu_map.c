@@ -0,0 +1,674 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <tsk/rcu_map.h>
+
+#include <tsk/default_hasher.h>
+#include <tsk/map.h>
+#include <tsk/trait/builder.h>
+#include <tsk/trait/clonable.h>
+#include <tsk/trait/complete.h>
+#include <tsk/trait/droppable.h>
+#include <tsk/trait/equatable.h>
+#include <tsk/trait/hashable.h>
+#include <tsk/trait/hasher.h>
+#include <tsk/type_registry.h>
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TSK_RCU_MAP_CACHE_LINE_SIZE ((TskUSize)64)
+
+#define TSK_RCU_MAP_READERS_LENGTH ((TskUSize)64)
+
+#define TSK_RCU_MAP_RETIRED_MAXIMUM_LENGTH ((TskUSize)64)
+
+#define TSK_RCU_MAP_MINIMUM_CAPACITY ((TskUSize)16)
+
+typedef struct TskRcuMapType TskRcuMapType;
+struct TskRcuMapType {
+	TskType                rcu_map_type;
+	TskCharacter           rcu_map_type_name[40];
+	TskTypeTraitTable      rcu_map_type_trait_table;
+	TskTypeTraitTableEntry rcu_map_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          rcu_map_type_layout;
+	const TskType         *key_type;
+	const TskType         *value_type;
+	const TskType         *map_type;
+	TskUSize               key_offset;
+	TskUSize               value_offset;
+	TskUSize               node_size;
+};
+
+typedef struct TskRcuMapNode TskRcuMapNode;
+struct TskRcuMapNode {
+	TskU64 hash;
+	TskU8  data[];
+};
+
+typedef struct TskRcuMapTable TskRcuMapTable;
+struct TskRcuMapTable {
+	TskUSize                 capacity;
+	_Atomic(TskRcuMapNode *) slots[];
+};
+
+typedef struct TskRcuMapReaders TskRcuMapReaders;
+struct TskRcuMapReaders {
+	alignas(TSK_RCU_MAP_CACHE_LINE_SIZE) atomic_size_t length;
+};
+
+typedef struct TskRcuMapRetired TskRcuMapRetired;
+struct TskRcuMapRetired {
+	TskAny    *pointer;
+	TskBoolean is_node;
+};
+
+struct TskRcuMapState {
+	TskRcuMapReaders          readers[2][TSK_RCU_MAP_READERS_LENGTH];
+	atomic_size_t             epoch;
+	_Atomic(TskRcuMapTable *) table;
+	atomic_size_t             length;
+	TskUSize                  deleted;
+	TskRcuMapRetired         *retired;
+	TskUSize                  retired_length;
+	TskUSize                  retired_capacity;
+	pthread_mutex_t           mutex;
+	TskMap                    prototype;
+};
+
+static TskRcuMapNode tsk_rcu_map_tombstone;
+
+static _Thread_local TskU8 tsk_rcu_map_thread;
+
+static inline TskAny *tsk_rcu_map_node_key(const TskType *rcu_map_type, TskRcuMapNode *node) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(node != TSK_NULL);
+
+	return (TskU8 *)node + ((const TskRcuMapType *)rcu_map_type)->key_offset;
+}
+static inline TskAny *tsk_rcu_map_node_value(const TskType *rcu_map_type, TskRcuMapNode *node) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(node != TSK_NULL);
+
+	return (TskU8 *)node + ((const TskRcuMapType *)rcu_map_type)->value_offset;
+}
+static inline TskRcuMapNode *tsk_rcu_map_node_new(const TskType *rcu_map_type, TskU64 hash, TskAny *key, TskAny *value) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	TskRcuMapNode *node = malloc(((const TskRcuMapType *)rcu_map_type)->node_size);
+	if (node == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	node->hash = hash;
+	memcpy(
+	    tsk_rcu_map_node_key(rcu_map_type, node),
+	    key,
+	    tsk_trait_complete_size(tsk_rcu_map_key_type(rcu_map_type))
+	);
+	memcpy(
+	    tsk_rcu_map_node_value(rcu_map_type, node),
+	    value,
+	    tsk_trait_complete_size(tsk_rcu_map_value_type(rcu_map_type))
+	);
+
+	return node;
+}
+static inline TskEmpty tsk_rcu_map_node_drop(const TskType *rcu_map_type, TskRcuMapNode *node) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_type_has_trait(tsk_rcu_map_key_type(rcu_map_type), TSK_TRAIT_ID_DROPPABLE));
+	assert(tsk_type_has_trait(tsk_rcu_map_value_type(rcu_map_type), TSK_TRAIT_ID_DROPPABLE));
+	assert(node != TSK_NULL && node != &tsk_rcu_map_tombstone);
+
+	tsk_trait_droppable_drop(tsk_rcu_map_key_type(rcu_map_type), tsk_rcu_map_node_key(rcu_map_type, node));
+	tsk_trait_droppable_drop(tsk_rcu_map_value_type(rcu_map_type), tsk_rcu_map_node_value(rcu_map_type, node));
+	free(node);
+}
+static inline TskRcuMapTable *tsk_rcu_map_table_new(TskUSize capacity) {
+	assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+
+	TskRcuMapTable *table = malloc(offsetof(TskRcuMapTable, slots) + (capacity * sizeof(table->slots[0])));
+	if (table == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	table->capacity = capacity;
+	for (TskUSize i = 0; i < capacity; i++) {
+		atomic_init(&table->slots[i], TSK_NULL);
+	}
+
+	return table;
+}
+
+static inline TskUSize tsk_rcu_map_reader_index(TskEmpty) {
+	TskU64 address = (TskU64)(uintptr_t)&tsk_rcu_map_thread;
+	return (TskUSize)((address * 0x9E3779B97F4A7C15ULL) >> 32) & (TSK_RCU_MAP_READERS_LENGTH - 1);
+}
+static inline TskUSize tsk_rcu_map_read_lock(TskRcuMapState *state, TskUSize reader_index) {
+	assert(state != TSK_NULL);
+	assert(reader_index < TSK_RCU_MAP_READERS_LENGTH);
+
+	TskUSize parity = atomic_load_explicit(&state->epoch, memory_order_relaxed) & 1;
+	atomic_fetch_add(&state->readers[parity][reader_index].length, 1);
+	atomic_thread_fence(memory_order_seq_cst);
+	return parity;
+}
+static inline TskEmpty tsk_rcu_map_read_unlock(TskRcuMapState *state, TskUSize reader_index, TskUSize parity) {
+	assert(state != TSK_NULL);
+	assert(reader_index < TSK_RCU_MAP_READERS_LENGTH);
+	assert(parity < 2);
+
+	atomic_fetch_sub_explicit(&state->readers[parity][reader_index].length, 1, memory_order_release);
+}
+static inline TskEmpty tsk_rcu_map_wait_for_readers(TskRcuMapState *state) {
+	assert(state != TSK_NULL);
+
+	atomic_thread_fence(memory_order_seq_cst);
+
+	for (TskUSize i = 0; i < 2; i++) {
+		TskUSize parity = atomic_fetch_add(&state->epoch, 1) & 1;
+		for (TskUSize j = 0; j < TSK_RCU_MAP_READERS_LENGTH; j++) {
+			while (atomic_load(&state->readers[parity][j].length) != 0) {
+				(void)sched_yield();
+			}
+		}
+	}
+}
+static inline TskEmpty tsk_rcu_map_reclaim(const TskType *rcu_map_type, TskRcuMapState *state) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(state != TSK_NULL);
+
+	if (state->retired_length == 0) {
+		return;
+	}
+
+	tsk_rcu_map_wait_for_readers(state);
+
+	for (TskUSize i = 0; i < state->retired_length; i++) {
+		if (state->retired[i].is_node) {
+			tsk_rcu_map_node_drop(rcu_map_type, state->retired[i].pointer);
+		} else {
+			free(state->retired[i].pointer);
+		}
+	}
+	state->retired_length = 0;
+}
+static inline TskEmpty tsk_rcu_map_retire(const TskType *rcu_map_type, TskRcuMapState *state, TskAny *pointer, TskBoolean is_node) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(state != TSK_NULL);
+	assert(pointer != TSK_NULL);
+
+	if (state->retired_length == state->retired_capacity) {
+		TskUSize          retired_capacity = state->retired_capacity == 0 ? TSK_RCU_MAP_RETIRED_MAXIMUM_LENGTH : state->retired_capacity * 2;
+		TskRcuMapRetired *retired          = realloc(state->retired, retired_capacity * sizeof(TskRcuMapRetired));
+		if (retired == TSK_NULL) {
+			tsk_rcu_map_reclaim(rcu_map_type, state);
+			tsk_rcu_map_wait_for_readers(state);
+			if (is_node) {
+				tsk_rcu_map_node_drop(rcu_map_type, pointer);
+			} else {
+				free(pointer);
+			}
+			return;
+		}
+
+		state->retired          = retired;
+		state->retired_capacity = retired_capacity;
+	}
+
+	state->retired[state->retired_length++] = (TskRcuMapRetired){
+		.pointer = pointer,
+		.is_node = is_node,
+	};
+
+	if (state->retired_length >= TSK_RCU_MAP_RETIRED_MAXIMUM_LENGTH) {
+		tsk_rcu_map_reclaim(rcu_map_type, state);
+	}
+}
+static inline TskRcuMapNode *tsk_rcu_map_find(const TskType *rcu_map_type, const TskRcuMapTable *table, TskU64 hash, const TskAny *key, TskUSize *index) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(key != TSK_NULL);
+
+	if (table == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	TskUSize mask       = table->capacity - 1;
+	TskUSize slot_index = (TskUSize)hash & mask;
+	for (TskUSize i = 0; i < table->capacity; i++) {
+		TskRcuMapNode *node = atomic_load_explicit(&table->slots[slot_index], memory_order_acquire);
+		if (node == TSK_NULL) {
+			break;
+		}
+
+		if (node != &tsk_rcu_map_tombstone &&
+		    node->hash == hash &&
+		    tsk_trait_equatable_equals(tsk_rcu_map_key_type(rcu_map_type), key, tsk_rcu_map_node_key(rcu_map_type, node))) {
+			if (index != TSK_NULL) {
+				*index = slot_index;
+			}
+			return node;
+		}
+
+		slot_index = (slot_index + 1) & mask;
+	}
+
+	return TSK_NULL;
+}
+static inline TskRcuMapTable *tsk_rcu_map_resize(const TskType *rcu_map_type, TskRcuMapState *state, TskUSize capacity) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(state != TSK_NULL);
+
+	TskRcuMapTable *new_table = tsk_rcu_map_table_new(capacity);
+	if (new_table == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	TskRcuMapTable *table = atomic_load_explicit(&state->table, memory_order_relaxed);
+	if (table != TSK_NULL) {
+		for (TskUSize i = 0; i < table->capacity; i++) {
+			TskRcuMapNode *node = atomic_load_explicit(&table->slots[i], memory_order_relaxed);
+			if (node == TSK_NULL || node == &tsk_rcu_map_tombstone) {
+				continue;
+			}
+
+			TskUSize slot_index = (TskUSize)node->hash & (capacity - 1);
+			while (atomic_load_explicit(&new_table->slots[slot_index], memory_order_relaxed) != TSK_NULL) {
+				slot_index = (slot_index + 1) & (capacity - 1);
+			}
+			atomic_store_explicit(&new_table->slots[slot_index], node, memory_order_relaxed);
+		}
+	}
+
+	atomic_store_explicit(&state->table, new_table, memory_order_release);
+	state->deleted = 0;
+
+	if (table != TSK_NULL) {
+		tsk_rcu_map_retire(rcu_map_type, state, table, TSK_FALSE);
+	}
+
+	return new_table;
+}
+static inline TskBoolean tsk_rcu_map_state_new(const TskType *rcu_map_type, TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(rcu_map != TSK_NULL);
+
+	TskRcuMapState *state = aligned_alloc(TSK_RCU_MAP_CACHE_LINE_SIZE, sizeof(TskRcuMapState));
+	if (state == TSK_NULL) {
+		return TSK_FALSE;
+	}
+
+	if (pthread_mutex_init(&state->mutex, TSK_NULL) != 0) {
+		free(state);
+		return TSK_FALSE;
+	}
+
+	for (TskUSize i = 0; i < TSK_RCU_MAP_READERS_LENGTH; i++) {
+		atomic_init(&state->readers[0][i].length, 0);
+		atomic_init(&state->readers[1][i].length, 0);
+	}
+	atomic_init(&state->epoch, 0);
+	atomic_init(&state->table, TSK_NULL);
+	atomic_init(&state->length, 0);
+	state->deleted          = 0;
+	state->retired          = TSK_NULL;
+	state->retired_length   = 0;
+	state->retired_capacity = 0;
+
+	rcu_map->state          = state;
+
+	return TSK_TRUE;
+}
+
+TskBoolean tsk_rcu_map_is_valid(const TskType *rcu_map_type, const TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+
+	return rcu_map != TSK_NULL &&
+	       rcu_map->state != TSK_NULL &&
+	       tsk_map_is_valid(((const TskRcuMapType *)rcu_map_type)->map_type, &rcu_map->state->prototype);
+}
+TskBoolean tsk_rcu_map_new(const TskType *rcu_map_type, TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(rcu_map != TSK_NULL);
+
+	if (!tsk_rcu_map_state_new(rcu_map_type, rcu_map)) {
+		return TSK_FALSE;
+	}
+
+	rcu_map->state->prototype = tsk_map_new(((const TskRcuMapType *)rcu_map_type)->map_type);
+
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_rcu_map_with_hasher_builder(const TskType *rcu_map_type, TskRcuMap *rcu_map, const TskType *hasher_builder_type, TskAny *hasher_builder) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(rcu_map != TSK_NULL);
+	assert(tsk_type_is_valid(hasher_builder_type));
+	assert(hasher_builder != TSK_NULL);
+
+	if (!tsk_rcu_map_state_new(rcu_map_type, rcu_map)) {
+		return TSK_FALSE;
+	}
+
+	if (!tsk_map_with_hasher_builder(((const TskRcuMapType *)rcu_map_type)->map_type, &rcu_map->state->prototype, hasher_builder_type, hasher_builder)) {
+		(void)pthread_mutex_destroy(&rcu_map->state->mutex);
+		free(rcu_map->state);
+		rcu_map->state = TSK_NULL;
+		return TSK_FALSE;
+	}
+
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+
+	return TSK_TRUE;
+}
+TskEmpty tsk_rcu_map_drop(const TskType *rcu_map_type, TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+
+	TskRcuMapState *state = rcu_map->state;
+
+	tsk_rcu_map_reclaim(rcu_map_type, state);
+	free(state->retired);
+
+	TskRcuMapTable *table = atomic_load_explicit(&state->table, memory_order_relaxed);
+	if (table != TSK_NULL) {
+		for (TskUSize i = 0; i < table->capacity; i++) {
+			TskRcuMapNode *node = atomic_load_explicit(&table->slots[i], memory_order_relaxed);
+			if (node != TSK_NULL && node != &tsk_rcu_map_tombstone) {
+				tsk_rcu_map_node_drop(rcu_map_type, node);
+			}
+		}
+		free(table);
+	}
+
+	tsk_map_drop(((const TskRcuMapType *)rcu_map_type)->map_type, &state->prototype);
+	(void)pthread_mutex_destroy(&state->mutex);
+	free(state);
+
+	rcu_map->state = TSK_NULL;
+}
+const TskType *tsk_rcu_map_key_type(const TskType *rcu_map_type) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+
+	return ((const TskRcuMapType *)rcu_map_type)->key_type;
+}
+const TskType *tsk_rcu_map_value_type(const TskType *rcu_map_type) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+
+	return ((const TskRcuMapType *)rcu_map_type)->value_type;
+}
+TskUSize tsk_rcu_map_length(const TskType *rcu_map_type, const TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+
+	return atomic_load_explicit(&rcu_map->state->length, memory_order_relaxed);
+}
+TskBoolean tsk_rcu_map_is_empty(const TskType *rcu_map_type, const TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+
+	return tsk_rcu_map_length(rcu_map_type, rcu_map) == 0;
+}
+TskUSize tsk_rcu_map_capacity(const TskType *rcu_map_type, const TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+
+	TskUSize        reader_index = tsk_rcu_map_reader_index();
+	TskUSize        parity       = tsk_rcu_map_read_lock(rcu_map->state, reader_index);
+	TskRcuMapTable *table        = atomic_load_explicit(&rcu_map->state->table, memory_order_acquire);
+	TskUSize        capacity     = table != TSK_NULL ? table->capacity : 0;
+	tsk_rcu_map_read_unlock(rcu_map->state, reader_index, parity);
+
+	return capacity;
+}
+TskBoolean tsk_rcu_map_contains(const TskType *rcu_map_type, const TskRcuMap *rcu_map, const TskAny *key) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+	assert(key != TSK_NULL);
+
+	const TskType  *map_type     = ((const TskRcuMapType *)rcu_map_type)->map_type;
+	TskU64          hash         = tsk_map_hash(map_type, &rcu_map->state->prototype, tsk_map_key_type(map_type), key);
+
+	TskUSize        reader_index = tsk_rcu_map_reader_index();
+	TskUSize        parity       = tsk_rcu_map_read_lock(rcu_map->state, reader_index);
+	TskRcuMapTable *table        = atomic_load_explicit(&rcu_map->state->table, memory_order_acquire);
+	TskBoolean      contains     = tsk_rcu_map_find(rcu_map_type, table, hash, key, TSK_NULL) != TSK_NULL;
+	tsk_rcu_map_read_unlock(rcu_map->state, reader_index, parity);
+
+	return contains;
+}
+TskBoolean tsk_rcu_map_get(const TskType *rcu_map_type, const TskRcuMap *rcu_map, const TskAny *key, TskAny *value) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+	assert(key != TSK_NULL);
+	assert(tsk_type_has_trait(tsk_rcu_map_value_type(rcu_map_type), TSK_TRAIT_ID_CLONABLE));
+	assert(value != TSK_NULL);
+
+	const TskType  *map_type     = ((const TskRcuMapType *)rcu_map_type)->map_type;
+	TskU64          hash         = tsk_map_hash(map_type, &rcu_map->state->prototype, tsk_map_key_type(map_type), key);
+
+	TskUSize        reader_index = tsk_rcu_map_reader_index();
+	TskUSize        parity       = tsk_rcu_map_read_lock(rcu_map->state, reader_index);
+	TskRcuMapTable *table        = atomic_load_explicit(&rcu_map->state->table, memory_order_acquire);
+	TskRcuMapNode  *node         = tsk_rcu_map_find(rcu_map_type, table, hash, key, TSK_NULL);
+	TskBoolean      found        = node != TSK_NULL && tsk_trait_clonable_clone(tsk_rcu_map_value_type(rcu_map_type), tsk_rcu_map_node_value(rcu_map_type, node), value);
+	tsk_rcu_map_read_unlock(rcu_map->state, reader_index, parity);
+
+	return found;
+}
+TskBoolean tsk_rcu_map_insert(const TskType *rcu_map_type, TskRcuMap *rcu_map, TskAny *key, TskAny *value) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+	assert(key != TSK_NULL);
+	assert(value != TSK_NULL);
+
+	TskRcuMapState *state    = rcu_map->state;
+	const TskType  *map_type = ((const TskRcuMapType *)rcu_map_type)->map_type;
+	TskU64          hash     = tsk_map_hash(map_type, &state->prototype, tsk_map_key_type(map_type), key);
+
+	(void)pthread_mutex_lock(&state->mutex);
+
+	TskRcuMapTable *table  = atomic_load_explicit(&state->table, memory_order_relaxed);
+	TskUSize        length = atomic_load_explicit(&state->length, memory_order_relaxed);
+	if (table == TSK_NULL || (length + state->deleted + 1) * 8 > table->capacity * 7) {
+		TskUSize capacity = TSK_RCU_MAP_MINIMUM_CAPACITY;
+		while ((length + 1) * 16 > capacity * 7) {
+			capacity *= 2;
+		}
+
+		table = tsk_rcu_map_resize(rcu_map_type, state, capacity);
+		if (table == TSK_NULL) {
+			(void)pthread_mutex_unlock(&state->mutex);
+			return TSK_FALSE;
+		}
+	}
+
+	TskRcuMapNode *node = tsk_rcu_map_node_new(rcu_map_type, hash, key, value);
+	if (node == TSK_NULL) {
+		(void)pthread_mutex_unlock(&state->mutex);
+		return TSK_FALSE;
+	}
+
+	TskUSize mask         = table->capacity - 1;
+	TskUSize slot_index   = (TskUSize)hash & mask;
+	TskUSize insert_index = table->capacity;
+	for (;;) {
+		TskRcuMapNode *slot_node = atomic_load_explicit(&table->slots[slot_index], memory_order_relaxed);
+		if (slot_node == TSK_NULL) {
+			break;
+		}
+
+		if (slot_node == &tsk_rcu_map_tombstone) {
+			if (insert_index == table->capacity) {
+				insert_index = slot_index;
+			}
+		} else if (slot_node->hash == hash &&
+		           tsk_trait_equatable_equals(tsk_rcu_map_key_type(rcu_map_type), key, tsk_rcu_map_node_key(rcu_map_type, slot_node))) {
+			atomic_store_explicit(&table->slots[slot_index], node, memory_order_release);
+			tsk_rcu_map_retire(rcu_map_type, state, slot_node, TSK_TRUE);
+
+			(void)pthread_mutex_unlock(&state->mutex);
+			return TSK_TRUE;
+		}
+
+		slot_index = (slot_index + 1) & mask;
+	}
+
+	if (insert_index == table->capacity) {
+		insert_index = slot_index;
+	} else {
+		state->deleted--;
+	}
+	atomic_store_explicit(&table->slots[insert_index], node, memory_order_release);
+	atomic_store_explicit(&state->length, length + 1, memory_order_relaxed);
+
+	(void)pthread_mutex_unlock(&state->mutex);
+	return TSK_TRUE;
+}
+TskBoolean tsk_rcu_map_remove(const TskType *rcu_map_type, TskRcuMap *rcu_map, const TskAny *key) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+	assert(key != TSK_NULL);
+
+	TskRcuMapState *state    = rcu_map->state;
+	const TskType  *map_type = ((const TskRcuMapType *)rcu_map_type)->map_type;
+	TskU64          hash     = tsk_map_hash(map_type, &state->prototype, tsk_map_key_type(map_type), key);
+
+	(void)pthread_mutex_lock(&state->mutex);
+
+	TskRcuMapTable *table = atomic_load_explicit(&state->table, memory_order_relaxed);
+	TskUSize        index = 0;
+	TskRcuMapNode  *node  = tsk_rcu_map_find(rcu_map_type, table, hash, key, &index);
+	if (node == TSK_NULL) {
+		(void)pthread_mutex_unlock(&state->mutex);
+		return TSK_FALSE;
+	}
+
+	atomic_store_explicit(&table->slots[index], &tsk_rcu_map_tombstone, memory_order_release);
+	atomic_store_explicit(&state->length, atomic_load_explicit(&state->length, memory_order_relaxed) - 1, memory_order_relaxed);
+	state->deleted++;
+	tsk_rcu_map_retire(rcu_map_type, state, node, TSK_TRUE);
+
+	(void)pthread_mutex_unlock(&state->mutex);
+	return TSK_TRUE;
+}
+TskEmpty tsk_rcu_map_synchronize(const TskType *rcu_map_type, TskRcuMap *rcu_map) {
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+	assert(tsk_rcu_map_is_valid(rcu_map_type, rcu_map));
+
+	(void)pthread_mutex_lock(&rcu_map->state->mutex);
+	tsk_rcu_map_reclaim(rcu_map_type, rcu_map->state);
+	(void)pthread_mutex_unlock(&rcu_map->state->mutex);
+}
+
+TskEmpty tsk_rcu_map_type_trait_droppable_drop(const TskType *droppable_type, TskAny *droppable) {
+	tsk_rcu_map_drop(droppable_type, droppable);
+}
+
+const TskTraitComplete tsk_rcu_map_type_trait_complete = {
+	.size      = sizeof(TskRcuMap),
+	.alignment = alignof(TskRcuMap),
+};
+const TskTraitDroppable tsk_rcu_map_type_trait_droppable = {
+	.drop = tsk_rcu_map_type_trait_droppable_drop,
+};
+
+TskTypeRegistry tsk_rcu_map_types_registry = TSK_TYPE_REGISTRY(sizeof(TskRcuMapType));
+
+static inline TskBoolean tsk_rcu_map_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskRcuMapType *rcu_map_type_entry = entry;
+	return rcu_map_type_entry->key_type == ((const TskType *const *)key)[0] && rcu_map_type_entry->value_type == ((const TskType *const *)key)[1];
+}
+
+TskBoolean tsk_rcu_map_type_is_valid(const TskType *rcu_map_type) {
+	return tsk_type_is_valid(rcu_map_type) &&
+	       tsk_type_registry_contains(&tsk_rcu_map_types_registry, rcu_map_type);
+}
+const TskType *tsk_rcu_map_type(const TskType *key_type, const TskType *value_type) {
+	assert(tsk_type_is_valid(key_type));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_DROPPABLE));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_EQUATABLE));
+	assert(tsk_type_has_trait(key_type, TSK_TRAIT_ID_HASHABLE));
+	assert(tsk_trait_complete_alignment(key_type) <= alignof(max_align_t));
+	assert(tsk_type_is_valid(value_type));
+	assert(tsk_type_has_trait(value_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(value_type, TSK_TRAIT_ID_DROPPABLE));
+	assert(tsk_trait_complete_alignment(value_type) <= alignof(max_align_t));
+
+	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
+	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
+	tsk_trait_builder_build(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher);
+
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&key_type, sizeof(key_type));     // NOLINT(bugprone-sizeof-expression)
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&value_type, sizeof(value_type)); // NOLINT(bugprone-sizeof-expression)
+	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
+
+	tsk_trait_droppable_drop(hasher_type, hasher);
+
+	const TskType *map_type = tsk_map_type(key_type, value_type);
+	if (map_type == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_rcu_map_types_registry, hash, tsk_rcu_map_types_equals, (const TskType *[]){ key_type, value_type }, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskRcuMapType *)entry)->rcu_map_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
+	}
+
+	TskRcuMapType *rcu_map_type_entry                                           = entry;
+
+	rcu_map_type_entry->rcu_map_type.trait_table                                = &rcu_map_type_entry->rcu_map_type_trait_table;
+	rcu_map_type_entry->rcu_map_type.layout                                     = &rcu_map_type_entry->rcu_map_type_layout;
+	rcu_map_type_entry->rcu_map_type_trait_table.entries                        = rcu_map_type_entry->rcu_map_type_trait_table_entries;
+	rcu_map_type_entry->rcu_map_type_trait_table.capacity                       = 0;
+
+	rcu_map_type_entry->rcu_map_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
+		.trait_id   = TSK_TRAIT_ID_COMPLETE,
+		.trait_data = &tsk_rcu_map_type_trait_complete,
+	};
+	rcu_map_type_entry->rcu_map_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
+		.trait_id   = TSK_TRAIT_ID_DROPPABLE,
+		.trait_data = &tsk_rcu_map_type_trait_droppable,
+	};
+
+	TskUSize key_alignment           = tsk_trait_complete_alignment(key_type);
+	TskUSize value_alignment         = tsk_trait_complete_alignment(value_type);
+	rcu_map_type_entry->key_type     = key_type;
+	rcu_map_type_entry->value_type   = value_type;
+	rcu_map_type_entry->map_type     = map_type;
+	rcu_map_type_entry->key_offset   = (offsetof(TskRcuMapNode, data) + key_alignment - 1) / key_alignment * key_alignment;
+	rcu_map_type_entry->value_offset = (rcu_map_type_entry->key_offset + tsk_trait_complete_size(key_type) + value_alignment - 1) / value_alignment * value_alignment;
+	rcu_map_type_entry->node_size    = rcu_map_type_entry->value_offset + tsk_trait_complete_size(value_type);
+
+	(void)snprintf(
+	    rcu_map_type_entry->rcu_map_type_name,
+	    sizeof(rcu_map_type_entry->rcu_map_type_name),
+	    "TskRcuMap<%s, %s>",
+	    tsk_type_name(key_type),
+	    tsk_type_name(value_type)
+	);
+	rcu_map_type_entry->rcu_map_type.name = rcu_map_type_entry->rcu_map_type_name;
+
+	const TskType *rcu_map_type           = &rcu_map_type_entry->rcu_map_type;
+
+	(void)tsk_type_layout(rcu_map_type);
+
+	tsk_type_registry_publish(&tsk_rcu_map_types_registry, entry);
+
+	assert(tsk_rcu_map_type_is_valid(rcu_map_type));
+
+	return rcu_map_type;
+}
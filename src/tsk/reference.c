@@ -9,6 +9,7 @@
 #include <tsk/trait/equatable.h>
 #include <tsk/trait/hashable.h>
 #include <tsk/trait/hasher.h>
+#include <tsk/type_registry.h>
 
 #include <assert.h>
 #include <stdio.h>
@@ -53,13 +54,16 @@ TSK_TYPE(tsk_reference_type_, TskReference,
 );
 // clang-format on
 
-#define TSK_REFERENCE_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_reference_types_registry = TSK_TYPE_REGISTRY(sizeof(TskReferenceType));
 
-TskReferenceType tsk_reference_types[TSK_REFERENCE_TYPES_CAPACITY];
+static inline TskBoolean tsk_reference_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskReferenceType *reference_type_entry = entry;
+	return reference_type_entry->referenced_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_reference_type_is_valid(const TskType *reference_type) {
 	return tsk_type_is_valid(reference_type) &&
-	       &tsk_reference_types[0] <= (const TskReferenceType *)reference_type && (const TskReferenceType *)reference_type < &tsk_reference_types[TSK_REFERENCE_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_reference_types_registry, reference_type);
 }
 const TskType *tsk_reference_type(const TskType *referenced_type) {
 	assert(tsk_type_is_valid(referenced_type));
@@ -73,30 +77,29 @@ const TskType *tsk_reference_type(const TskType *referenced_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_REFERENCE_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_reference_types[index].referenced_type != TSK_NULL) {
-		if (tsk_reference_types[index].referenced_type == referenced_type) {
-			return &tsk_reference_types[index].reference_type;
-		}
-		index = (index + 1) & (TSK_REFERENCE_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_reference_types_registry, hash, tsk_reference_types_equals, &referenced_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskReferenceType *)entry)->reference_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_reference_types[index].reference_type  = *tsk_reference_type_;
-	tsk_reference_types[index].referenced_type = referenced_type;
+	TskReferenceType *reference_type_entry = entry;
+
+	reference_type_entry->reference_type   = *tsk_reference_type_;
+	reference_type_entry->referenced_type  = referenced_type;
 
 	(void)snprintf(
-	    tsk_reference_types[index].reference_type_name,
-	    sizeof(tsk_reference_types[index].reference_type_name),
+	    reference_type_entry->reference_type_name,
+	    sizeof(reference_type_entry->reference_type_name),
 	    "TskReference<%s>",
 	    tsk_type_name(referenced_type)
 	);
-	tsk_reference_types[index].reference_type.name = tsk_reference_types[index].reference_type_name;
+	reference_type_entry->reference_type.name = reference_type_entry->reference_type_name;
+
+	const TskType *reference_type             = &reference_type_entry->reference_type;
 
-	const TskType *reference_type                  = &tsk_reference_types[index].reference_type;
+	tsk_type_registry_publish(&tsk_reference_types_registry, entry);
 
 	assert(tsk_reference_type_is_valid(reference_type));
 
@@ -143,13 +146,16 @@ TSK_TYPE(tsk_reference_const_type_, TskReferenceConst,
 );
 // clang-format on
 
-#define TSK_REFERENCE_CONST_TYPES_CAPACITY ((TskUSize)1 << 7)
+TskTypeRegistry tsk_reference_const_types_registry = TSK_TYPE_REGISTRY(sizeof(TskReferenceConstType));
 
-TskReferenceConstType tsk_reference_const_types[TSK_REFERENCE_CONST_TYPES_CAPACITY];
+static inline TskBoolean tsk_reference_const_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskReferenceConstType *reference_const_type_entry = entry;
+	return reference_const_type_entry->referenced_type == *(const TskType *const *)key;
+}
 
 TskBoolean tsk_reference_const_type_is_valid(const TskType *reference_type) {
 	return tsk_type_is_valid(reference_type) &&
-	       &tsk_reference_const_types[0] <= (const TskReferenceConstType *)reference_type && (const TskReferenceConstType *)reference_type < &tsk_reference_const_types[TSK_REFERENCE_CONST_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_reference_const_types_registry, reference_type);
 }
 const TskType *tsk_reference_const_type(const TskType *referenced_type) {
 	assert(tsk_type_is_valid(referenced_type));
@@ -163,25 +169,24 @@ const TskType *tsk_reference_const_type(const TskType *referenced_type) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_REFERENCE_CONST_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_reference_const_types[index].referenced_type != TSK_NULL) {
-		if (tsk_reference_const_types[index].referenced_type == referenced_type) {
-			return &tsk_reference_const_types[index].reference_type;
-		}
-		index = (index + 1) & (TSK_REFERENCE_CONST_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_reference_const_types_registry, hash, tsk_reference_const_types_equals, &referenced_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskReferenceConstType *)entry)->reference_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	tsk_reference_const_types[index].reference_type  = *tsk_reference_const_type_;
-	tsk_reference_const_types[index].referenced_type = referenced_type;
+	TskReferenceConstType *reference_const_type_entry = entry;
+
+	reference_const_type_entry->reference_type        = *tsk_reference_const_type_;
+	reference_const_type_entry->referenced_type       = referenced_type;
+
+	(void)snprintf(reference_const_type_entry->reference_type_name, sizeof(reference_const_type_entry->reference_type_name), "TskReferenceConst<%s>", tsk_type_name(referenced_type));
+	reference_const_type_entry->reference_type.name = reference_const_type_entry->reference_type_name;
 
-	(void)snprintf(tsk_reference_const_types[index].reference_type_name, sizeof(tsk_reference_const_types[index].reference_type_name), "TskReferenceConst<%s>", tsk_type_name(referenced_type));
-	tsk_reference_const_types[index].reference_type.name = tsk_reference_const_types[index].reference_type_name;
+	const TskType *reference_type                   = &reference_const_type_entry->reference_type;
 
-	const TskType *reference_type                        = &tsk_reference_const_types[index].reference_type;
+	tsk_type_registry_publish(&tsk_reference_const_types_registry, entry);
 
 	assert(tsk_reference_const_type_is_valid(reference_type));
 
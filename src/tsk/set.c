@@ -0,0 +1,750 @@
+#include <tsk/set.h>
+
+#include <tsk/default_hasher.h>
+#include <tsk/reference.h>
+#include <tsk/trait/builder.h>
+#include <tsk/trait/clonable.h>
+#include <tsk/trait/complete.h>
+#include <tsk/trait/droppable.h>
+#include <tsk/trait/equatable.h>
+#include <tsk/trait/hashable.h>
+#include <tsk/trait/hasher.h>
+#include <tsk/trait/iterable.h>
+#include <tsk/trait/iterator.h>
+#include <tsk/type_registry.h>
+
+#include <assert.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TSK_SET_BATCH_LENGTH ((TskUSize)16)
+
+typedef struct TskSetType TskSetType;
+struct TskSetType {
+	TskType                set_type;
+	TskCharacter           set_type_name[40];
+	TskTypeTraitTable      set_type_trait_table;
+	TskTypeTraitTableEntry set_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          set_type_layout;
+	const TskType         *element_type;
+	const TskType         *map_type;
+};
+
+static inline TskUSize tsk_set_next_batch(const TskType *set_type, const TskSet *set, TskUSize *index, const TskAny **elements) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(index != TSK_NULL);
+	assert(elements != TSK_NULL);
+
+	TskUSize length = 0;
+	while (length < TSK_SET_BATCH_LENGTH && tsk_map_next_key(tsk_set_map_type(set_type), &set->map, index, &elements[length])) {
+		length++;
+	}
+
+	return length;
+}
+static inline TskEmpty tsk_set_hash_batch(const TskType *set_type, const TskSet *set, const TskAny **elements, TskUSize length, TskU64 *hashes) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(elements != TSK_NULL || length == 0);
+	assert(hashes != TSK_NULL || length == 0);
+
+	const TskType *map_type = tsk_set_map_type(set_type);
+	for (TskUSize i = 0; i < length; i++) {
+		hashes[i] = tsk_map_hash(map_type, &set->map, tsk_set_element_type(set_type), elements[i]);
+		tsk_map_prefetch_with_hash(map_type, &set->map, hashes[i]);
+	}
+}
+static inline TskBoolean tsk_set_contains_with_hash(const TskType *set_type, const TskSet *set, const TskAny *element, TskU64 hash) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(element != TSK_NULL);
+
+	return tsk_map_get_const_with_hash(tsk_set_map_type(set_type), &set->map, element, hash) != TSK_NULL;
+}
+static inline TskBoolean tsk_set_insert_with_hash(const TskType *set_type, TskSet *set, TskAny *element, TskU64 hash) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(element != TSK_NULL);
+
+	TskUnit value;
+	return tsk_map_insert_with_hash(tsk_set_map_type(set_type), &set->map, element, &value, hash);
+}
+static inline TskBoolean tsk_set_insert_clone(const TskType *set_type, TskSet *set, const TskAny *element, TskU64 hash) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(element != TSK_NULL);
+
+	alignas(max_align_t) TskU8 clone[tsk_trait_complete_size(tsk_set_element_type(set_type))];
+	if (!tsk_trait_clonable_clone(tsk_set_element_type(set_type), element, clone)) {
+		return TSK_FALSE;
+	}
+
+	if (!tsk_set_insert_with_hash(set_type, set, clone, hash)) {
+		tsk_trait_droppable_drop(tsk_set_element_type(set_type), clone);
+		return TSK_FALSE;
+	}
+
+	return TSK_TRUE;
+}
+static inline TskBoolean tsk_set_insert_clones(const TskType *set_type, TskSet *set, const TskSet *source, const TskSet *excluded) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(tsk_set_is_valid(set_type, source));
+	assert(tsk_set_is_valid(set_type, excluded));
+
+	TskUSize index = 0;
+	for (;;) {
+		const TskAny *elements[TSK_SET_BATCH_LENGTH];
+		TskU64        hashes[TSK_SET_BATCH_LENGTH];
+		TskUSize      length = tsk_set_next_batch(set_type, source, &index, elements);
+		if (length == 0) {
+			return TSK_TRUE;
+		}
+
+		tsk_set_hash_batch(set_type, excluded, elements, length, hashes);
+
+		for (TskUSize i = 0; i < length; i++) {
+			if (!tsk_set_contains_with_hash(set_type, excluded, elements[i], hashes[i]) &&
+			    !tsk_set_insert_clone(set_type, set, elements[i], tsk_map_hash(tsk_set_map_type(set_type), &set->map, tsk_set_element_type(set_type), elements[i]))) {
+				return TSK_FALSE;
+			}
+		}
+	}
+}
+static inline TskUSize tsk_set_count_contained(const TskType *set_type, const TskSet *set_1, const TskSet *set_2, TskUSize limit) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(tsk_set_is_valid(set_type, set_2));
+
+	TskUSize count = 0;
+	TskUSize index = 0;
+	for (;;) {
+		const TskAny *elements[TSK_SET_BATCH_LENGTH];
+		TskU64        hashes[TSK_SET_BATCH_LENGTH];
+		TskUSize      length = tsk_set_next_batch(set_type, set_1, &index, elements);
+		if (length == 0) {
+			return count;
+		}
+
+		tsk_set_hash_batch(set_type, set_2, elements, length, hashes);
+
+		for (TskUSize i = 0; i < length; i++) {
+			if (tsk_set_contains_with_hash(set_type, set_2, elements[i], hashes[i])) {
+				count++;
+				if (count == limit) {
+					return count;
+				}
+			}
+		}
+	}
+}
+
+TskBoolean tsk_set_is_valid(const TskType *set_type, const TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+
+	return set != TSK_NULL && tsk_map_is_valid(tsk_set_map_type(set_type), &set->map);
+}
+TskSet tsk_set_new(const TskType *set_type) {
+	assert(tsk_set_type_is_valid(set_type));
+
+	TskSet set = {
+		.map = tsk_map_new(tsk_set_map_type(set_type)),
+	};
+
+	assert(tsk_set_is_valid(set_type, &set));
+
+	return set;
+}
+TskBoolean tsk_set_with_hasher_builder(const TskType *set_type, TskSet *set, const TskType *hasher_builder_type, TskAny *hasher_builder) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(set != TSK_NULL);
+
+	return tsk_map_with_hasher_builder(tsk_set_map_type(set_type), &set->map, hasher_builder_type, hasher_builder);
+}
+TskEmpty tsk_set_drop(const TskType *set_type, TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	tsk_map_drop(tsk_set_map_type(set_type), &set->map);
+}
+TskBoolean tsk_set_clone(const TskType *set_type, const TskSet *set_1, TskSet *set_2) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(set_2 != TSK_NULL);
+
+	return tsk_map_clone(tsk_set_map_type(set_type), &set_1->map, &set_2->map);
+}
+const TskType *tsk_set_element_type(const TskType *set_type) {
+	assert(tsk_set_type_is_valid(set_type));
+
+	return ((const TskSetType *)set_type)->element_type;
+}
+const TskType *tsk_set_map_type(const TskType *set_type) {
+	assert(tsk_set_type_is_valid(set_type));
+
+	return ((const TskSetType *)set_type)->map_type;
+}
+TskUSize tsk_set_length(const TskType *set_type, const TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	return tsk_map_length(tsk_set_map_type(set_type), &set->map);
+}
+TskBoolean tsk_set_is_empty(const TskType *set_type, const TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	return tsk_set_length(set_type, set) == 0;
+}
+TskUSize tsk_set_capacity(const TskType *set_type, const TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	return tsk_map_capacity(tsk_set_map_type(set_type), &set->map);
+}
+TskBoolean tsk_set_contains(const TskType *set_type, const TskSet *set, const TskAny *element) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(element != TSK_NULL);
+
+	return tsk_map_get_const(tsk_set_map_type(set_type), &set->map, element) != TSK_NULL;
+}
+const TskAny *tsk_set_get(const TskType *set_type, const TskSet *set, const TskAny *element) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(element != TSK_NULL);
+
+	return tsk_map_key_const(tsk_set_map_type(set_type), &set->map, element);
+}
+TskEmpty tsk_set_clear(const TskType *set_type, TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	tsk_map_clear(tsk_set_map_type(set_type), &set->map);
+}
+TskBoolean tsk_set_reserve(const TskType *set_type, TskSet *set, TskUSize capacity) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	return tsk_map_reserve(tsk_set_map_type(set_type), &set->map, capacity);
+}
+TskBoolean tsk_set_reserve_additional(const TskType *set_type, TskSet *set, TskUSize additional) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	return tsk_map_reserve_additional(tsk_set_map_type(set_type), &set->map, additional);
+}
+TskBoolean tsk_set_shrink_to_fit(const TskType *set_type, TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	return tsk_map_shrink_to_fit(tsk_set_map_type(set_type), &set->map);
+}
+TskBoolean tsk_set_shrink_to(const TskType *set_type, TskSet *set, TskUSize capacity) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	return tsk_map_shrink_to(tsk_set_map_type(set_type), &set->map, capacity);
+}
+TskBoolean tsk_set_insert(const TskType *set_type, TskSet *set, TskAny *element) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(element != TSK_NULL);
+
+	TskUnit value;
+	return tsk_map_insert(tsk_set_map_type(set_type), &set->map, element, &value);
+}
+TskBoolean tsk_set_extend(const TskType *set_type, TskSet *set, TskArrayView elements) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	const TskType *elements_type = tsk_array_view_type(tsk_set_element_type(set_type));
+
+	assert(tsk_array_view_is_valid(elements_type, elements));
+
+	if (!tsk_set_reserve_additional(set_type, set, tsk_array_view_length(elements_type, elements))) {
+		return TSK_FALSE;
+	}
+
+	for (TskUSize start = 0; start < tsk_array_view_length(elements_type, elements); start += TSK_SET_BATCH_LENGTH) {
+		TskUSize length = tsk_array_view_length(elements_type, elements) - start;
+		if (length > TSK_SET_BATCH_LENGTH) {
+			length = TSK_SET_BATCH_LENGTH;
+		}
+
+		const TskAny *batch[TSK_SET_BATCH_LENGTH];
+		TskU64        hashes[TSK_SET_BATCH_LENGTH];
+		for (TskUSize i = 0; i < length; i++) {
+			batch[i] = tsk_array_view_get(elements_type, elements, start + i);
+		}
+		tsk_set_hash_batch(set_type, set, batch, length, hashes);
+
+		for (TskUSize i = 0; i < length; i++) {
+			if (!tsk_set_insert_with_hash(set_type, set, tsk_array_view_get(elements_type, elements, start + i), hashes[i])) {
+				return TSK_FALSE;
+			}
+		}
+	}
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_set_remove(const TskType *set_type, TskSet *set, const TskAny *element) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+	assert(element != TSK_NULL);
+
+	return tsk_map_remove(tsk_set_map_type(set_type), &set->map, element, TSK_NULL);
+}
+TskBoolean tsk_set_union(const TskType *set_type, const TskSet *set_1, const TskSet *set_2, TskSet *set_3) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(tsk_set_is_valid(set_type, set_2));
+	assert(tsk_type_has_trait(tsk_set_element_type(set_type), TSK_TRAIT_ID_CLONABLE));
+	assert(set_3 != TSK_NULL);
+
+	const TskSet *larger  = set_1;
+	const TskSet *smaller = set_2;
+	if (tsk_set_length(set_type, set_1) < tsk_set_length(set_type, set_2)) {
+		larger  = set_2;
+		smaller = set_1;
+	}
+
+	TskSet set;
+	if (!tsk_set_clone(set_type, larger, &set)) {
+		return TSK_FALSE;
+	}
+
+	if (!tsk_set_reserve_additional(set_type, &set, tsk_set_length(set_type, smaller))) {
+		tsk_set_drop(set_type, &set);
+		return TSK_FALSE;
+	}
+
+	TskUSize index = 0;
+	for (;;) {
+		const TskAny *elements[TSK_SET_BATCH_LENGTH];
+		TskU64        hashes[TSK_SET_BATCH_LENGTH];
+		TskUSize      length = tsk_set_next_batch(set_type, smaller, &index, elements);
+		if (length == 0) {
+			break;
+		}
+
+		tsk_set_hash_batch(set_type, &set, elements, length, hashes);
+
+		for (TskUSize i = 0; i < length; i++) {
+			if (!tsk_set_contains_with_hash(set_type, &set, elements[i], hashes[i]) &&
+			    !tsk_set_insert_clone(set_type, &set, elements[i], hashes[i])) {
+				tsk_set_drop(set_type, &set);
+				return TSK_FALSE;
+			}
+		}
+	}
+
+	*set_3 = set;
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_set_intersection(const TskType *set_type, const TskSet *set_1, const TskSet *set_2, TskSet *set_3) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(tsk_set_is_valid(set_type, set_2));
+	assert(tsk_type_has_trait(tsk_set_element_type(set_type), TSK_TRAIT_ID_CLONABLE));
+	assert(set_3 != TSK_NULL);
+
+	const TskSet *larger  = set_1;
+	const TskSet *smaller = set_2;
+	if (tsk_set_length(set_type, set_1) < tsk_set_length(set_type, set_2)) {
+		larger  = set_2;
+		smaller = set_1;
+	}
+
+	TskSet set;
+	if (!tsk_map_clone_empty(tsk_set_map_type(set_type), &set_1->map, &set.map)) {
+		return TSK_FALSE;
+	}
+
+	TskUSize index = 0;
+	for (;;) {
+		const TskAny *elements[TSK_SET_BATCH_LENGTH];
+		TskU64        hashes[TSK_SET_BATCH_LENGTH];
+		TskUSize      length = tsk_set_next_batch(set_type, smaller, &index, elements);
+		if (length == 0) {
+			break;
+		}
+
+		tsk_set_hash_batch(set_type, larger, elements, length, hashes);
+
+		for (TskUSize i = 0; i < length; i++) {
+			if (tsk_set_contains_with_hash(set_type, larger, elements[i], hashes[i]) &&
+			    !tsk_set_insert_clone(set_type, &set, elements[i], tsk_map_hash(tsk_set_map_type(set_type), &set.map, tsk_set_element_type(set_type), elements[i]))) {
+				tsk_set_drop(set_type, &set);
+				return TSK_FALSE;
+			}
+		}
+	}
+
+	*set_3 = set;
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_set_difference(const TskType *set_type, const TskSet *set_1, const TskSet *set_2, TskSet *set_3) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(tsk_set_is_valid(set_type, set_2));
+	assert(tsk_type_has_trait(tsk_set_element_type(set_type), TSK_TRAIT_ID_CLONABLE));
+	assert(set_3 != TSK_NULL);
+
+	TskSet set;
+	if (tsk_set_length(set_type, set_1) <= tsk_set_length(set_type, set_2)) {
+		if (!tsk_map_clone_empty(tsk_set_map_type(set_type), &set_1->map, &set.map)) {
+			return TSK_FALSE;
+		}
+
+		if (!tsk_set_insert_clones(set_type, &set, set_1, set_2)) {
+			tsk_set_drop(set_type, &set);
+			return TSK_FALSE;
+		}
+
+		*set_3 = set;
+
+		return TSK_TRUE;
+	}
+
+	if (!tsk_set_clone(set_type, set_1, &set)) {
+		return TSK_FALSE;
+	}
+
+	TskUSize index = 0;
+	for (;;) {
+		const TskAny *elements[TSK_SET_BATCH_LENGTH];
+		TskU64        hashes[TSK_SET_BATCH_LENGTH];
+		TskUSize      length = tsk_set_next_batch(set_type, set_2, &index, elements);
+		if (length == 0) {
+			break;
+		}
+
+		tsk_set_hash_batch(set_type, &set, elements, length, hashes);
+
+		for (TskUSize i = 0; i < length; i++) {
+			(void)tsk_map_remove_with_hash(tsk_set_map_type(set_type), &set.map, elements[i], TSK_NULL, hashes[i]);
+		}
+	}
+
+	*set_3 = set;
+
+	return TSK_TRUE;
+}
+TskBoolean tsk_set_is_subset(const TskType *set_type, const TskSet *set_1, const TskSet *set_2) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(tsk_set_is_valid(set_type, set_2));
+
+	if (tsk_set_length(set_type, set_1) > tsk_set_length(set_type, set_2)) {
+		return TSK_FALSE;
+	}
+
+	return tsk_set_count_contained(set_type, set_1, set_2, SIZE_MAX) == tsk_set_length(set_type, set_1);
+}
+TskBoolean tsk_set_is_disjoint(const TskType *set_type, const TskSet *set_1, const TskSet *set_2) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(tsk_set_is_valid(set_type, set_2));
+
+	if (tsk_set_length(set_type, set_1) > tsk_set_length(set_type, set_2)) {
+		return tsk_set_count_contained(set_type, set_2, set_1, 1) == 0;
+	}
+
+	return tsk_set_count_contained(set_type, set_1, set_2, 1) == 0;
+}
+TskBoolean tsk_set_equals(const TskType *set_type, const TskSet *set_1, const TskSet *set_2) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set_1));
+	assert(tsk_set_is_valid(set_type, set_2));
+
+	return tsk_set_length(set_type, set_1) == tsk_set_length(set_type, set_2) &&
+	       tsk_set_is_subset(set_type, set_1, set_2);
+}
+
+TskEmpty tsk_set_type_trait_droppable_drop(const TskType *droppable_type, TskAny *droppable) {
+	tsk_set_drop(droppable_type, droppable);
+}
+TskBoolean tsk_set_type_trait_clonable_clone(const TskType *clonable_type, const TskAny *clonable_1, TskAny *clonable_2) {
+	return tsk_set_clone(clonable_type, clonable_1, clonable_2);
+}
+TskBoolean tsk_set_type_trait_equatable_equals(const TskType *equatable_type, const TskAny *equatable_1, const TskAny *equatable_2) {
+	return tsk_set_equals(equatable_type, equatable_1, equatable_2);
+}
+const TskType *tsk_set_type_trait_iterable_const_iterator_type(const TskType *iterable_type) {
+	return tsk_set_iterator_type_with_set_type(iterable_type);
+}
+TskEmpty tsk_set_type_trait_iterable_const_iterator(const TskType *iterable_type, const TskAny *iterable, TskAny *iterator) {
+	*(TskSetIterator *)iterator = tsk_set_iterator(iterable_type, iterable);
+}
+
+const TskTraitComplete tsk_set_type_trait_complete = {
+	.size      = sizeof(TskSet),
+	.alignment = alignof(TskSet),
+};
+const TskTraitDroppable tsk_set_type_trait_droppable = {
+	.drop = tsk_set_type_trait_droppable_drop,
+};
+const TskTraitClonable tsk_set_type_trait_clonable = {
+	.clone = tsk_set_type_trait_clonable_clone,
+};
+const TskTraitEquatable tsk_set_type_trait_equatable = {
+	.equals = tsk_set_type_trait_equatable_equals,
+};
+const TskTraitIterableConst tsk_set_type_trait_iterable_const = {
+	.iterator_type = tsk_set_type_trait_iterable_const_iterator_type,
+	.iterator      = tsk_set_type_trait_iterable_const_iterator,
+};
+
+TskTypeRegistry tsk_set_types_registry = TSK_TYPE_REGISTRY(sizeof(TskSetType));
+
+static inline TskBoolean tsk_set_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskSetType *set_type_entry = entry;
+	return set_type_entry->map_type == *(const TskType *const *)key;
+}
+
+TskBoolean tsk_set_type_is_valid(const TskType *set_type) {
+	return tsk_type_is_valid(set_type) &&
+	       tsk_type_registry_contains(&tsk_set_types_registry, set_type);
+}
+const TskType *tsk_set_type(const TskType *element_type) {
+	assert(tsk_type_is_valid(element_type));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE));
+
+	return tsk_set_type_with_engine(element_type, TSK_MAP_ENGINE_SWISS_TABLE);
+}
+const TskType *tsk_set_type_with_engine(const TskType *element_type, TskMapEngine engine) {
+	assert(tsk_type_is_valid(element_type));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE));
+
+	const TskType *map_type = tsk_map_type_with_engine(element_type, tsk_unit_type, engine);
+	if (map_type == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
+	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
+	tsk_trait_builder_build(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher);
+
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&map_type, sizeof(map_type)); // NOLINT(bugprone-sizeof-expression)
+	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
+
+	tsk_trait_droppable_drop(hasher_type, hasher);
+
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_set_types_registry, hash, tsk_set_types_equals, &map_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskSetType *)entry)->set_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
+	}
+
+	TskSetType *set_type_entry                                          = entry;
+
+	set_type_entry->set_type.trait_table                                = &set_type_entry->set_type_trait_table;
+	set_type_entry->set_type.layout                                     = &set_type_entry->set_type_layout;
+	set_type_entry->set_type_trait_table.entries                        = set_type_entry->set_type_trait_table_entries;
+	set_type_entry->set_type_trait_table.capacity                       = 0;
+
+	set_type_entry->set_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
+		.trait_id   = TSK_TRAIT_ID_COMPLETE,
+		.trait_data = &tsk_set_type_trait_complete,
+	};
+	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_DROPPABLE)) {
+		set_type_entry->set_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
+			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
+			.trait_data = &tsk_set_type_trait_droppable,
+		};
+	}
+	if (tsk_type_has_trait(element_type, TSK_TRAIT_ID_CLONABLE)) {
+		set_type_entry->set_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
+			.trait_id   = TSK_TRAIT_ID_CLONABLE,
+			.trait_data = &tsk_set_type_trait_clonable,
+		};
+	}
+	set_type_entry->set_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
+		.trait_id   = TSK_TRAIT_ID_EQUATABLE,
+		.trait_data = &tsk_set_type_trait_equatable,
+	};
+	set_type_entry->set_type_trait_table.entries[TSK_TRAIT_ID_ITERABLE_CONST] = (TskTypeTraitTableEntry){
+		.trait_id   = TSK_TRAIT_ID_ITERABLE_CONST,
+		.trait_data = &tsk_set_type_trait_iterable_const,
+	};
+
+	set_type_entry->element_type = element_type;
+	set_type_entry->map_type     = map_type;
+
+	(void)snprintf(
+	    set_type_entry->set_type_name,
+	    sizeof(set_type_entry->set_type_name),
+	    "TskSet<%s>",
+	    tsk_type_name(element_type)
+	);
+	set_type_entry->set_type.name = set_type_entry->set_type_name;
+
+	const TskType *set_type       = &set_type_entry->set_type;
+
+	(void)tsk_type_layout(set_type);
+
+	tsk_type_registry_publish(&tsk_set_types_registry, entry);
+
+	assert(tsk_set_type_is_valid(set_type));
+
+	return set_type;
+}
+
+typedef struct TskSetIteratorType TskSetIteratorType;
+struct TskSetIteratorType {
+	TskType        set_iterator_type;
+	TskCharacter   set_iterator_type_name[40];
+	const TskType *set_type;
+	const TskType *element_type;
+};
+
+TskBoolean tsk_set_iterator_is_valid(const TskType *set_iterator_type, const TskSetIterator *set_iterator) {
+	assert(tsk_set_iterator_type_is_valid(set_iterator_type));
+
+	return set_iterator != TSK_NULL && tsk_set_is_valid(tsk_set_iterator_set_type(set_iterator_type), set_iterator->set);
+}
+const TskType *tsk_set_iterator_set_type(const TskType *set_iterator_type) {
+	assert(tsk_set_iterator_type_is_valid(set_iterator_type));
+
+	return ((const TskSetIteratorType *)set_iterator_type)->set_type;
+}
+const TskType *tsk_set_iterator_element_type(const TskType *set_iterator_type) {
+	assert(tsk_set_iterator_type_is_valid(set_iterator_type));
+
+	return ((const TskSetIteratorType *)set_iterator_type)->element_type;
+}
+const TskType *tsk_set_iterator_item_type(const TskType *set_iterator_type) {
+	assert(tsk_set_iterator_type_is_valid(set_iterator_type));
+
+	return tsk_reference_const_type(tsk_set_iterator_element_type(set_iterator_type));
+}
+TskBoolean tsk_set_iterator_next(const TskType *set_iterator_type, TskSetIterator *set_iterator, TskAny *item) {
+	assert(tsk_set_iterator_type_is_valid(set_iterator_type));
+	assert(tsk_set_iterator_is_valid(set_iterator_type, set_iterator));
+	assert(item != TSK_NULL);
+
+	const TskAny *element = TSK_NULL;
+	if (!tsk_map_next_key(tsk_set_map_type(tsk_set_iterator_set_type(set_iterator_type)), &set_iterator->set->map, &set_iterator->index, &element)) {
+		return TSK_FALSE;
+	}
+
+	memcpy(item, &element, sizeof(element));
+
+	return TSK_TRUE;
+}
+
+const TskType *tsk_set_iterator_type_trait_iterator_item_type(const TskType *iterator_type) {
+	return tsk_set_iterator_item_type(iterator_type);
+}
+TskBoolean tsk_set_iterator_type_trait_iterator_next(const TskType *iterator_type, TskAny *iterator, TskAny *item) {
+	return tsk_set_iterator_next(iterator_type, iterator, item);
+}
+
+// clang-format off
+TSK_TYPE(tsk_set_iterator_type_, TskSetIterator,
+	TSK_TYPE_TRAIT(tsk_set_iterator_type_, TSK_TRAIT_ID_COMPLETE, &(TskTraitComplete){
+		.size      = sizeof(TskSetIterator),
+		.alignment = alignof(TskSetIterator),
+	}),
+	TSK_TYPE_TRAIT(tsk_set_iterator_type_, TSK_TRAIT_ID_DROPPABLE, &(TskTraitDroppable){
+		.drop = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_set_iterator_type_, TSK_TRAIT_ID_CLONABLE, &(TskTraitClonable){
+		.clone = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_set_iterator_type_, TSK_TRAIT_ID_EQUATABLE, &(TskTraitEquatable){
+		.equals = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_set_iterator_type_, TSK_TRAIT_ID_ITERATOR, &(TskTraitIterator){
+		.item_type = tsk_set_iterator_type_trait_iterator_item_type,
+		.next      = tsk_set_iterator_type_trait_iterator_next,
+	}),
+);
+// clang-format on
+
+TskTypeRegistry tsk_set_iterator_types_registry = TSK_TYPE_REGISTRY(sizeof(TskSetIteratorType));
+
+static inline TskBoolean tsk_set_iterator_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskSetIteratorType *set_iterator_type_entry = entry;
+	return set_iterator_type_entry->set_type == *(const TskType *const *)key;
+}
+
+TskBoolean tsk_set_iterator_type_is_valid(const TskType *set_iterator_type) {
+	return tsk_type_is_valid(set_iterator_type) &&
+	       tsk_type_registry_contains(&tsk_set_iterator_types_registry, set_iterator_type);
+}
+const TskType *tsk_set_iterator_type(const TskType *element_type) {
+	assert(tsk_type_is_valid(element_type));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_COMPLETE));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_EQUATABLE));
+	assert(tsk_type_has_trait(element_type, TSK_TRAIT_ID_HASHABLE));
+
+	return tsk_set_iterator_type_with_set_type(tsk_set_type(element_type));
+}
+const TskType *tsk_set_iterator_type_with_set_type(const TskType *set_type) {
+	assert(tsk_set_type_is_valid(set_type));
+
+	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
+	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
+	tsk_trait_builder_build(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher);
+
+	tsk_trait_hasher_combine(hasher_type, hasher, (const TskU8 *)&set_type, sizeof(set_type)); // NOLINT(bugprone-sizeof-expression)
+	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
+
+	tsk_trait_droppable_drop(hasher_type, hasher);
+
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_set_iterator_types_registry, hash, tsk_set_iterator_types_equals, &set_type, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskSetIteratorType *)entry)->set_iterator_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
+	}
+
+	TskSetIteratorType *set_iterator_type_entry = entry;
+
+	set_iterator_type_entry->set_iterator_type  = *tsk_set_iterator_type_;
+	set_iterator_type_entry->set_type           = set_type;
+	set_iterator_type_entry->element_type       = tsk_set_element_type(set_type);
+
+	(void)snprintf(
+	    set_iterator_type_entry->set_iterator_type_name,
+	    sizeof(set_iterator_type_entry->set_iterator_type_name),
+	    "TskSetIterator<%s>",
+	    tsk_type_name(tsk_set_element_type(set_type))
+	);
+	set_iterator_type_entry->set_iterator_type.name = set_iterator_type_entry->set_iterator_type_name;
+
+	const TskType *set_iterator_type                = &set_iterator_type_entry->set_iterator_type;
+
+	tsk_type_registry_publish(&tsk_set_iterator_types_registry, entry);
+
+	assert(tsk_set_iterator_type_is_valid(set_iterator_type));
+
+	return set_iterator_type;
+}
+
+TskSetIterator tsk_set_iterator(const TskType *set_type, const TskSet *set) {
+	assert(tsk_set_type_is_valid(set_type));
+	assert(tsk_set_is_valid(set_type, set));
+
+	TskSetIterator set_iterator = {
+		.set   = set,
+		.index = 0,
+	};
+
+	assert(tsk_set_iterator_is_valid(tsk_set_iterator_type_with_set_type(set_type), &set_iterator));
+
+	return set_iterator;
+}
@@ -0,0 +1,221 @@
+#include <tsk/sip_hasher.h>
+
+#include <tsk/trait/builder.h>
+#include <tsk/trait/clonable.h>
+#include <tsk/trait/complete.h>
+#include <tsk/trait/droppable.h>
+#include <tsk/trait/hasher.h>
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <threads.h>
+#include <time.h>
+
+typedef struct TskSipHasher TskSipHasher;
+struct TskSipHasher {
+	TskU64   v_0;
+	TskU64   v_1;
+	TskU64   v_2;
+	TskU64   v_3;
+	TskU64   tail;
+	TskUSize tail_length;
+	TskUSize length;
+};
+
+static inline TskU64 tsk_sip_hasher_rotate(TskU64 value, TskU32 shift) {
+	return (value << shift) | (value >> (64 - shift));
+}
+static inline TskEmpty tsk_sip_hasher_round(TskSipHasher *hasher) {
+	hasher->v_0 += hasher->v_1;
+	hasher->v_1 = tsk_sip_hasher_rotate(hasher->v_1, 13);
+	hasher->v_1 ^= hasher->v_0;
+	hasher->v_0 = tsk_sip_hasher_rotate(hasher->v_0, 32);
+	hasher->v_2 += hasher->v_3;
+	hasher->v_3 = tsk_sip_hasher_rotate(hasher->v_3, 16);
+	hasher->v_3 ^= hasher->v_2;
+	hasher->v_0 += hasher->v_3;
+	hasher->v_3 = tsk_sip_hasher_rotate(hasher->v_3, 21);
+	hasher->v_3 ^= hasher->v_0;
+	hasher->v_2 += hasher->v_1;
+	hasher->v_1 = tsk_sip_hasher_rotate(hasher->v_1, 17);
+	hasher->v_1 ^= hasher->v_2;
+	hasher->v_2 = tsk_sip_hasher_rotate(hasher->v_2, 32);
+}
+static inline TskEmpty tsk_sip_hasher_compress(TskSipHasher *hasher, TskU64 word) {
+	hasher->v_3 ^= word;
+	tsk_sip_hasher_round(hasher);
+	hasher->v_0 ^= word;
+}
+static inline TskU64 tsk_sip_hasher_read(const TskU8 *bytes, TskUSize length) {
+	TskU64 word = 0;
+	for (TskUSize i = 0; i < length; i++) {
+		word |= (TskU64)bytes[i] << (8 * i);
+	}
+	return word;
+}
+
+TskEmpty tsk_sip_hasher_combine(TskSipHasher *hasher, const TskU8 *bytes, TskUSize length) {
+	assert(hasher != TSK_NULL);
+	assert(bytes != TSK_NULL || length == 0);
+
+	hasher->length += length;
+
+	if (hasher->tail_length != 0) {
+		TskUSize needed = sizeof(TskU64) - hasher->tail_length;
+		if (length < needed) {
+			hasher->tail |= tsk_sip_hasher_read(bytes, length) << (8 * hasher->tail_length);
+			hasher->tail_length += length;
+			return;
+		}
+
+		tsk_sip_hasher_compress(hasher, hasher->tail | (tsk_sip_hasher_read(bytes, needed) << (8 * hasher->tail_length)));
+		bytes += needed;
+		length -= needed;
+		hasher->tail        = 0;
+		hasher->tail_length = 0;
+	}
+
+	for (; length >= sizeof(TskU64); bytes += sizeof(TskU64), length -= sizeof(TskU64)) {
+		TskU64 word = 0;
+		memcpy(&word, bytes, sizeof(word));
+		tsk_sip_hasher_compress(hasher, word);
+	}
+
+	hasher->tail        = tsk_sip_hasher_read(bytes, length);
+	hasher->tail_length = length;
+}
+TskU64 tsk_sip_hasher_finalize(const TskSipHasher *hasher) {
+	assert(hasher != TSK_NULL);
+
+	TskSipHasher state = *hasher;
+	tsk_sip_hasher_compress(&state, state.tail | ((TskU64)state.length << 56));
+
+	state.v_2 ^= 0xFF;
+	tsk_sip_hasher_round(&state);
+	tsk_sip_hasher_round(&state);
+	tsk_sip_hasher_round(&state);
+
+	return state.v_0 ^ state.v_1 ^ state.v_2 ^ state.v_3;
+}
+
+TskEmpty tsk_sip_hasher_type_trait_hasher_combine(const TskType *hasher_type, TskAny *hasher, const TskU8 *bytes, TskUSize length) {
+	(TskEmpty) hasher_type;
+	tsk_sip_hasher_combine(hasher, bytes, length);
+}
+TskU64 tsk_sip_hasher_type_trait_hasher_finalize(const TskType *hasher_type, const TskAny *hasher) {
+	(TskEmpty) hasher_type;
+	return tsk_sip_hasher_finalize(hasher);
+}
+
+// clang-format off
+TSK_TYPE(tsk_sip_hasher_type, TskSipHasher,
+	TSK_TYPE_TRAIT(tsk_sip_hasher_type, TSK_TRAIT_ID_COMPLETE, &(TskTraitComplete){
+		.size      = sizeof(TskSipHasher),
+		.alignment = alignof(TskSipHasher),
+	}),
+	TSK_TYPE_TRAIT(tsk_sip_hasher_type, TSK_TRAIT_ID_DROPPABLE, &(TskTraitDroppable){
+		.drop = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_sip_hasher_type, TSK_TRAIT_ID_CLONABLE, &(TskTraitClonable){
+		.clone = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_sip_hasher_type, TSK_TRAIT_ID_HASHER, &(TskTraitHasher){
+		.combine  = tsk_sip_hasher_type_trait_hasher_combine,
+		.finalize = tsk_sip_hasher_type_trait_hasher_finalize,
+	}),
+);
+// clang-format on
+
+static inline TskU64 tsk_sip_hasher_builder_mix(TskU64 value) {
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+static once_flag       tsk_sip_hasher_builder_random_once = ONCE_FLAG_INIT;
+static _Atomic(TskU64) tsk_sip_hasher_builder_random_state;
+static _Atomic(TskU64) tsk_sip_hasher_builder_random_key;
+
+static TskEmpty tsk_sip_hasher_builder_random_initialize(TskEmpty) {
+	TskU64 seed[2] = { 0, 0 };
+
+	FILE  *file    = fopen("/dev/urandom", "rb");
+	if (file == TSK_NULL || fread(seed, sizeof(seed), 1, file) != 1) {
+		struct timespec time;
+		timespec_get(&time, TIME_UTC);
+
+		seed[0] = (TskU64)time.tv_sec ^ (TskU64)(uintptr_t)&time;
+		seed[1] = (TskU64)time.tv_nsec ^ (TskU64)(uintptr_t)&tsk_sip_hasher_builder_random_state;
+	}
+	if (file != TSK_NULL) {
+		fclose(file);
+	}
+
+	atomic_store_explicit(&tsk_sip_hasher_builder_random_state, seed[0], memory_order_relaxed);
+	atomic_store_explicit(&tsk_sip_hasher_builder_random_key, seed[1], memory_order_relaxed);
+}
+
+TskSipHasherBuilder tsk_sip_hasher_builder_new(TskU64 key_0, TskU64 key_1) {
+	return (TskSipHasherBuilder){
+		.key_0 = key_0,
+		.key_1 = key_1,
+	};
+}
+TskSipHasherBuilder tsk_sip_hasher_builder_random(TskEmpty) {
+	call_once(&tsk_sip_hasher_builder_random_once, tsk_sip_hasher_builder_random_initialize);
+
+	TskU64 state = atomic_fetch_add_explicit(&tsk_sip_hasher_builder_random_state, 0x9E3779B97F4A7C15ULL, memory_order_relaxed) + 0x9E3779B97F4A7C15ULL;
+
+	return tsk_sip_hasher_builder_new(
+	    tsk_sip_hasher_builder_mix(state),
+	    tsk_sip_hasher_builder_mix(state ^ atomic_load_explicit(&tsk_sip_hasher_builder_random_key, memory_order_relaxed))
+	);
+}
+
+const TskType *tsk_sip_hasher_builder_built_type(TskEmpty) {
+	return tsk_sip_hasher_type;
+}
+TskEmpty tsk_sip_hasher_builder_build(const TskSipHasherBuilder *hasher_builder, TskSipHasher *hasher) {
+	assert(hasher_builder != TSK_NULL);
+	assert(hasher != TSK_NULL);
+
+	hasher->v_0         = hasher_builder->key_0 ^ 0x736F6D6570736575ULL;
+	hasher->v_1         = hasher_builder->key_1 ^ 0x646F72616E646F6DULL;
+	hasher->v_2         = hasher_builder->key_0 ^ 0x6C7967656E657261ULL;
+	hasher->v_3         = hasher_builder->key_1 ^ 0x7465646279746573ULL;
+	hasher->tail        = 0;
+	hasher->tail_length = 0;
+	hasher->length      = 0;
+}
+
+const TskType *tsk_sip_hasher_builder_type_trait_builder_built_type(const TskType *builder_type) {
+	(TskEmpty) builder_type;
+	return tsk_sip_hasher_builder_built_type();
+}
+TskEmpty tsk_sip_hasher_builder_type_trait_builder_build(const TskType *builder_type, const TskAny *hasher_builder, TskAny *hasher) {
+	(TskEmpty) builder_type;
+	tsk_sip_hasher_builder_build((const TskSipHasherBuilder *)hasher_builder, (TskSipHasher *)hasher);
+}
+
+// clang-format off
+TSK_TYPE(tsk_sip_hasher_builder_type_, TskSipHasherBuilder,
+	TSK_TYPE_TRAIT(tsk_sip_hasher_builder_type_, TSK_TRAIT_ID_COMPLETE, &(TskTraitComplete){
+		.size      = sizeof(TskSipHasherBuilder),
+		.alignment = alignof(TskSipHasherBuilder),
+	}),
+	TSK_TYPE_TRAIT(tsk_sip_hasher_builder_type_, TSK_TRAIT_ID_DROPPABLE, &(TskTraitDroppable){
+		.drop = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_sip_hasher_builder_type_, TSK_TRAIT_ID_CLONABLE, &(TskTraitClonable){
+		.clone = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_sip_hasher_builder_type_, TSK_TRAIT_ID_BUILDER, &(TskTraitBuilder){
+		.built_type = tsk_sip_hasher_builder_type_trait_builder_built_type,
+		.build      = tsk_sip_hasher_builder_type_trait_builder_build,
+	}),
+);
+// clang-format on
+const TskType *tsk_sip_hasher_builder_type = tsk_sip_hasher_builder_type_;
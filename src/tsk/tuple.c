@@ -9,10 +9,11 @@
 #include <tsk/trait/equatable.h>
 #include <tsk/trait/hashable.h>
 #include <tsk/trait/hasher.h>
+#include <tsk/type_registry.h>
 
 #include <assert.h>
 #include <stdio.h>
-#include <string.h>
+#include <stdlib.h>
 
 typedef struct TskTupleType TskTupleType;
 struct TskTupleType {
@@ -20,7 +21,8 @@ struct TskTupleType {
 	TskCharacter           tuple_type_name[96];
 	TskTraitComplete       tuple_type_complete_trait;
 	TskTypeTraitTable      tuple_type_trait_table;
-	TskTypeTraitTableEntry tuple_type_trait_table_entries[16];
+	TskTypeTraitTableEntry tuple_type_trait_table_entries[TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH];
+	TskTypeLayout          tuple_type_layout;
 	const TskType *const  *element_types;
 	const TskUSize        *element_offsets;
 	TskUSize               length;
@@ -181,23 +183,33 @@ const TskTraitHashable tsk_tuple_type_trait_hashable = {
 	.hash = tsk_tuple_type_trait_hashable_hash,
 };
 
-#define TSK_TUPLE_TYPES_CAPACITY ((TskUSize)1 << 7)
-#define TSK_TUPLE_TYPES_ELEMENTS_CAPACITY ((TskUSize)1 << 9)
+TskTypeRegistry tsk_tuple_types_registry = TSK_TYPE_REGISTRY(sizeof(TskTupleType));
 
-TskTupleType   tsk_tuple_types[TSK_TUPLE_TYPES_CAPACITY];
-const TskType *tsk_tuple_types_element_types[TSK_TUPLE_TYPES_ELEMENTS_CAPACITY];
-TskUSize       tsk_tuple_types_element_offsets[TSK_TUPLE_TYPES_ELEMENTS_CAPACITY];
-TskUSize       tsk_tuple_types_length = 0;
+typedef struct TskTupleTypeKey TskTupleTypeKey;
+struct TskTupleTypeKey {
+	const TskType **element_types;
+	TskUSize        length;
+};
+
+static inline TskBoolean tsk_tuple_types_equals(const TskAny *entry, const TskAny *key) {
+	const TskTupleType *tuple_type_entry  = entry;
+	const TskTupleTypeKey *tuple_type_key = key;
+	if (tuple_type_entry->length != tuple_type_key->length) {
+		return TSK_FALSE;
+	}
+	for (TskUSize i = 0; i < tuple_type_key->length; i++) {
+		if (tuple_type_entry->element_types[i] != tuple_type_key->element_types[i]) {
+			return TSK_FALSE;
+		}
+	}
+	return TSK_TRUE;
+}
 
 TskBoolean tsk_tuple_type_is_valid(const TskType *tuple_type) {
 	return tsk_type_is_valid(tuple_type) &&
-	       &tsk_tuple_types[0] <= (const TskTupleType *)tuple_type && (const TskTupleType *)tuple_type < &tsk_tuple_types[TSK_TUPLE_TYPES_CAPACITY];
+	       tsk_type_registry_contains(&tsk_tuple_types_registry, tuple_type);
 }
 const TskType *tsk_tuple_type(const TskType **element_types, TskUSize length) {
-	if (tsk_tuple_types_length + length > TSK_TUPLE_TYPES_ELEMENTS_CAPACITY) {
-		return TSK_NULL;
-	}
-
 	const TskType             *hasher_type = tsk_trait_builder_built_type(tsk_default_hasher_builder_type);
 	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
 	tsk_trait_builder_build(tsk_default_hasher_builder_type, tsk_default_hasher_builder, hasher);
@@ -210,32 +222,26 @@ const TskType *tsk_tuple_type(const TskType **element_types, TskUSize length) {
 
 	tsk_trait_droppable_drop(hasher_type, hasher);
 
-	TskUSize starting_index = hash & (TSK_TUPLE_TYPES_CAPACITY - 1);
-	TskUSize index          = starting_index;
-	while (tsk_tuple_types[index].element_types != TSK_NULL) {
-		TskBoolean is_equal = true;
-		if (tsk_tuple_types[index].length == length) {
-			for (TskUSize i = 0; i < length; i++) {
-				if (tsk_tuple_types[index].element_types[i] != element_types[i]) {
-					is_equal = false;
-					break;
-				}
-			}
-		} else {
-			is_equal = false;
-		}
-		if (is_equal) {
-			return &tsk_tuple_types[index].tuple_type;
-		}
-		index = (index + 1) & (TSK_TUPLE_TYPES_CAPACITY - 1);
-		if (index == starting_index) {
-			return TSK_NULL;
-		}
+	TskAny *entry = TSK_NULL;
+	switch (tsk_type_registry_find_or_claim(&tsk_tuple_types_registry, hash, tsk_tuple_types_equals, &(TskTupleTypeKey){ .element_types = element_types, .length = length }, &entry)) {
+		case TSK_TYPE_REGISTRY_RESULT_FOUND: return &((TskTupleType *)entry)->tuple_type;
+		case TSK_TYPE_REGISTRY_RESULT_FULL: return TSK_NULL;
+		case TSK_TYPE_REGISTRY_RESULT_CLAIMED: break;
 	}
 
-	TskUSize *element_offsets = &tsk_tuple_types_element_offsets[tsk_tuple_types_length];
-	TskUSize  element_offset  = 0;
-	TskUSize  alignment       = 1;
+	TskTupleType *tuple_type_entry      = entry;
+
+	const TskType **tuple_element_types = malloc(length * sizeof(const TskType *));
+	TskUSize       *element_offsets     = malloc(length * sizeof(TskUSize));
+	if (length != 0 && (tuple_element_types == TSK_NULL || element_offsets == TSK_NULL)) {
+		free(tuple_element_types);
+		free(element_offsets);
+		tsk_type_registry_abandon(&tsk_tuple_types_registry, entry);
+		return TSK_NULL;
+	}
+
+	TskUSize  element_offset = 0;
+	TskUSize  alignment      = 1;
 	for (TskUSize i = 0; i < length; i++) {
 		assert(tsk_type_is_valid(element_types[i]));
 		assert(tsk_type_has_trait(element_types[i], TSK_TRAIT_ID_COMPLETE));
@@ -252,13 +258,14 @@ const TskType *tsk_tuple_type(const TskType **element_types, TskUSize length) {
 		element_offset += element_size;
 	}
 
-	TskUSize size                                          = (element_offset + alignment - 1) & ~(alignment - 1);
+	TskUSize size                                     = (element_offset + alignment - 1) & ~(alignment - 1);
 
-	tsk_tuple_types[index].tuple_type.trait_table          = &tsk_tuple_types[index].tuple_type_trait_table;
-	tsk_tuple_types[index].tuple_type_trait_table.entries  = tsk_tuple_types[index].tuple_type_trait_table_entries;
-	tsk_tuple_types[index].tuple_type_trait_table.capacity = sizeof(tsk_tuple_types[index].tuple_type_trait_table_entries) / sizeof(tsk_tuple_types[index].tuple_type_trait_table_entries[0]);
+	tuple_type_entry->tuple_type.trait_table          = &tuple_type_entry->tuple_type_trait_table;
+	tuple_type_entry->tuple_type.layout               = &tuple_type_entry->tuple_type_layout;
+	tuple_type_entry->tuple_type_trait_table.entries  = tuple_type_entry->tuple_type_trait_table_entries;
+	tuple_type_entry->tuple_type_trait_table.capacity = 0;
 
-	tsk_tuple_types[index].tuple_type_complete_trait       = (TskTraitComplete){
+	tuple_type_entry->tuple_type_complete_trait       = (TskTraitComplete){
 		      .size      = size,
 		      .alignment = alignment,
 	};
@@ -288,68 +295,74 @@ const TskType *tsk_tuple_type(const TskType **element_types, TskUSize length) {
 		}
 	}
 
-	tsk_tuple_types[index].tuple_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE & (tsk_tuple_types[index].tuple_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+	tuple_type_entry->tuple_type_trait_table.entries[TSK_TRAIT_ID_COMPLETE] = (TskTypeTraitTableEntry){
 		.trait_id   = TSK_TRAIT_ID_COMPLETE,
-		.trait_data = &tsk_tuple_types[index].tuple_type_complete_trait,
+		.trait_data = &tuple_type_entry->tuple_type_complete_trait,
 	};
 	if (is_droppable) {
-		tsk_tuple_types[index].tuple_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE & (tsk_tuple_types[index].tuple_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		tuple_type_entry->tuple_type_trait_table.entries[TSK_TRAIT_ID_DROPPABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_DROPPABLE,
 			.trait_data = &tsk_tuple_type_trait_droppable,
 		};
 	}
 	if (is_clonable) {
-		tsk_tuple_types[index].tuple_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE & (tsk_tuple_types[index].tuple_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		tuple_type_entry->tuple_type_trait_table.entries[TSK_TRAIT_ID_CLONABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_CLONABLE,
 			.trait_data = &tsk_tuple_type_trait_clonable,
 		};
 	}
 	if (is_comparable) {
-		tsk_tuple_types[index].tuple_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE & (tsk_tuple_types[index].tuple_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		tuple_type_entry->tuple_type_trait_table.entries[TSK_TRAIT_ID_COMPARABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_COMPARABLE,
 			.trait_data = &tsk_tuple_type_trait_comparable,
 		};
 	}
 	if (is_equatable) {
-		tsk_tuple_types[index].tuple_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE & (tsk_tuple_types[index].tuple_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		tuple_type_entry->tuple_type_trait_table.entries[TSK_TRAIT_ID_EQUATABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_EQUATABLE,
 			.trait_data = &tsk_tuple_type_trait_equatable,
 		};
 	}
 	if (is_hashable) {
-		tsk_tuple_types[index].tuple_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE & (tsk_tuple_types[index].tuple_type_trait_table.capacity - 1)] = (TskTypeTraitTableEntry){
+		tuple_type_entry->tuple_type_trait_table.entries[TSK_TRAIT_ID_HASHABLE] = (TskTypeTraitTableEntry){
 			.trait_id   = TSK_TRAIT_ID_HASHABLE,
 			.trait_data = &tsk_tuple_type_trait_hashable,
 		};
 	}
 
-	tsk_tuple_types[index].element_types   = memcpy(&tsk_tuple_types_element_types[tsk_tuple_types_length], element_types, length * sizeof(const TskType *));
-	tsk_tuple_types[index].element_offsets = element_offsets;
-	tsk_tuple_types_length += length;
+	for (TskUSize i = 0; i < length; i++) {
+		tuple_element_types[i] = element_types[i];
+	}
+	tuple_type_entry->element_types   = tuple_element_types;
+	tuple_type_entry->element_offsets = element_offsets;
 
-	tsk_tuple_types[index].length = length;
+	tuple_type_entry->length          = length;
 
-	TskUSize j                    = (TskUSize)snprintf(
-      tsk_tuple_types[index].tuple_type_name,
-      sizeof(tsk_tuple_types[index].tuple_type_name),
+	TskUSize j                        = (TskUSize)snprintf(
+      tuple_type_entry->tuple_type_name,
+      sizeof(tuple_type_entry->tuple_type_name),
       "TskTuple<"
   );
-	for (TskUSize i = 0; i < length && j < sizeof(tsk_tuple_types[index].tuple_type_name); i++) {
+	for (TskUSize i = 0; i < length && j < sizeof(tuple_type_entry->tuple_type_name); i++) {
 		j += (TskUSize)snprintf(
-		    tsk_tuple_types[index].tuple_type_name + j,
-		    sizeof(tsk_tuple_types[index].tuple_type_name) - j,
+		    tuple_type_entry->tuple_type_name + j,
+		    sizeof(tuple_type_entry->tuple_type_name) - j,
 		    i != 0 ? ", %s" : "%s",
 		    tsk_type_name(element_types[i])
 		);
 	}
 	(TskEmpty) snprintf(
-	    tsk_tuple_types[index].tuple_type_name + j,
-	    sizeof(tsk_tuple_types[index].tuple_type_name) - j,
+	    tuple_type_entry->tuple_type_name + j,
+	    sizeof(tuple_type_entry->tuple_type_name) - j,
 	    ">"
 	);
-	tsk_tuple_types[index].tuple_type.name = tsk_tuple_types[index].tuple_type_name;
+	tuple_type_entry->tuple_type.name = tuple_type_entry->tuple_type_name;
+
+	const TskType *tuple_type         = &tuple_type_entry->tuple_type;
+
+	(void)tsk_type_layout(tuple_type);
 
-	const TskType *tuple_type              = &tsk_tuple_types[index].tuple_type;
+	tsk_type_registry_publish(&tsk_tuple_types_registry, entry);
 
 	assert(tsk_tuple_type_is_valid(tuple_type));
 
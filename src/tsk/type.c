@@ -1,3 +1,5 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <tsk/type.h>
 
 #include <tsk/default_hasher.h>
@@ -11,10 +13,17 @@
 #include <tsk/trait/hasher.h>
 
 #include <assert.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#define TSK_TYPE_LAYOUT_STATE_UNINITIALIZED ((TskU8)0)
+#define TSK_TYPE_LAYOUT_STATE_INITIALIZING ((TskU8)1)
+#define TSK_TYPE_LAYOUT_STATE_INITIALIZED ((TskU8)2)
 
 TskBoolean tsk_type_is_valid(const TskType *type) {
 	return type != TSK_NULL && type->name != TSK_NULL &&
-	       type->trait_table != TSK_NULL && (type->trait_table->entries != TSK_NULL || type->trait_table->capacity == 0) && (type->trait_table->capacity & (type->trait_table->capacity - 1)) == 0;
+	       type->trait_table != TSK_NULL && type->trait_table->entries != TSK_NULL && (type->trait_table->capacity & (type->trait_table->capacity - 1)) == 0 &&
+	       type->layout != TSK_NULL;
 }
 const TskCharacter *tsk_type_name(const TskType *type) {
 	assert(tsk_type_is_valid(type));
@@ -24,11 +33,20 @@ const TskCharacter *tsk_type_name(const TskType *type) {
 const TskAny *tsk_type_trait(const TskType *type, TskTraitID trait_id) {
 	assert(tsk_type_is_valid(type));
 
-	TskUSize starting_index = trait_id & (type->trait_table->capacity - 1);
-	TskUSize index          = starting_index;
-	while (type->trait_table->entries[index].trait_data != TSK_NULL) {
-		if (type->trait_table->entries[index].trait_id == trait_id) {
-			return type->trait_table->entries[index].trait_data;
+	if (trait_id < TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH) {
+		return type->trait_table->entries[trait_id].trait_data;
+	}
+
+	if (type->trait_table->capacity == 0) {
+		return TSK_NULL;
+	}
+
+	const TskTypeTraitTableEntry *entries        = type->trait_table->entries + TSK_TYPE_TRAIT_TABLE_DIRECT_LENGTH;
+	TskUSize                      starting_index = trait_id & (type->trait_table->capacity - 1);
+	TskUSize                      index          = starting_index;
+	while (entries[index].trait_data != TSK_NULL) {
+		if (entries[index].trait_id == trait_id) {
+			return entries[index].trait_data;
 		}
 		index = (index + 1) & (type->trait_table->capacity - 1);
 		if (index == starting_index) {
@@ -41,6 +59,40 @@ const TskAny *tsk_type_trait(const TskType *type, TskTraitID trait_id) {
 TskBoolean tsk_type_has_trait(const TskType *type, TskTraitID trait_id) {
 	return tsk_type_trait(type, trait_id) != TSK_NULL;
 }
+const TskTypeLayout *tsk_type_layout(const TskType *type) {
+	assert(tsk_type_is_valid(type));
+
+	TskTypeLayout *layout = type->layout;
+	TskU8          state  = atomic_load_explicit(&layout->state, memory_order_acquire);
+	if (state == TSK_TYPE_LAYOUT_STATE_INITIALIZED) {
+		return layout;
+	}
+
+	if (state == TSK_TYPE_LAYOUT_STATE_UNINITIALIZED && atomic_compare_exchange_strong_explicit(&layout->state, &state, TSK_TYPE_LAYOUT_STATE_INITIALIZING, memory_order_acquire, memory_order_acquire)) {
+		const TskTraitComplete  *complete_trait  = tsk_type_trait(type, TSK_TRAIT_ID_COMPLETE);
+		const TskTraitDroppable *droppable_trait = tsk_type_trait(type, TSK_TRAIT_ID_DROPPABLE);
+		const TskTraitClonable  *clonable_trait  = tsk_type_trait(type, TSK_TRAIT_ID_CLONABLE);
+		const TskTraitEquatable *equatable_trait = tsk_type_trait(type, TSK_TRAIT_ID_EQUATABLE);
+		const TskTraitHashable  *hashable_trait  = tsk_type_trait(type, TSK_TRAIT_ID_HASHABLE);
+
+		layout->size                             = complete_trait != TSK_NULL ? complete_trait->size : 0;
+		layout->alignment                        = complete_trait != TSK_NULL ? complete_trait->alignment : 0;
+		layout->is_trivially_droppable           = droppable_trait != TSK_NULL && droppable_trait->drop == TSK_NULL;
+		layout->is_trivially_clonable            = complete_trait != TSK_NULL && clonable_trait != TSK_NULL && clonable_trait->clone == TSK_NULL;
+		layout->is_bitwise_equatable             = complete_trait != TSK_NULL && equatable_trait != TSK_NULL && equatable_trait->equals == TSK_NULL;
+		layout->is_bytewise_hashable             = complete_trait != TSK_NULL && hashable_trait != TSK_NULL && hashable_trait->hash == TSK_NULL;
+
+		atomic_store_explicit(&layout->state, TSK_TYPE_LAYOUT_STATE_INITIALIZED, memory_order_release);
+
+		return layout;
+	}
+
+	while (atomic_load_explicit(&layout->state, memory_order_acquire) != TSK_TYPE_LAYOUT_STATE_INITIALIZED) {
+		(void)sched_yield();
+	}
+
+	return layout;
+}
 
 // clang-format off
 TSK_TYPE(tsk_unit_type, TskUnit,
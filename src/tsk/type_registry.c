@@ -0,0 +1,261 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <tsk/type_registry.h>
+
+#include <assert.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define TSK_TYPE_REGISTRY_TABLE_INITIAL_CAPACITY ((TskUSize)1 << 7)
+#define TSK_TYPE_REGISTRY_SEGMENT_INITIAL_CAPACITY ((TskUSize)1 << 4)
+#define TSK_TYPE_REGISTRY_MAXIMUM_LENGTH ((TskUSize)UINT32_MAX - 1)
+
+#define TSK_TYPE_REGISTRY_SLOT_EMPTY ((TskU64)0)
+#define TSK_TYPE_REGISTRY_SLOT_FROZEN (~(TskU64)0)
+
+#define TSK_TYPE_REGISTRY_STATE_CLAIMED ((TskU8)0)
+#define TSK_TYPE_REGISTRY_STATE_PUBLISHED ((TskU8)1)
+#define TSK_TYPE_REGISTRY_STATE_ABANDONED ((TskU8)2)
+
+static inline TskU64 tsk_type_registry_slot(TskU64 hash, TskUSize index) {
+	return (hash & ~(TskU64)UINT32_MAX) | (TskU64)(index + 1);
+}
+static inline TskUSize tsk_type_registry_slot_index(TskU64 slot) {
+	return (TskUSize)(slot & UINT32_MAX) - 1;
+}
+static inline TskUSize tsk_type_registry_slot_position(TskU64 hash, TskUSize capacity) {
+	return (TskUSize)(hash >> 32) & (capacity - 1);
+}
+
+static inline TskUSize tsk_type_registry_segment(TskUSize index) {
+	return (TskUSize)(63 - __builtin_clzll((unsigned long long)(index / TSK_TYPE_REGISTRY_SEGMENT_INITIAL_CAPACITY) + 1));
+}
+static inline TskUSize tsk_type_registry_segment_capacity(TskUSize segment) {
+	return TSK_TYPE_REGISTRY_SEGMENT_INITIAL_CAPACITY << segment;
+}
+static inline TskUSize tsk_type_registry_segment_start(TskUSize segment) {
+	return tsk_type_registry_segment_capacity(segment) - TSK_TYPE_REGISTRY_SEGMENT_INITIAL_CAPACITY;
+}
+
+static TskU8 *tsk_type_registry_segment_get(TskTypeRegistry *registry, TskUSize segment) {
+	assert(registry != TSK_NULL);
+	assert(segment < TSK_TYPE_REGISTRY_SEGMENTS_LENGTH);
+
+	TskU8 *entries = atomic_load_explicit(&registry->segments[segment], memory_order_acquire);
+	if (entries != TSK_NULL) {
+		return entries;
+	}
+
+	TskUSize capacity          = tsk_type_registry_segment_capacity(segment);
+	TskU8   *allocated_entries = calloc(capacity, registry->entry_size + sizeof(TskU64) + sizeof(_Atomic(TskU8)));
+	if (allocated_entries == TSK_NULL) {
+		return TSK_NULL;
+	}
+
+	if (!atomic_compare_exchange_strong_explicit(&registry->segments[segment], &entries, allocated_entries, memory_order_acq_rel, memory_order_acquire)) {
+		free(allocated_entries);
+		return entries;
+	}
+
+	return allocated_entries;
+}
+static inline TskAny *tsk_type_registry_entry(TskTypeRegistry *registry, TskUSize index) {
+	TskUSize segment = tsk_type_registry_segment(index);
+	return atomic_load_explicit(&registry->segments[segment], memory_order_acquire) + ((index - tsk_type_registry_segment_start(segment)) * registry->entry_size);
+}
+static inline TskU64 *tsk_type_registry_hash(TskTypeRegistry *registry, TskUSize index) {
+	TskUSize segment = tsk_type_registry_segment(index);
+	TskU8   *entries = atomic_load_explicit(&registry->segments[segment], memory_order_acquire);
+	return (TskU64 *)(entries + (tsk_type_registry_segment_capacity(segment) * registry->entry_size)) + (index - tsk_type_registry_segment_start(segment));
+}
+static inline _Atomic(TskU8) *tsk_type_registry_state(TskTypeRegistry *registry, TskUSize index) {
+	TskUSize segment = tsk_type_registry_segment(index);
+	TskU8   *entries = atomic_load_explicit(&registry->segments[segment], memory_order_acquire);
+	return (_Atomic(TskU8) *)(entries + (tsk_type_registry_segment_capacity(segment) * (registry->entry_size + sizeof(TskU64)))) + (index - tsk_type_registry_segment_start(segment));
+}
+static inline const _Atomic(TskU8) *tsk_type_registry_state_const(const TskTypeRegistry *registry, TskUSize index) {
+	TskUSize     segment = tsk_type_registry_segment(index);
+	const TskU8 *entries = atomic_load_explicit(&registry->segments[segment], memory_order_acquire);
+	return (const _Atomic(TskU8) *)(entries + (tsk_type_registry_segment_capacity(segment) * (registry->entry_size + sizeof(TskU64)))) + (index - tsk_type_registry_segment_start(segment));
+}
+static TskBoolean tsk_type_registry_entry_index(const TskTypeRegistry *registry, const TskAny *entry, TskUSize *index) {
+	assert(registry != TSK_NULL);
+
+	for (TskUSize segment = 0; segment < TSK_TYPE_REGISTRY_SEGMENTS_LENGTH; segment++) {
+		const TskU8 *entries = atomic_load_explicit(&registry->segments[segment], memory_order_acquire);
+		if (entries == TSK_NULL) {
+			continue;
+		}
+
+		uintptr_t start  = (uintptr_t)entries;
+		uintptr_t end    = start + (tsk_type_registry_segment_capacity(segment) * registry->entry_size);
+		uintptr_t offset = (uintptr_t)entry - start;
+		if (start <= (uintptr_t)entry && (uintptr_t)entry < end && offset % registry->entry_size == 0) {
+			if (index != TSK_NULL) {
+				*index = tsk_type_registry_segment_start(segment) + (offset / registry->entry_size);
+			}
+			return TSK_TRUE;
+		}
+	}
+
+	return TSK_FALSE;
+}
+
+static TskBoolean tsk_type_registry_grow(TskTypeRegistry *registry, TskTypeRegistryTable *table) {
+	assert(registry != TSK_NULL);
+
+	if (atomic_load_explicit(&registry->table, memory_order_acquire) != table) {
+		return TSK_TRUE;
+	}
+
+	while (atomic_flag_test_and_set_explicit(&registry->is_growing, memory_order_acquire)) {
+		(void)sched_yield();
+	}
+
+	TskBoolean is_grown = TSK_TRUE;
+	if (atomic_load_explicit(&registry->table, memory_order_acquire) == table) {
+		TskUSize              capacity  = table != TSK_NULL ? table->capacity * 2 : TSK_TYPE_REGISTRY_TABLE_INITIAL_CAPACITY;
+		TskTypeRegistryTable *new_table = calloc(1, sizeof(TskTypeRegistryTable) + (capacity * sizeof(_Atomic(TskU64))));
+		if (new_table != TSK_NULL) {
+			new_table->previous = table;
+			new_table->capacity = capacity;
+
+			TskUSize length     = 0;
+			for (TskUSize i = 0; table != TSK_NULL && i < table->capacity; i++) {
+				TskU64 slot = TSK_TYPE_REGISTRY_SLOT_EMPTY;
+				if (atomic_compare_exchange_strong_explicit(&table->slots[i], &slot, TSK_TYPE_REGISTRY_SLOT_FROZEN, memory_order_acq_rel, memory_order_acquire)) {
+					continue;
+				}
+
+				TskUSize position = tsk_type_registry_slot_position(slot, capacity);
+				while (atomic_load_explicit(&new_table->slots[position], memory_order_relaxed) != TSK_TYPE_REGISTRY_SLOT_EMPTY) {
+					position = (position + 1) & (capacity - 1);
+				}
+				atomic_store_explicit(&new_table->slots[position], slot, memory_order_relaxed);
+				length++;
+			}
+			atomic_store_explicit(&new_table->length, length, memory_order_relaxed);
+
+			atomic_store_explicit(&registry->table, new_table, memory_order_release);
+		} else {
+			is_grown = TSK_FALSE;
+		}
+	}
+
+	atomic_flag_clear_explicit(&registry->is_growing, memory_order_release);
+
+	return is_grown;
+}
+
+TskTypeRegistryResult tsk_type_registry_find_or_claim(TskTypeRegistry *registry, TskU64 hash, TskBoolean (*equals)(const TskAny *entry, const TskAny *key), const TskAny *key, TskAny **entry) {
+	assert(registry != TSK_NULL);
+	assert(registry->entry_size != 0);
+	assert(equals != TSK_NULL);
+	assert(entry != TSK_NULL);
+
+	TskBoolean is_reserved = TSK_FALSE;
+	TskUSize   index       = 0;
+	for (;;) {
+		TskTypeRegistryTable *table = atomic_load_explicit(&registry->table, memory_order_acquire);
+		if (table == TSK_NULL) {
+			if (!tsk_type_registry_grow(registry, table)) {
+				return TSK_TYPE_REGISTRY_RESULT_FULL;
+			}
+			continue;
+		}
+
+		TskUSize position = tsk_type_registry_slot_position(hash, table->capacity);
+		TskUSize probes   = 0;
+		for (;;) {
+			TskU64 slot = atomic_load_explicit(&table->slots[position], memory_order_acquire);
+			if (slot == TSK_TYPE_REGISTRY_SLOT_EMPTY) {
+				if (!is_reserved) {
+					index = atomic_fetch_add_explicit(&registry->length, 1, memory_order_relaxed);
+					if (index >= TSK_TYPE_REGISTRY_MAXIMUM_LENGTH || tsk_type_registry_segment_get(registry, tsk_type_registry_segment(index)) == TSK_NULL) {
+						return TSK_TYPE_REGISTRY_RESULT_FULL;
+					}
+					*tsk_type_registry_hash(registry, index) = hash;
+					is_reserved                              = TSK_TRUE;
+				}
+
+				if (atomic_compare_exchange_strong_explicit(&table->slots[position], &slot, tsk_type_registry_slot(hash, index), memory_order_acq_rel, memory_order_acquire)) {
+					*entry = tsk_type_registry_entry(registry, index);
+					if (atomic_fetch_add_explicit(&table->length, 1, memory_order_relaxed) + 1 > table->capacity / 2) {
+						(void)tsk_type_registry_grow(registry, table);
+					}
+					return TSK_TYPE_REGISTRY_RESULT_CLAIMED;
+				}
+			}
+
+			if (slot == TSK_TYPE_REGISTRY_SLOT_FROZEN) {
+				break;
+			}
+
+			if ((slot >> 32) == (hash >> 32) && *tsk_type_registry_hash(registry, tsk_type_registry_slot_index(slot)) == hash) {
+				TskUSize slot_index = tsk_type_registry_slot_index(slot);
+
+				TskU8 state         = atomic_load_explicit(tsk_type_registry_state(registry, slot_index), memory_order_acquire);
+				while (state == TSK_TYPE_REGISTRY_STATE_CLAIMED) {
+					(void)sched_yield();
+					state = atomic_load_explicit(tsk_type_registry_state(registry, slot_index), memory_order_acquire);
+				}
+
+				if (state == TSK_TYPE_REGISTRY_STATE_PUBLISHED && equals(tsk_type_registry_entry(registry, slot_index), key)) {
+					if (is_reserved) {
+						atomic_store_explicit(tsk_type_registry_state(registry, index), TSK_TYPE_REGISTRY_STATE_ABANDONED, memory_order_relaxed);
+					}
+					*entry = tsk_type_registry_entry(registry, slot_index);
+					return TSK_TYPE_REGISTRY_RESULT_FOUND;
+				}
+			}
+
+			position = (position + 1) & (table->capacity - 1);
+			probes++;
+			if (probes == table->capacity) {
+				break;
+			}
+		}
+
+		if (!tsk_type_registry_grow(registry, table)) {
+			return TSK_TYPE_REGISTRY_RESULT_FULL;
+		}
+	}
+}
+TskEmpty tsk_type_registry_publish(TskTypeRegistry *registry, TskAny *entry) {
+	assert(registry != TSK_NULL);
+
+	TskUSize index = 0;
+	if (!tsk_type_registry_entry_index(registry, entry, &index)) {
+		assert(TSK_FALSE);
+		return;
+	}
+
+	assert(atomic_load_explicit(tsk_type_registry_state(registry, index), memory_order_relaxed) == TSK_TYPE_REGISTRY_STATE_CLAIMED);
+
+	atomic_store_explicit(tsk_type_registry_state(registry, index), TSK_TYPE_REGISTRY_STATE_PUBLISHED, memory_order_release);
+}
+TskEmpty tsk_type_registry_abandon(TskTypeRegistry *registry, TskAny *entry) {
+	assert(registry != TSK_NULL);
+
+	TskUSize index = 0;
+	if (!tsk_type_registry_entry_index(registry, entry, &index)) {
+		assert(TSK_FALSE);
+		return;
+	}
+
+	assert(atomic_load_explicit(tsk_type_registry_state(registry, index), memory_order_relaxed) == TSK_TYPE_REGISTRY_STATE_CLAIMED);
+
+	atomic_store_explicit(tsk_type_registry_state(registry, index), TSK_TYPE_REGISTRY_STATE_ABANDONED, memory_order_release);
+}
+TskBoolean tsk_type_registry_contains(const TskTypeRegistry *registry, const TskAny *entry) {
+	assert(registry != TSK_NULL);
+
+	TskUSize index = 0;
+	if (!tsk_type_registry_entry_index(registry, entry, &index)) {
+		return TSK_FALSE;
+	}
+
+	return atomic_load_explicit(tsk_type_registry_state_const(registry, index), memory_order_acquire) == TSK_TYPE_REGISTRY_STATE_PUBLISHED;
+}
@@ -0,0 +1,234 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <tsk/array.h>
+#include <tsk/default_hasher.h>
+#include <tsk/sip_hasher.h>
+#include <tsk/trait/builder.h>
+#include <tsk/trait/complete.h>
+#include <tsk/trait/droppable.h>
+#include <tsk/trait/hashable.h>
+#include <tsk/trait/hasher.h>
+#include <tsk/type.h>
+#include <tsk/typed_array.h>
+
+#include <math.h>
+
+#define TEST_LONG_LENGTH 1000
+
+TSK_ARRAY_DEFINE(f64, TskF64)
+
+static TskU64 test_array_view_const_hash(const TskType *builder_type, const TskAny *builder, const TskType *array_view_type, TskArrayViewConst array_view) {
+	const TskType             *hasher_type = tsk_trait_builder_built_type(builder_type);
+	alignas(max_align_t) TskU8 hasher[tsk_trait_complete_size(hasher_type)];
+	tsk_trait_builder_build(builder_type, builder, hasher);
+
+	tsk_trait_hashable_hash(array_view_type, &array_view, hasher_type, hasher);
+	TskU64 hash = tsk_trait_hasher_finalize(hasher_type, hasher);
+
+	tsk_trait_droppable_drop(hasher_type, hasher);
+
+	return hash;
+}
+
+static void test_array_view_const_hash_ignores_stride(void **state) {
+	(void)state;
+
+	const TskType *array_view_type = tsk_array_view_const_type(tsk_u32_type);
+	assert_non_null(array_view_type);
+
+	TskU32            contiguous_elements[] = { 1, 2, 3 };
+	TskU32            reversed_elements[]   = { 3, 2, 1 };
+	TskU32            strided_elements[]    = { 1, 9, 2, 9, 3 };
+
+	TskArrayViewConst array_views[]         = {
+		tsk_array_view_const_new(array_view_type, contiguous_elements, 3, 1),
+		tsk_array_view_const_new(array_view_type, &reversed_elements[2], 3, -1),
+		tsk_array_view_const_new(array_view_type, strided_elements, 3, 2),
+	};
+
+	static TskU64 long_contiguous_elements[TEST_LONG_LENGTH];
+	static TskU64 long_strided_elements[TEST_LONG_LENGTH * 3];
+	for (TskUSize i = 0; i < TEST_LONG_LENGTH; i++) {
+		long_contiguous_elements[i]  = (i * 0x9E3779B97F4A7C15ULL) ^ (i >> 3);
+		long_strided_elements[i * 3] = long_contiguous_elements[i];
+	}
+
+	const TskType    *long_array_view_type = tsk_array_view_const_type(tsk_u64_type);
+	assert_non_null(long_array_view_type);
+
+	TskArrayViewConst long_array_views[] = {
+		tsk_array_view_const_new(long_array_view_type, long_contiguous_elements, TEST_LONG_LENGTH, 1),
+		tsk_array_view_const_new(long_array_view_type, long_strided_elements, TEST_LONG_LENGTH, 3),
+	};
+
+	TskSipHasherBuilder sip_hasher_builder = tsk_sip_hasher_builder_new(1, 2);
+
+	const TskType      *builder_types[]    = { tsk_default_hasher_builder_type, tsk_sip_hasher_builder_type };
+	const TskAny       *builders[]         = { tsk_default_hasher_builder, &sip_hasher_builder };
+	for (TskUSize i = 0; i < sizeof(builder_types) / sizeof(builder_types[0]); i++) {
+		for (TskUSize j = 1; j < sizeof(array_views) / sizeof(array_views[0]); j++) {
+			assert_true(tsk_array_view_const_equals(array_view_type, array_views[0], array_views[j]));
+			assert_int_equal(
+			    test_array_view_const_hash(builder_types[i], builders[i], array_view_type, array_views[0]),
+			    test_array_view_const_hash(builder_types[i], builders[i], array_view_type, array_views[j])
+			);
+		}
+
+		assert_true(tsk_array_view_const_equals(long_array_view_type, long_array_views[0], long_array_views[1]));
+		assert_int_equal(
+		    test_array_view_const_hash(builder_types[i], builders[i], long_array_view_type, long_array_views[0]),
+		    test_array_view_const_hash(builder_types[i], builders[i], long_array_view_type, long_array_views[1])
+		);
+	}
+}
+
+static void test_array_view_typed_linear_search_matches_erased(void **state) {
+	(void)state;
+
+	TskF64       elements[] = { NAN, 1.0, 5.0 };
+	TskArrayView array_view = tsk_array_view_f64_new(elements, 3);
+
+	TskUSize     index      = 0;
+	assert_true(tsk_array_view_f64_linear_search(array_view, 5.0, &index));
+	assert_int_equal(index, 2);
+
+	TskUSize erased_index = 0;
+	assert_true(tsk_array_view_const_linear_search(
+	    tsk_array_view_const_type(tsk_f64_type),
+	    tsk_array_view_const_new(tsk_array_view_const_type(tsk_f64_type), elements, 3, 1),
+	    &(TskF64){ 5.0 },
+	    &erased_index
+	));
+	assert_int_equal(index, erased_index);
+
+	assert_false(tsk_array_view_f64_linear_search(array_view, 2.0, TSK_NULL));
+}
+
+static void test_array_view_typed_sort_ignores_stride(void **state) {
+	(void)state;
+
+	static TskF64 contiguous_elements[TEST_LONG_LENGTH];
+	static TskF64 reversed_elements[TEST_LONG_LENGTH];
+	static TskF64 strided_elements[TEST_LONG_LENGTH * 3];
+	for (TskUSize k = 0; k < 2; k++) {
+		for (TskUSize i = 0; i < TEST_LONG_LENGTH; i++) {
+			TskF64 element = (TskF64)((i * 7919) % 101) - 50.0;
+			if (k == 1 && i % 97 == 0) {
+				element = NAN;
+			} else if (i % 89 == 0) {
+				element = -0.0;
+			}
+			contiguous_elements[i]                      = element;
+			reversed_elements[TEST_LONG_LENGTH - 1 - i] = element;
+			strided_elements[i * 3]                     = element;
+		}
+
+		TskArrayView array_views[] = {
+			tsk_array_view_f64_new(contiguous_elements, TEST_LONG_LENGTH),
+			{ .elements = &reversed_elements[TEST_LONG_LENGTH - 1], .length = TEST_LONG_LENGTH, .stride = -1 },
+			{ .elements = strided_elements, .length = TEST_LONG_LENGTH, .stride = 3 },
+		};
+		for (TskUSize i = 0; i < sizeof(array_views) / sizeof(array_views[0]); i++) {
+			tsk_array_view_f64_sort(array_views[i]);
+		}
+
+		for (TskUSize i = 0; i < TEST_LONG_LENGTH; i++) {
+			for (TskUSize j = 1; j < sizeof(array_views) / sizeof(array_views[0]); j++) {
+				assert_memory_equal(tsk_array_view_f64_get(array_views[0], i), tsk_array_view_f64_get(array_views[j], i), sizeof(TskF64));
+			}
+			if (k == 0) {
+				assert_true(i == 0 || !(*tsk_array_view_f64_get(array_views[0], i) < *tsk_array_view_f64_get(array_views[0], i - 1)));
+				for (TskUSize j = 0; j < sizeof(array_views) / sizeof(array_views[0]); j++) {
+					TskUSize index = 0;
+					assert_true(tsk_array_view_f64_binary_search(array_views[j], *tsk_array_view_f64_get(array_views[0], i), &index));
+					assert_true(index <= i);
+				}
+			}
+		}
+	}
+}
+
+static void test_array_burst_and_drain(void **state) {
+	(void)state;
+
+	const TskType *array_type = tsk_array_type(tsk_u64_type);
+	assert_non_null(array_type);
+
+	TskArray array = tsk_array_new(array_type);
+	tsk_array_set_automatic_shrink(array_type, &array, TSK_TRUE);
+
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH; i++) {
+		assert_true(tsk_array_push_back(array_type, &array, &i));
+	}
+	assert_int_equal(tsk_array_length(array_type, &array), TEST_LONG_LENGTH);
+	TskUSize burst_capacity = tsk_array_capacity(array_type, &array);
+	assert_true(burst_capacity >= TEST_LONG_LENGTH);
+
+	TskArray clone;
+	assert_true(tsk_array_clone(array_type, &array, &clone));
+	assert_true(tsk_array_capacity(array_type, &clone) >= tsk_array_length(array_type, &clone));
+	assert_true(tsk_array_equals(array_type, &array, &clone));
+	tsk_array_drop(array_type, &clone);
+
+	for (TskU64 i = TEST_LONG_LENGTH; i > TEST_LONG_LENGTH / 100; i--) {
+		TskU64 element = 0;
+		assert_true(tsk_array_pop_back(array_type, &array, &element));
+		assert_int_equal(element, i - 1);
+		assert_true(tsk_array_length(array_type, &array) >= tsk_array_capacity(array_type, &array) / 4);
+	}
+	assert_int_equal(tsk_array_length(array_type, &array), TEST_LONG_LENGTH / 100);
+	assert_true(tsk_array_capacity(array_type, &array) < burst_capacity);
+
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH / 100; i++) {
+		TskU64 element = 0;
+		assert_true(tsk_array_pop_front(array_type, &array, &element));
+		assert_int_equal(element, i);
+	}
+	assert_true(tsk_array_is_empty(array_type, &array));
+	assert_false(tsk_array_pop_back(array_type, &array, TSK_NULL));
+
+	tsk_array_drop(array_type, &array);
+}
+
+static void test_array_shrink_to_below_length(void **state) {
+	(void)state;
+
+	const TskType *array_type = tsk_array_type(tsk_u64_type);
+	assert_non_null(array_type);
+
+	TskArray array = tsk_array_new(array_type);
+	assert_true(tsk_array_reserve(array_type, &array, TEST_LONG_LENGTH));
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH / 10; i++) {
+		assert_true(tsk_array_push_back(array_type, &array, &i));
+	}
+
+	assert_true(tsk_array_shrink_to(array_type, &array, TEST_LONG_LENGTH / 100));
+	assert_int_equal(tsk_array_capacity(array_type, &array), TEST_LONG_LENGTH / 10);
+	assert_int_equal(tsk_array_length(array_type, &array), TEST_LONG_LENGTH / 10);
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH / 10; i++) {
+		assert_int_equal(*(const TskU64 *)tsk_array_get_const(array_type, &array, i), i);
+	}
+
+	tsk_array_clear(array_type, &array);
+	assert_true(tsk_array_shrink_to_fit(array_type, &array));
+	assert_int_equal(tsk_array_capacity(array_type, &array), 0);
+
+	tsk_array_drop(array_type, &array);
+}
+
+int main(void) {
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_array_view_const_hash_ignores_stride),
+		cmocka_unit_test(test_array_view_typed_linear_search_matches_erased),
+		cmocka_unit_test(test_array_view_typed_sort_ignores_stride),
+		cmocka_unit_test(test_array_burst_and_drain),
+		cmocka_unit_test(test_array_shrink_to_below_length),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
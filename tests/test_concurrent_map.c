@@ -0,0 +1,97 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <tsk/concurrent_map.h>
+#include <tsk/type.h>
+
+#include <pthread.h>
+
+#define TEST_THREADS       4
+#define TEST_KEYS_LENGTH   2000
+#define TEST_SHARDS_LENGTH (TEST_THREADS * 2)
+
+typedef struct TestThread TestThread;
+struct TestThread {
+	const TskType    *concurrent_map_type;
+	TskConcurrentMap *concurrent_map;
+	TskUSize          offset;
+};
+
+static TskU64 test_key(TskUSize index) {
+	return (TskU64)index << 32 | index;
+}
+
+static void *test_thread_run(void *argument) {
+	TestThread *thread = argument;
+
+	for (TskUSize i = thread->offset; i < TEST_KEYS_LENGTH; i += TEST_THREADS) {
+		TskU64 key   = test_key(i);
+		TskU64 value = i * 3;
+		if (!tsk_concurrent_map_insert(thread->concurrent_map_type, thread->concurrent_map, &key, &value)) {
+			return argument;
+		}
+	}
+	for (TskUSize i = thread->offset; i < TEST_KEYS_LENGTH; i += TEST_THREADS * 2) {
+		TskU64 key     = test_key(i);
+		TskU64 removed = 0;
+		if (!tsk_concurrent_map_remove(thread->concurrent_map_type, thread->concurrent_map, &key, &removed) || removed != i * 3) {
+			return argument;
+		}
+	}
+
+	return TSK_NULL;
+}
+
+static void test_concurrent_map_matches_model(void **state) {
+	(void)state;
+
+	const TskType *concurrent_map_type = tsk_concurrent_map_type(tsk_u64_type, tsk_u64_type);
+	assert_non_null(concurrent_map_type);
+
+	TskConcurrentMap concurrent_map;
+	assert_true(tsk_concurrent_map_new(concurrent_map_type, &concurrent_map, TEST_SHARDS_LENGTH));
+
+	TestThread threads[TEST_THREADS];
+	pthread_t  thread_ids[TEST_THREADS];
+	for (TskUSize i = 0; i < TEST_THREADS; i++) {
+		threads[i] = (TestThread){
+			.concurrent_map_type = concurrent_map_type,
+			.concurrent_map      = &concurrent_map,
+			.offset              = i,
+		};
+		assert_int_equal(pthread_create(&thread_ids[i], TSK_NULL, test_thread_run, &threads[i]), 0);
+	}
+	for (TskUSize i = 0; i < TEST_THREADS; i++) {
+		void *result = TSK_NULL;
+		assert_int_equal(pthread_join(thread_ids[i], &result), 0);
+		assert_null(result);
+	}
+
+	TskUSize length = 0;
+	for (TskUSize i = 0; i < TEST_KEYS_LENGTH; i++) {
+		TskBoolean present = i % (TEST_THREADS * 2) >= TEST_THREADS;
+		length += present;
+
+		TskU64 key   = test_key(i);
+		TskU64 value = 0;
+		assert_int_equal(tsk_concurrent_map_get(concurrent_map_type, &concurrent_map, &key, &value), present);
+		if (present) {
+			assert_int_equal(value, i * 3);
+		}
+	}
+	assert_int_equal(tsk_concurrent_map_length(concurrent_map_type, &concurrent_map), length);
+
+	tsk_concurrent_map_drop(concurrent_map_type, &concurrent_map);
+}
+
+int main(void) {
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_concurrent_map_matches_model),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,142 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <tsk/deque.h>
+#include <tsk/type.h>
+
+#define TEST_LONG_LENGTH  1000
+#define TEST_SEGMENT_SIZE 16
+
+static void test_deque_burst_and_drain(void **state) {
+	(void)state;
+
+	const TskType *deque_type = tsk_deque_type(tsk_u64_type);
+	assert_non_null(deque_type);
+
+	TskDeque deque = tsk_deque_new(deque_type);
+	tsk_deque_set_automatic_shrink(deque_type, &deque, TSK_TRUE);
+
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH; i++) {
+		assert_true(tsk_deque_push_back(deque_type, &deque, &i));
+	}
+	assert_int_equal(tsk_deque_length(deque_type, &deque), TEST_LONG_LENGTH);
+	TskUSize burst_capacity = tsk_deque_capacity(deque_type, &deque);
+	assert_true(burst_capacity >= TEST_LONG_LENGTH);
+
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH - TEST_LONG_LENGTH / 100; i++) {
+		TskU64 element = 0;
+		assert_true(tsk_deque_pop_front(deque_type, &deque, &element));
+		assert_int_equal(element, i);
+	}
+	assert_int_equal(tsk_deque_length(deque_type, &deque), TEST_LONG_LENGTH / 100);
+	assert_true(tsk_deque_capacity(deque_type, &deque) < burst_capacity);
+
+	for (TskU64 i = TEST_LONG_LENGTH; i > TEST_LONG_LENGTH - TEST_LONG_LENGTH / 100; i--) {
+		TskU64 element = 0;
+		assert_true(tsk_deque_pop_back(deque_type, &deque, &element));
+		assert_int_equal(element, i - 1);
+	}
+	assert_true(tsk_deque_is_empty(deque_type, &deque));
+	assert_false(tsk_deque_pop_front(deque_type, &deque, TSK_NULL));
+	assert_false(tsk_deque_pop_back(deque_type, &deque, TSK_NULL));
+
+	TskU64 element = TEST_LONG_LENGTH;
+	assert_true(tsk_deque_push_back(deque_type, &deque, &element));
+	assert_int_equal(*(const TskU64 *)tsk_deque_front_const(deque_type, &deque), TEST_LONG_LENGTH);
+
+	tsk_deque_drop(deque_type, &deque);
+}
+
+static void test_deque_shrink_to_below_length(void **state) {
+	(void)state;
+
+	const TskType *deque_type = tsk_deque_type(tsk_u64_type);
+	assert_non_null(deque_type);
+
+	TskDeque deque = tsk_deque_new(deque_type);
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH; i++) {
+		assert_true(tsk_deque_push_back(deque_type, &deque, &i));
+	}
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH / 2; i++) {
+		assert_true(tsk_deque_pop_front(deque_type, &deque, TSK_NULL));
+	}
+
+	assert_true(tsk_deque_shrink_to(deque_type, &deque, TEST_LONG_LENGTH / 100));
+	assert_int_equal(tsk_deque_length(deque_type, &deque), TEST_LONG_LENGTH / 2);
+	assert_true(tsk_deque_capacity(deque_type, &deque) >= TEST_LONG_LENGTH / 2);
+	assert_true(tsk_deque_capacity(deque_type, &deque) < TEST_LONG_LENGTH / 2 + 2 * TEST_SEGMENT_SIZE);
+	for (TskU64 i = 0; i < TEST_LONG_LENGTH / 2; i++) {
+		assert_int_equal(*(const TskU64 *)tsk_deque_get_const(deque_type, &deque, i), TEST_LONG_LENGTH / 2 + i);
+	}
+
+	TskU64 element = TEST_LONG_LENGTH;
+	assert_true(tsk_deque_push_back(deque_type, &deque, &element));
+	element = 0;
+	assert_true(tsk_deque_push_front(deque_type, &deque, &element));
+	assert_int_equal(*(const TskU64 *)tsk_deque_front_const(deque_type, &deque), 0);
+	assert_int_equal(*(const TskU64 *)tsk_deque_back_const(deque_type, &deque), TEST_LONG_LENGTH);
+
+	tsk_deque_clear(deque_type, &deque);
+	assert_true(tsk_deque_shrink_to_fit(deque_type, &deque));
+	assert_int_equal(tsk_deque_capacity(deque_type, &deque), 0);
+
+	tsk_deque_drop(deque_type, &deque);
+}
+
+static void test_deque_pop_through_segment_boundary(void **state) {
+	(void)state;
+
+	const TskType *deque_type = tsk_deque_type(tsk_u64_type);
+	assert_non_null(deque_type);
+
+	for (TskUSize length = 1; length <= 3 * TEST_SEGMENT_SIZE + 1; length++) {
+		for (TskUSize front_length = 0; front_length <= length; front_length++) {
+			TskDeque deque = tsk_deque_new(deque_type);
+			tsk_deque_set_automatic_shrink(deque_type, &deque, front_length % 2 == 0);
+
+			for (TskU64 i = front_length; i < length; i++) {
+				assert_true(tsk_deque_push_back(deque_type, &deque, &i));
+			}
+			for (TskU64 i = front_length; i > 0; i--) {
+				TskU64 element = i - 1;
+				assert_true(tsk_deque_push_front(deque_type, &deque, &element));
+			}
+			assert_int_equal(tsk_deque_length(deque_type, &deque), length);
+
+			TskU64 front = 0;
+			TskU64 back  = length;
+			while (front < back) {
+				TskU64 element = 0;
+				if ((front + back) % 3 == 0) {
+					assert_true(tsk_deque_pop_back(deque_type, &deque, &element));
+					assert_int_equal(element, --back);
+				} else {
+					assert_true(tsk_deque_pop_front(deque_type, &deque, &element));
+					assert_int_equal(element, front++);
+				}
+				assert_int_equal(tsk_deque_length(deque_type, &deque), back - front);
+				if (front < back) {
+					assert_int_equal(*(const TskU64 *)tsk_deque_front_const(deque_type, &deque), front);
+					assert_int_equal(*(const TskU64 *)tsk_deque_back_const(deque_type, &deque), back - 1);
+				}
+			}
+			assert_true(tsk_deque_is_empty(deque_type, &deque));
+
+			tsk_deque_drop(deque_type, &deque);
+		}
+	}
+}
+
+int main(void) {
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_deque_burst_and_drain),
+		cmocka_unit_test(test_deque_shrink_to_below_length),
+		cmocka_unit_test(test_deque_pop_through_segment_boundary),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
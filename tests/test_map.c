@@ -0,0 +1,727 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <tsk/array.h>
+#include <tsk/map.h>
+#include <tsk/reference.h>
+#include <tsk/trait/clonable.h>
+#include <tsk/trait/complete.h>
+#include <tsk/trait/droppable.h>
+#include <tsk/trait/equatable.h>
+#include <tsk/trait/hashable.h>
+#include <tsk/trait/hasher.h>
+#include <tsk/trait/iterator.h>
+#include <tsk/tuple.h>
+#include <tsk/type.h>
+#include <tsk/typed_map.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_TYPED_LENGTH          1000
+#define TEST_MODEL_KEYS_LENGTH     512
+#define TEST_MODEL_OPERATIONS      20000
+#define TEST_MODEL_CHECK_INTERVAL  997
+#define TEST_PARALLEL_ITEMS_LENGTH 20000
+#define TEST_PARALLEL_THREADS      4
+#define TEST_LARGE_CAPACITY        ((TskUSize)1 << 25)
+#define TEST_GET_MANY_BATCH_LENGTH 16
+#define TEST_GET_MANY_KEYS_LENGTH  (TEST_GET_MANY_BATCH_LENGTH * 3 + 1)
+#define TEST_GET_MANY_INSERTS      300
+#define TEST_EXTEND_ITEMS_LENGTH   2000
+#define TEST_STRING_KEYS_LENGTH    200
+
+typedef TskU32 TestParity;
+
+static TskBoolean test_parity_type_trait_equatable_equals(const TskType *equatable_type, const TskAny *equatable_1, const TskAny *equatable_2) {
+	(void)equatable_type;
+	return ((*(const TestParity *)equatable_1 ^ *(const TestParity *)equatable_2) & 1) == 0;
+}
+static TskEmpty test_parity_type_trait_hashable_hash(const TskType *hashable_type, const TskAny *hashable, const TskType *hasher_type, TskAny *hasher) {
+	(void)hashable_type;
+	TskU8 parity = (TskU8)(*(const TestParity *)hashable & 1);
+	tsk_trait_hasher_combine(hasher_type, hasher, &parity, sizeof(parity));
+}
+
+// clang-format off
+TSK_TYPE(tsk_test_parity_type, TestParity,
+	TSK_TYPE_TRAIT(tsk_test_parity_type, TSK_TRAIT_ID_COMPLETE, &(TskTraitComplete){
+		.size      = sizeof(TestParity),
+		.alignment = alignof(TestParity),
+	}),
+	TSK_TYPE_TRAIT(tsk_test_parity_type, TSK_TRAIT_ID_DROPPABLE, &(TskTraitDroppable){
+		.drop = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_test_parity_type, TSK_TRAIT_ID_CLONABLE, &(TskTraitClonable){
+		.clone = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_test_parity_type, TSK_TRAIT_ID_EQUATABLE, &(TskTraitEquatable){
+		.equals = test_parity_type_trait_equatable_equals,
+	}),
+	TSK_TYPE_TRAIT(tsk_test_parity_type, TSK_TRAIT_ID_HASHABLE, &(TskTraitHashable){
+		.hash = test_parity_type_trait_hashable_hash,
+	}),
+);
+// clang-format on
+
+typedef struct TestItemsIterator TestItemsIterator;
+struct TestItemsIterator {
+	TskU64   (*items)[2];
+	TskUSize length;
+};
+
+static const TskType *test_items_iterator_type_trait_iterator_item_type(const TskType *iterator_type) {
+	(void)iterator_type;
+	return tsk_tuple_type((const TskType *[]){ tsk_u64_type, tsk_u64_type }, 2);
+}
+static TskBoolean test_items_iterator_type_trait_iterator_next(const TskType *iterator_type, TskAny *iterator, TskAny *item) {
+	TestItemsIterator *items_iterator = iterator;
+	if (items_iterator->length == 0) {
+		return TSK_FALSE;
+	}
+
+	const TskType *item_type                     = tsk_trait_iterator_item_type(iterator_type);
+	*(TskU64 *)tsk_tuple_get(item_type, item, 0) = items_iterator->items[0][0];
+	*(TskU64 *)tsk_tuple_get(item_type, item, 1) = items_iterator->items[0][1];
+	items_iterator->items++;
+	items_iterator->length--;
+
+	return TSK_TRUE;
+}
+
+// clang-format off
+TSK_TYPE(tsk_test_items_iterator_type, TestItemsIterator,
+	TSK_TYPE_TRAIT(tsk_test_items_iterator_type, TSK_TRAIT_ID_COMPLETE, &(TskTraitComplete){
+		.size      = sizeof(TestItemsIterator),
+		.alignment = alignof(TestItemsIterator),
+	}),
+	TSK_TYPE_TRAIT(tsk_test_items_iterator_type, TSK_TRAIT_ID_DROPPABLE, &(TskTraitDroppable){
+		.drop = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_test_items_iterator_type, TSK_TRAIT_ID_CLONABLE, &(TskTraitClonable){
+		.clone = TSK_NULL,
+	}),
+	TSK_TYPE_TRAIT(tsk_test_items_iterator_type, TSK_TRAIT_ID_ITERATOR, &(TskTraitIterator){
+		.item_type = test_items_iterator_type_trait_iterator_item_type,
+		.next      = test_items_iterator_type_trait_iterator_next,
+	}),
+);
+// clang-format on
+
+TSK_MAP_DEFINE(u64, TskU64, u64, TskU64)
+TSK_MAP_DEFINE(test_parity, TestParity, u64, TskU64)
+
+static void test_map_typed_length_during_incremental_resize(void **state) {
+	(void)state;
+
+	TskMap map = tsk_map_u64_u64_new();
+	tsk_map_set_incremental_resize(tsk_map_u64_u64_type(), &map, TSK_TRUE);
+
+	for (TskU64 i = 0; i < TEST_TYPED_LENGTH; i++) {
+		assert_true(tsk_map_u64_u64_insert(&map, i, i * 2));
+		assert_int_equal(tsk_map_u64_u64_length(&map), i + 1);
+		assert_int_equal(tsk_map_u64_u64_length(&map), tsk_map_length(tsk_map_u64_u64_type(), &map));
+	}
+	for (TskU64 i = 0; i < TEST_TYPED_LENGTH; i++) {
+		const TskU64 *value = tsk_map_u64_u64_get_const(&map, i);
+		assert_non_null(value);
+		assert_int_equal(*value, i * 2);
+	}
+
+	tsk_map_u64_u64_drop(&map);
+}
+
+static void test_map_typed_custom_key_matches_erased(void **state) {
+	(void)state;
+
+	assert_false(tsk_type_layout(tsk_test_parity_type)->is_bitwise_equatable);
+	assert_false(tsk_type_layout(tsk_test_parity_type)->is_bytewise_hashable);
+
+	TskMap map = tsk_map_test_parity_u64_new();
+	assert_true(tsk_map_test_parity_u64_insert(&map, 2, 20));
+	assert_true(tsk_map_test_parity_u64_insert(&map, 3, 30));
+	assert_true(tsk_map_test_parity_u64_insert(&map, 4, 40));
+	assert_int_equal(tsk_map_test_parity_u64_length(&map), 2);
+
+	const TskU64 *value = tsk_map_test_parity_u64_get_const(&map, 6);
+	assert_non_null(value);
+	assert_int_equal(*value, 40);
+
+	TestParity key = 5;
+	assert_ptr_equal(tsk_map_get_const(tsk_map_test_parity_u64_type(), &map, &key), tsk_map_test_parity_u64_get_const(&map, 1));
+	assert_int_equal(*(const TskU64 *)tsk_map_get_const(tsk_map_test_parity_u64_type(), &map, &key), 30);
+
+	tsk_map_test_parity_u64_drop(&map);
+}
+
+static void test_map_type_name_includes_engine_and_layout(void **state) {
+	(void)state;
+
+	TskMapEngine        engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD, TSK_MAP_ENGINE_ROBIN_HOOD };
+	TskMapLayout        layouts[] = { TSK_MAP_LAYOUT_SPLIT, TSK_MAP_LAYOUT_INTERLEAVED, TSK_MAP_LAYOUT_SPLIT, TSK_MAP_LAYOUT_INTERLEAVED };
+	const TskCharacter *names[]   = {
+		"TskMap<TskU64, TskU64>",
+		"TskInterleavedMap<TskU64, TskU64>",
+		"TskRobinHoodMap<TskU64, TskU64>",
+		"TskInterleavedRobinHoodMap<TskU64, TskU64>",
+	};
+	const TskCharacter *iterator_names[] = {
+		"TskMapIterator<TskU64, TskU64>",
+		"TskInterleavedMapIterator<TskU64, TskU64>",
+		"TskRobinHoodMapIterator<TskU64, TskU64>",
+		"TskInterleavedRobinHoodMapIterator<TskU64, TskU64>",
+	};
+	const TskCharacter *iterator_const_names[] = {
+		"TskMapIteratorConst<TskU64, TskU64>",
+		"TskInterleavedMapIteratorConst<TskU64, TskU64>",
+		"TskRobinHoodMapIteratorConst<TskU64, TskU64>",
+		"TskInterleavedRobinHoodMapIteratorConst<TskU64, TskU64>",
+	};
+	for (TskUSize i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		const TskType *map_type = tsk_map_type_with_layout(tsk_u64_type, tsk_u64_type, engines[i], layouts[i]);
+		assert_non_null(map_type);
+		assert_int_equal(strcmp(tsk_type_name(map_type), names[i]), 0);
+		assert_int_equal(strcmp(tsk_type_name(tsk_map_iterator_type_with_map_type(map_type)), iterator_names[i]), 0);
+		assert_int_equal(strcmp(tsk_type_name(tsk_map_iterator_const_type_with_map_type(map_type)), iterator_const_names[i]), 0);
+	}
+}
+
+static void test_map_reserve_above_float_precision(void **state) {
+	(void)state;
+
+	const TskType *map_type = tsk_map_type(tsk_u8_type, tsk_u8_type);
+	assert_non_null(map_type);
+
+	TskMap map = tsk_map_new(map_type);
+	assert_true(tsk_map_reserve_additional(map_type, &map, TEST_LARGE_CAPACITY / 2 / 8 * 7 + 1));
+	assert_int_equal(tsk_map_capacity(map_type, &map), TEST_LARGE_CAPACITY);
+	tsk_map_drop(map_type, &map);
+
+	map = tsk_map_new(map_type);
+	assert_true(tsk_map_set_maximum_load_factor(map_type, &map, 1.0F));
+	assert_true(tsk_map_maximum_load_factor(map_type, &map) >= 1.0F);
+	assert_true(tsk_map_reserve_additional(map_type, &map, TEST_LARGE_CAPACITY / 2 + 1));
+	assert_int_equal(tsk_map_capacity(map_type, &map), TEST_LARGE_CAPACITY);
+	assert_true(tsk_map_reserve_additional(map_type, &map, TEST_LARGE_CAPACITY));
+	assert_int_equal(tsk_map_capacity(map_type, &map), TEST_LARGE_CAPACITY);
+	tsk_map_drop(map_type, &map);
+}
+
+typedef struct TestModel TestModel;
+struct TestModel {
+	TskBoolean present[TEST_MODEL_KEYS_LENGTH];
+	TskU64     values[TEST_MODEL_KEYS_LENGTH];
+	TskUSize   length;
+};
+
+static TskU64 test_random(TskU64 *state) {
+	TskU64 random = (*state += 0x9E3779B97F4A7C15ULL);
+	random        = (random ^ (random >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	random        = (random ^ (random >> 27)) * 0x94D049BB133111EBULL;
+	return random ^ (random >> 31);
+}
+
+static TskU64 test_model_key(TskUSize index) {
+	return (TskU64)index << 32 | (TskU64)index;
+}
+
+static TskEmpty test_model_set(TestModel *model, TskUSize index, TskU64 value) {
+	if (!model->present[index]) {
+		model->present[index] = TSK_TRUE;
+		model->length++;
+	}
+	model->values[index] = value;
+}
+
+static TskEmpty test_model_check(const TskType *map_type, const TskMap *map, const TestModel *model) {
+	assert_int_equal(tsk_map_length(map_type, map), model->length);
+
+	for (TskUSize i = 0; i < TEST_MODEL_KEYS_LENGTH; i++) {
+		TskU64        key   = test_model_key(i);
+		const TskU64 *value = tsk_map_get_const(map_type, map, &key);
+		if (model->present[i]) {
+			assert_non_null(value);
+			assert_int_equal(*value, model->values[i]);
+		} else {
+			assert_null(value);
+		}
+	}
+
+	TskBoolean    seen[TEST_MODEL_KEYS_LENGTH] = { TSK_FALSE };
+	TskUSize      length                       = 0;
+	TskUSize      index                        = 0;
+	const TskAny *key                          = TSK_NULL;
+	while (tsk_map_next_key(map_type, map, &index, &key)) {
+		TskUSize key_index = (TskUSize)(*(const TskU64 *)key & 0xFFFFFFFF);
+		assert_true(key_index < TEST_MODEL_KEYS_LENGTH);
+		assert_int_equal(*(const TskU64 *)key, test_model_key(key_index));
+		assert_true(model->present[key_index]);
+		assert_false(seen[key_index]);
+		seen[key_index] = TSK_TRUE;
+		length++;
+	}
+	assert_int_equal(length, model->length);
+}
+
+static TskEmpty test_model_run(const TskType *map_type, TskBoolean incremental_resize, TskBoolean automatic_shrink, TskU64 seed) {
+	TskMap map = tsk_map_new(map_type);
+	tsk_map_set_incremental_resize(map_type, &map, incremental_resize);
+	tsk_map_set_automatic_shrink(map_type, &map, automatic_shrink);
+
+	static TestModel model;
+	model                   = (TestModel){ .length = 0 };
+
+	TskBoolean resizing     = TSK_FALSE;
+	TskU64     random_state = seed;
+	for (TskUSize operation = 0; operation < TEST_MODEL_OPERATIONS; operation++) {
+		TskU64   random = test_random(&random_state);
+		TskUSize index  = (TskUSize)(random >> 16) % (operation % 4096 < 2048 ? TEST_MODEL_KEYS_LENGTH : TEST_MODEL_KEYS_LENGTH / 8);
+		TskU64   key    = test_model_key(index);
+		TskU64   value  = random >> 8;
+
+		switch (random % 8) {
+			case 0:
+			case 1: {
+				assert_true(tsk_map_insert(map_type, &map, &key, &value));
+				test_model_set(&model, index, value);
+			} break;
+			case 2:
+			case 3: {
+				TskU64 removed = 0;
+				assert_int_equal(tsk_map_remove(map_type, &map, &key, &removed), model.present[index]);
+				if (model.present[index]) {
+					assert_int_equal(removed, model.values[index]);
+					model.present[index] = TSK_FALSE;
+					model.length--;
+				}
+			} break;
+			case 4: {
+				TskMapEntry entry;
+				assert_true(tsk_map_entry(map_type, &map, &key, &entry));
+				assert_int_equal(tsk_map_entry_is_occupied(map_type, &entry), model.present[index]);
+				if (tsk_map_entry_is_occupied(map_type, &entry)) {
+					assert_int_equal(*(const TskU64 *)tsk_map_entry_key(map_type, &entry), key);
+					(*(TskU64 *)tsk_map_entry_value(map_type, &entry))++;
+					model.values[index]++;
+				} else {
+					assert_non_null(tsk_map_entry_insert(map_type, &entry, &key, &value));
+					test_model_set(&model, index, value);
+				}
+			} break;
+			case 5: {
+				TskU64 *inserted = tsk_map_get_or_insert(map_type, &map, &key, &value);
+				assert_non_null(inserted);
+				if (!model.present[index]) {
+					test_model_set(&model, index, value);
+				}
+				assert_int_equal(*inserted, model.values[index]);
+			} break;
+			case 6: {
+				const TskU64 *found = tsk_map_get_const(map_type, &map, &key);
+				assert_int_equal(found != TSK_NULL, model.present[index]);
+				if (found != TSK_NULL) {
+					assert_int_equal(*found, model.values[index]);
+				}
+			} break;
+			case 7: {
+				switch ((random >> 3) % 64) {
+					case 0: {
+						assert_true(tsk_map_shrink_to_fit(map_type, &map));
+					} break;
+					case 1: {
+						assert_true(tsk_map_reserve_additional(map_type, &map, TEST_MODEL_KEYS_LENGTH / 4));
+					} break;
+					case 2: {
+						TskMap clone;
+						assert_true(tsk_map_clone(map_type, &map, &clone));
+						assert_true(tsk_map_equals(map_type, &map, &clone));
+						test_model_check(map_type, &clone, &model);
+						tsk_map_drop(map_type, &clone);
+					} break;
+					case 3: {
+						if (operation % 8 == 0) {
+							tsk_map_clear(map_type, &map);
+							model = (TestModel){ .length = 0 };
+						}
+					} break;
+					default: {
+						assert_int_equal(tsk_map_key_const(map_type, &map, &key) != TSK_NULL, model.present[index]);
+					} break;
+				}
+			} break;
+		}
+
+		assert_int_equal(tsk_map_length(map_type, &map), model.length);
+		resizing = resizing || tsk_map_is_resizing(map_type, &map);
+		if (operation % TEST_MODEL_CHECK_INTERVAL == 0) {
+			test_model_check(map_type, &map, &model);
+		}
+	}
+	test_model_check(map_type, &map, &model);
+	assert_int_equal(resizing, incremental_resize);
+
+	tsk_map_drop(map_type, &map);
+}
+
+static void test_map_matches_model(void **state) {
+	(void)state;
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	TskMapLayout layouts[] = { TSK_MAP_LAYOUT_SPLIT, TSK_MAP_LAYOUT_INTERLEAVED };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		for (TskUSize j = 0; j < sizeof(layouts) / sizeof(layouts[0]); j++) {
+			const TskType *map_type = tsk_map_type_with_layout(tsk_u64_type, tsk_u64_type, engines[i], layouts[j]);
+			assert_non_null(map_type);
+			assert_int_equal(tsk_map_engine(map_type), engines[i]);
+			assert_int_equal(tsk_map_layout(map_type), layouts[j]);
+
+			for (TskUSize k = 0; k < 4; k++) {
+				test_model_run(map_type, k % 2 == 1, k / 2 == 1, i * 8 + j * 4 + k + 1);
+			}
+		}
+	}
+}
+
+static void test_map_parallel_matches_model(void **state) {
+	(void)state;
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	TskMapLayout layouts[] = { TSK_MAP_LAYOUT_SPLIT, TSK_MAP_LAYOUT_INTERLEAVED };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		for (TskUSize j = 0; j < sizeof(layouts) / sizeof(layouts[0]); j++) {
+			const TskType *map_type = tsk_map_type_with_layout(tsk_u64_type, tsk_u64_type, engines[i], layouts[j]);
+			assert_non_null(map_type);
+			const TskType *item_type  = tsk_map_item_type(map_type);
+			const TskType *items_type = tsk_array_view_type(item_type);
+
+			static TskU8   elements[TEST_PARALLEL_ITEMS_LENGTH * 2 * sizeof(TskU64)];
+			assert_true(tsk_trait_complete_size(item_type) == 2 * sizeof(TskU64));
+			TskArrayView items = tsk_array_view_new(items_type, elements, TEST_PARALLEL_ITEMS_LENGTH, 1);
+
+			static TestModel model;
+			model               = (TestModel){ .length = 0 };
+
+			TskU64 random_state = i * 2 + j + 1;
+			for (TskUSize k = 0; k < TEST_PARALLEL_ITEMS_LENGTH; k++) {
+				TskUSize  index                              = (TskUSize)(test_random(&random_state) % TEST_MODEL_KEYS_LENGTH);
+				TskTuple *item                               = tsk_array_view_get(items_type, items, k);
+				*(TskU64 *)tsk_tuple_get(item_type, item, 0) = test_model_key(index);
+				*(TskU64 *)tsk_tuple_get(item_type, item, 1) = index * 3;
+				test_model_set(&model, index, index * 3);
+			}
+
+			for (TskUSize k = 0; k < 2; k++) {
+				TskMap map = tsk_map_new(map_type);
+				tsk_map_set_incremental_resize(map_type, &map, k == 1);
+				TskU64 key   = test_model_key(0);
+				TskU64 value = 0;
+				assert_true(tsk_map_insert(map_type, &map, &key, &value));
+
+				assert_true(tsk_map_parallel_extend(map_type, &map, items, TSK_FALSE, TEST_PARALLEL_THREADS));
+				test_model_check(map_type, &map, &model);
+
+				TskMap clone;
+				assert_true(tsk_map_parallel_clone(map_type, &map, &clone, TEST_PARALLEL_THREADS));
+				assert_true(tsk_map_equals(map_type, &map, &clone));
+				test_model_check(map_type, &clone, &model);
+
+				tsk_map_parallel_clear(map_type, &clone, TEST_PARALLEL_THREADS);
+				assert_true(tsk_map_is_empty(map_type, &clone));
+				TestModel empty = { .length = 0 };
+				test_model_check(map_type, &clone, &empty);
+
+				assert_true(tsk_map_extend(map_type, &clone, items, TSK_FALSE));
+				assert_true(tsk_map_equals(map_type, &map, &clone));
+
+				tsk_map_drop(map_type, &clone);
+				tsk_map_drop(map_type, &map);
+			}
+		}
+	}
+}
+
+static TskBoolean test_string_key_equals(const TskAny *key_1, const TskAny *key_2) {
+	const TskType *array_type = tsk_array_type(tsk_character_type);
+	return tsk_array_view_const_equals(
+	    tsk_array_view_const_type(tsk_character_type),
+	    *(const TskArrayViewConst *)key_1,
+	    tsk_array_view_const(array_type, key_2)
+	);
+}
+
+static void test_map_heterogeneous_matches_get(void **state) {
+	(void)state;
+
+	const TskType *array_type      = tsk_array_type(tsk_character_type);
+	const TskType *array_view_type = tsk_array_view_const_type(tsk_character_type);
+	assert_non_null(array_type);
+	assert_non_null(array_view_type);
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		const TskType *map_type = tsk_map_type_with_engine(array_type, tsk_u64_type, engines[i]);
+		assert_non_null(map_type);
+
+		TskMap map = tsk_map_new(map_type);
+		for (TskUSize j = 0; j < TEST_STRING_KEYS_LENGTH; j++) {
+			TskCharacter string[32];
+			int          length = snprintf(string, sizeof(string), "key-%zu", j * 2);
+			assert_true(length > 0);
+
+			TskArray key = tsk_array_new(array_type);
+			for (int k = 0; k < length; k++) {
+				assert_true(tsk_array_push_back(array_type, &key, &string[k]));
+			}
+			TskU64 key_hash = tsk_map_hash(map_type, &map, array_type, &key);
+			TskU64 value    = j;
+			assert_true(tsk_map_insert(map_type, &map, &key, &value));
+
+			for (TskUSize k = 0; k <= j * 2 + 1; k++) {
+				length                 = snprintf(string, sizeof(string), "key-%zu", k);
+				TskArrayViewConst view = tsk_array_view_const_new(array_view_type, string, (TskUSize)length, 1);
+				TskU64            hash = tsk_map_hash(map_type, &map, array_view_type, &view);
+				if (k == j * 2) {
+					assert_int_equal(hash, key_hash);
+				}
+
+				TskU64       *value_heterogeneous       = tsk_map_get_heterogeneous(map_type, &map, &view, hash, test_string_key_equals);
+				const TskU64 *value_const_heterogeneous = tsk_map_get_const_heterogeneous(map_type, &map, &view, hash, test_string_key_equals);
+				assert_ptr_equal(value_heterogeneous, value_const_heterogeneous);
+				if (k % 2 == 0) {
+					assert_non_null(value_heterogeneous);
+					assert_int_equal(*value_heterogeneous, k / 2);
+				} else {
+					assert_null(value_heterogeneous);
+				}
+			}
+		}
+		assert_int_equal(tsk_map_length(map_type, &map), TEST_STRING_KEYS_LENGTH);
+
+		tsk_map_drop(map_type, &map);
+	}
+}
+
+static TskBoolean test_u8_key_equals(const TskAny *key_1, const TskAny *key_2) {
+	return *(const TskU8 *)key_1 == *(const TskU64 *)key_2;
+}
+static TskBoolean test_u16_key_equals(const TskAny *key_1, const TskAny *key_2) {
+	return *(const TskU16 *)key_1 == *(const TskU64 *)key_2;
+}
+static TskBoolean test_u32_key_equals(const TskAny *key_1, const TskAny *key_2) {
+	return *(const TskU32 *)key_1 == *(const TskU64 *)key_2;
+}
+
+static void test_map_narrow_key_matches_get(void **state) {
+	(void)state;
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		const TskType *map_type = tsk_map_type_with_engine(tsk_u64_type, tsk_u64_type, engines[i]);
+		assert_non_null(map_type);
+
+		TskMap map = tsk_map_new(map_type);
+		for (TskU64 key = 0; key < 512; key += 2) {
+			TskU64 value = key * 3;
+			assert_true(tsk_map_insert(map_type, &map, &key, &value));
+		}
+
+		for (TskU64 key = 0; key < 512; key++) {
+			TskU64        hash  = tsk_map_hash(map_type, &map, tsk_u64_type, &key);
+			const TskU64 *value = tsk_map_get_const(map_type, &map, &key);
+
+			TskU32 key_u32 = (TskU32)key;
+			assert_int_equal(tsk_map_hash(map_type, &map, tsk_u32_type, &key_u32), hash);
+			assert_ptr_equal(tsk_map_get_const_heterogeneous(map_type, &map, &key_u32, hash, test_u32_key_equals), value);
+
+			TskU16 key_u16 = (TskU16)key;
+			assert_int_equal(tsk_map_hash(map_type, &map, tsk_u16_type, &key_u16), hash);
+			assert_ptr_equal(tsk_map_get_const_heterogeneous(map_type, &map, &key_u16, hash, test_u16_key_equals), value);
+
+			if (key <= UINT8_MAX) {
+				TskU8 key_u8 = (TskU8)key;
+				assert_int_equal(tsk_map_hash(map_type, &map, tsk_u8_type, &key_u8), hash);
+				assert_ptr_equal(tsk_map_get_const_heterogeneous(map_type, &map, &key_u8, hash, test_u8_key_equals), value);
+			}
+		}
+
+		tsk_map_drop(map_type, &map);
+	}
+}
+
+static void test_map_extend_matches_model(void **state) {
+	(void)state;
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	TskMapLayout layouts[] = { TSK_MAP_LAYOUT_SPLIT, TSK_MAP_LAYOUT_INTERLEAVED };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		for (TskUSize j = 0; j < sizeof(layouts) / sizeof(layouts[0]); j++) {
+			const TskType *map_type = tsk_map_type_with_layout(tsk_u64_type, tsk_u64_type, engines[i], layouts[j]);
+			assert_non_null(map_type);
+			const TskType *item_type  = tsk_map_item_type(map_type);
+			const TskType *items_type = tsk_array_view_type(item_type);
+
+			static TskU8   unique_elements[TEST_MODEL_KEYS_LENGTH / 2 * 2 * sizeof(TskU64)];
+			static TskU64  items[TEST_EXTEND_ITEMS_LENGTH][2];
+			assert_true(tsk_trait_complete_size(item_type) == 2 * sizeof(TskU64));
+			TskArrayView unique_items = tsk_array_view_new(items_type, unique_elements, TEST_MODEL_KEYS_LENGTH / 2, 1);
+
+			static TestModel unique_model;
+			static TestModel items_model;
+			static TestModel model;
+			unique_model = (TestModel){ .length = 0 };
+			items_model  = (TestModel){ .length = 0 };
+
+			for (TskUSize k = 0; k < TEST_MODEL_KEYS_LENGTH / 2; k++) {
+				TskTuple *item                               = tsk_array_view_get(items_type, unique_items, k);
+				*(TskU64 *)tsk_tuple_get(item_type, item, 0) = test_model_key(k);
+				*(TskU64 *)tsk_tuple_get(item_type, item, 1) = k * 3;
+				test_model_set(&unique_model, k, k * 3);
+			}
+
+			TskU64 random_state = i * 2 + j + 1;
+			for (TskUSize k = 0; k < TEST_EXTEND_ITEMS_LENGTH; k++) {
+				TskUSize index = (TskUSize)(test_random(&random_state) % TEST_MODEL_KEYS_LENGTH);
+				items[k][0]    = test_model_key(index);
+				items[k][1]    = k;
+				test_model_set(&items_model, index, k);
+			}
+
+			for (TskUSize k = 0; k < 2; k++) {
+				TskMap map = tsk_map_new(map_type);
+				tsk_map_set_incremental_resize(map_type, &map, k == 1);
+
+				model = (TestModel){ .length = 0 };
+				for (TskUSize l = TEST_MODEL_KEYS_LENGTH / 2; l < TEST_MODEL_KEYS_LENGTH; l++) {
+					TskU64 key   = test_model_key(l);
+					TskU64 value = l;
+					assert_true(tsk_map_insert(map_type, &map, &key, &value));
+					test_model_set(&model, l, l);
+				}
+
+				for (TskUSize l = 0; l < TEST_MODEL_KEYS_LENGTH / 2; l++) {
+					test_model_set(&model, l, unique_model.values[l]);
+				}
+				assert_true(tsk_map_extend(map_type, &map, unique_items, TSK_TRUE));
+				test_model_check(map_type, &map, &model);
+
+				for (TskUSize l = 0; l < TEST_MODEL_KEYS_LENGTH; l++) {
+					if (items_model.present[l]) {
+						test_model_set(&model, l, items_model.values[l]);
+					}
+				}
+				TestItemsIterator iterator = { .items = items, .length = TEST_EXTEND_ITEMS_LENGTH };
+				assert_true(tsk_map_extend_from_iterator(map_type, &map, tsk_test_items_iterator_type, &iterator, TSK_FALSE));
+				test_model_check(map_type, &map, &model);
+				tsk_map_drop(map_type, &map);
+
+				iterator = (TestItemsIterator){ .items = items, .length = TEST_EXTEND_ITEMS_LENGTH };
+				assert_true(tsk_map_from_iterator(map_type, &map, tsk_test_items_iterator_type, &iterator, TSK_FALSE));
+				test_model_check(map_type, &map, &items_model);
+				tsk_map_drop(map_type, &map);
+			}
+		}
+	}
+}
+
+static TskEmpty test_get_many_check(const TskType *map_type, TskMap *map, TskUSize round) {
+	TskU64 keys[TEST_GET_MANY_KEYS_LENGTH];
+	for (TskUSize i = 0; i < TEST_GET_MANY_KEYS_LENGTH; i++) {
+		keys[i] = test_model_key((i * 7 + round) % (TEST_GET_MANY_INSERTS * 2));
+	}
+
+	TskUSize lengths[] = {
+		0,
+		1,
+		TEST_GET_MANY_BATCH_LENGTH - 1,
+		TEST_GET_MANY_BATCH_LENGTH,
+		TEST_GET_MANY_BATCH_LENGTH + 1,
+		TEST_GET_MANY_BATCH_LENGTH * 2,
+		TEST_GET_MANY_BATCH_LENGTH * 2 + 1,
+		TEST_GET_MANY_KEYS_LENGTH,
+	};
+	for (TskUSize i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+		TskU64       *values[TEST_GET_MANY_KEYS_LENGTH];
+		const TskU64 *values_const[TEST_GET_MANY_KEYS_LENGTH];
+		for (TskUSize j = 0; j < TEST_GET_MANY_KEYS_LENGTH; j++) {
+			values[j]       = &keys[j];
+			values_const[j] = &keys[j];
+		}
+
+		TskArrayViewConst keys_view      = tsk_array_view_const_new(tsk_array_view_const_type(tsk_u64_type), keys, lengths[i], 1);
+		TskUSize          found          = tsk_map_get_many(map_type, map, keys_view, tsk_array_view_new(tsk_array_view_type(tsk_reference_type(tsk_u64_type)), values, lengths[i], 1));
+		TskUSize          found_const    = tsk_map_get_many_const(map_type, map, keys_view, tsk_array_view_new(tsk_array_view_type(tsk_reference_const_type(tsk_u64_type)), values_const, lengths[i], 1));
+
+		TskUSize          expected_found = 0;
+		for (TskUSize j = 0; j < lengths[i]; j++) {
+			TskAny *value = tsk_map_get(map_type, map, &keys[j]);
+			expected_found += value != TSK_NULL;
+			assert_ptr_equal(values[j], value);
+			assert_ptr_equal(values_const[j], value);
+		}
+		for (TskUSize j = lengths[i]; j < TEST_GET_MANY_KEYS_LENGTH; j++) {
+			assert_ptr_equal(values[j], &keys[j]);
+			assert_ptr_equal(values_const[j], &keys[j]);
+		}
+		assert_int_equal(found, expected_found);
+		assert_int_equal(found_const, expected_found);
+	}
+}
+
+static void test_map_get_many_matches_get(void **state) {
+	(void)state;
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	TskMapLayout layouts[] = { TSK_MAP_LAYOUT_SPLIT, TSK_MAP_LAYOUT_INTERLEAVED };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		for (TskUSize j = 0; j < sizeof(layouts) / sizeof(layouts[0]); j++) {
+			const TskType *map_type = tsk_map_type_with_layout(tsk_u64_type, tsk_u64_type, engines[i], layouts[j]);
+			assert_non_null(map_type);
+
+			for (TskUSize k = 0; k < 2; k++) {
+				TskMap map = tsk_map_new(map_type);
+				tsk_map_set_incremental_resize(map_type, &map, k == 1);
+				test_get_many_check(map_type, &map, 0);
+
+				TskBoolean was_resizing = TSK_FALSE;
+				for (TskUSize l = 0; l < TEST_GET_MANY_INSERTS; l++) {
+					TskU64 key   = test_model_key(l * 2);
+					TskU64 value = l;
+					assert_true(tsk_map_insert(map_type, &map, &key, &value));
+					was_resizing = was_resizing || tsk_map_is_resizing(map_type, &map);
+					test_get_many_check(map_type, &map, l);
+				}
+				assert_int_equal(was_resizing, k == 1);
+
+				for (TskUSize l = 0; l < TEST_GET_MANY_INSERTS; l++) {
+					TskU64 key = test_model_key(l * 2);
+					assert_true(tsk_map_remove(map_type, &map, &key, TSK_NULL));
+				}
+				assert_true(tsk_map_is_empty(map_type, &map));
+				test_get_many_check(map_type, &map, 0);
+
+				tsk_map_drop(map_type, &map);
+			}
+		}
+	}
+}
+
+int main(void) {
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_map_typed_length_during_incremental_resize),
+		cmocka_unit_test(test_map_typed_custom_key_matches_erased),
+		cmocka_unit_test(test_map_type_name_includes_engine_and_layout),
+		cmocka_unit_test(test_map_reserve_above_float_precision),
+		cmocka_unit_test(test_map_matches_model),
+		cmocka_unit_test(test_map_parallel_matches_model),
+		cmocka_unit_test(test_map_heterogeneous_matches_get),
+		cmocka_unit_test(test_map_narrow_key_matches_get),
+		cmocka_unit_test(test_map_extend_matches_model),
+		cmocka_unit_test(test_map_get_many_matches_get),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
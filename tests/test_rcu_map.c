@@ -0,0 +1,155 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <tsk/rcu_map.h>
+#include <tsk/type.h>
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define TEST_WRITERS            4
+#define TEST_READERS            4
+#define TEST_ROUNDS             32
+#define TEST_STABLE_KEYS_LENGTH 256
+#define TEST_KEYS_LENGTH        2000
+
+typedef struct TestThread TestThread;
+struct TestThread {
+	const TskType *rcu_map_type;
+	TskRcuMap     *rcu_map;
+	atomic_bool   *is_writing;
+	TskUSize       offset;
+};
+
+static TskU64 test_key(TskUSize index) {
+	return (TskU64)index << 32 | index;
+}
+
+static void *test_writer_run(void *argument) {
+	TestThread *thread = argument;
+
+	for (TskUSize round = 0; round <= TEST_ROUNDS; round++) {
+		for (TskUSize i = TEST_STABLE_KEYS_LENGTH + thread->offset; i < TEST_KEYS_LENGTH; i += TEST_WRITERS) {
+			TskU64 key   = test_key(i);
+			TskU64 value = i * 3;
+			if (!tsk_rcu_map_insert(thread->rcu_map_type, thread->rcu_map, &key, &value)) {
+				return argument;
+			}
+		}
+
+		TskUSize step = round == TEST_ROUNDS ? TEST_WRITERS * 2 : TEST_WRITERS;
+		for (TskUSize i = TEST_STABLE_KEYS_LENGTH + thread->offset; i < TEST_KEYS_LENGTH; i += step) {
+			TskU64 key = test_key(i);
+			if (!tsk_rcu_map_remove(thread->rcu_map_type, thread->rcu_map, &key)) {
+				return argument;
+			}
+		}
+
+		tsk_rcu_map_synchronize(thread->rcu_map_type, thread->rcu_map);
+	}
+
+	return TSK_NULL;
+}
+static void *test_reader_run(void *argument) {
+	TestThread *thread = argument;
+
+	TskUSize index     = thread->offset;
+	do {
+		for (TskUSize i = 0; i < TEST_KEYS_LENGTH; i++) {
+			TskU64 key   = test_key(index);
+			TskU64 value = 0;
+			if (tsk_rcu_map_get(thread->rcu_map_type, thread->rcu_map, &key, &value)) {
+				if (value != index * 3) {
+					return argument;
+				}
+			} else if (index < TEST_STABLE_KEYS_LENGTH) {
+				return argument;
+			}
+			index = (index + 7919) % TEST_KEYS_LENGTH;
+		}
+	} while (atomic_load(thread->is_writing));
+
+	return TSK_NULL;
+}
+
+static void test_rcu_map_matches_model(void **state) {
+	(void)state;
+
+	const TskType *rcu_map_type = tsk_rcu_map_type(tsk_u64_type, tsk_u64_type);
+	assert_non_null(rcu_map_type);
+
+	TskRcuMap rcu_map;
+	assert_true(tsk_rcu_map_new(rcu_map_type, &rcu_map));
+	for (TskUSize i = 0; i < TEST_STABLE_KEYS_LENGTH; i++) {
+		TskU64 key   = test_key(i);
+		TskU64 value = i * 3;
+		assert_true(tsk_rcu_map_insert(rcu_map_type, &rcu_map, &key, &value));
+	}
+
+	atomic_bool is_writing;
+	atomic_init(&is_writing, TSK_TRUE);
+
+	TestThread readers[TEST_READERS];
+	pthread_t  reader_ids[TEST_READERS];
+	for (TskUSize i = 0; i < TEST_READERS; i++) {
+		readers[i] = (TestThread){
+			.rcu_map_type = rcu_map_type,
+			.rcu_map      = &rcu_map,
+			.is_writing   = &is_writing,
+			.offset       = i,
+		};
+		assert_int_equal(pthread_create(&reader_ids[i], TSK_NULL, test_reader_run, &readers[i]), 0);
+	}
+
+	TestThread writers[TEST_WRITERS];
+	pthread_t  writer_ids[TEST_WRITERS];
+	for (TskUSize i = 0; i < TEST_WRITERS; i++) {
+		writers[i] = (TestThread){
+			.rcu_map_type = rcu_map_type,
+			.rcu_map      = &rcu_map,
+			.is_writing   = &is_writing,
+			.offset       = i,
+		};
+		assert_int_equal(pthread_create(&writer_ids[i], TSK_NULL, test_writer_run, &writers[i]), 0);
+	}
+	for (TskUSize i = 0; i < TEST_WRITERS; i++) {
+		void *result = TSK_NULL;
+		assert_int_equal(pthread_join(writer_ids[i], &result), 0);
+		assert_null(result);
+	}
+
+	atomic_store(&is_writing, TSK_FALSE);
+	for (TskUSize i = 0; i < TEST_READERS; i++) {
+		void *result = TSK_NULL;
+		assert_int_equal(pthread_join(reader_ids[i], &result), 0);
+		assert_null(result);
+	}
+
+	TskUSize length = 0;
+	for (TskUSize i = 0; i < TEST_KEYS_LENGTH; i++) {
+		TskBoolean present = i < TEST_STABLE_KEYS_LENGTH || (i - TEST_STABLE_KEYS_LENGTH) % (TEST_WRITERS * 2) >= TEST_WRITERS;
+		length += present;
+
+		TskU64 key   = test_key(i);
+		TskU64 value = 0;
+		assert_int_equal(tsk_rcu_map_get(rcu_map_type, &rcu_map, &key, &value), present);
+		if (present) {
+			assert_int_equal(value, i * 3);
+		}
+	}
+	assert_int_equal(tsk_rcu_map_length(rcu_map_type, &rcu_map), length);
+
+	tsk_rcu_map_drop(rcu_map_type, &rcu_map);
+}
+
+int main(void) {
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_rcu_map_matches_model),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,232 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <tsk/array.h>
+#include <tsk/set.h>
+#include <tsk/type.h>
+
+#define TEST_MODEL_KEYS_LENGTH    512
+#define TEST_MODEL_OPERATIONS     20000
+#define TEST_MODEL_DENSITY_LENGTH 8
+
+typedef struct TestModel TestModel;
+struct TestModel {
+	TskBoolean present[TEST_MODEL_KEYS_LENGTH];
+	TskUSize   length;
+};
+
+typedef enum TestModelRelation {
+	TEST_MODEL_RELATION_RANDOM,
+	TEST_MODEL_RELATION_SUBSET,
+	TEST_MODEL_RELATION_DISJOINT,
+} TestModelRelation;
+
+static TskU64 test_random(TskU64 *state) {
+	TskU64 random = (*state += 0x9E3779B97F4A7C15ULL);
+	random        = (random ^ (random >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	random        = (random ^ (random >> 27)) * 0x94D049BB133111EBULL;
+	return random ^ (random >> 31);
+}
+static TskU64 test_model_key(TskUSize index) {
+	return (TskU64)index << 32 | index;
+}
+static TskEmpty test_model_set(TestModel *model, TskUSize index, TskBoolean present) {
+	if (model->present[index] != present) {
+		model->present[index] = present;
+		model->length         = present ? model->length + 1 : model->length - 1;
+	}
+}
+static TskEmpty test_model_check(const TskType *set_type, const TskSet *set, const TestModel *model) {
+	assert_int_equal(tsk_set_length(set_type, set), model->length);
+	for (TskUSize index = 0; index < TEST_MODEL_KEYS_LENGTH; index++) {
+		TskU64 key = test_model_key(index);
+		assert_int_equal(tsk_set_contains(set_type, set, &key), model->present[index]);
+	}
+
+	TskBoolean     seen[TEST_MODEL_KEYS_LENGTH] = { TSK_FALSE };
+	TskUSize       length                       = 0;
+	const TskType *set_iterator_type            = tsk_set_iterator_type_with_set_type(set_type);
+	TskSetIterator set_iterator                 = tsk_set_iterator(set_type, set);
+	const TskU64  *element                      = TSK_NULL;
+	while (tsk_set_iterator_next(set_iterator_type, &set_iterator, &element)) {
+		TskUSize index = (TskUSize)(*element & 0xFFFFFFFF);
+		assert_true(index < TEST_MODEL_KEYS_LENGTH);
+		assert_true(model->present[index]);
+		assert_false(seen[index]);
+		seen[index] = TSK_TRUE;
+		length++;
+	}
+	assert_int_equal(length, model->length);
+}
+static TskEmpty test_model_fill(const TskType *set_type, TskSet *set, TestModel *model, TskUSize density, const TestModel *other_model, TestModelRelation relation, TskU64 *random_state) {
+	*set   = tsk_set_new(set_type);
+	*model = (TestModel){ .length = 0 };
+	for (TskUSize index = 0; index < TEST_MODEL_KEYS_LENGTH; index++) {
+		if (test_random(random_state) % TEST_MODEL_DENSITY_LENGTH >= density ||
+		    (relation == TEST_MODEL_RELATION_SUBSET && !other_model->present[index]) ||
+		    (relation == TEST_MODEL_RELATION_DISJOINT && other_model->present[index])) {
+			continue;
+		}
+
+		TskU64 key = test_model_key(index);
+		assert_true(tsk_set_insert(set_type, set, &key));
+		test_model_set(model, index, TSK_TRUE);
+	}
+	test_model_check(set_type, set, model);
+}
+static TskEmpty test_model_check_operations(const TskType *set_type, const TskSet *set_1, const TestModel *model_1, const TskSet *set_2, const TestModel *model_2) {
+	static TestModel union_model;
+	static TestModel intersection_model;
+	static TestModel difference_model;
+	union_model            = (TestModel){ .length = 0 };
+	intersection_model     = (TestModel){ .length = 0 };
+	difference_model       = (TestModel){ .length = 0 };
+
+	TskBoolean is_subset   = TSK_TRUE;
+	TskBoolean is_disjoint = TSK_TRUE;
+	for (TskUSize index = 0; index < TEST_MODEL_KEYS_LENGTH; index++) {
+		test_model_set(&union_model, index, model_1->present[index] || model_2->present[index]);
+		test_model_set(&intersection_model, index, model_1->present[index] && model_2->present[index]);
+		test_model_set(&difference_model, index, model_1->present[index] && !model_2->present[index]);
+		if (model_1->present[index] && !model_2->present[index]) {
+			is_subset = TSK_FALSE;
+		}
+		if (model_1->present[index] && model_2->present[index]) {
+			is_disjoint = TSK_FALSE;
+		}
+	}
+
+	TskSet set;
+	assert_true(tsk_set_union(set_type, set_1, set_2, &set));
+	test_model_check(set_type, &set, &union_model);
+	tsk_set_drop(set_type, &set);
+
+	assert_true(tsk_set_intersection(set_type, set_1, set_2, &set));
+	test_model_check(set_type, &set, &intersection_model);
+	tsk_set_drop(set_type, &set);
+
+	assert_true(tsk_set_difference(set_type, set_1, set_2, &set));
+	test_model_check(set_type, &set, &difference_model);
+	tsk_set_drop(set_type, &set);
+
+	assert_int_equal(tsk_set_is_subset(set_type, set_1, set_2), is_subset);
+	assert_int_equal(tsk_set_is_disjoint(set_type, set_1, set_2), is_disjoint);
+	assert_int_equal(tsk_set_equals(set_type, set_1, set_2), is_subset && model_1->length == model_2->length);
+
+	static TskU64 elements[2 * TEST_MODEL_KEYS_LENGTH];
+	TskUSize      length = 0;
+	for (TskUSize index = 0; index < TEST_MODEL_KEYS_LENGTH; index++) {
+		if (model_2->present[index]) {
+			elements[length++] = test_model_key(index);
+		}
+	}
+	for (TskUSize index = TEST_MODEL_KEYS_LENGTH; index > 0; index--) {
+		if (model_2->present[index - 1]) {
+			elements[length++] = test_model_key(index - 1);
+		}
+	}
+
+	assert_true(tsk_set_clone(set_type, set_1, &set));
+	assert_true(tsk_set_extend(set_type, &set, tsk_array_view_new(tsk_array_view_type(tsk_u64_type), elements, length, 1)));
+	test_model_check(set_type, &set, &union_model);
+	tsk_set_drop(set_type, &set);
+}
+
+static void test_set_matches_model(void **state) {
+	(void)state;
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		const TskType *set_type = tsk_set_type_with_engine(tsk_u64_type, engines[i]);
+		assert_non_null(set_type);
+
+		TskSet set = tsk_set_new(set_type);
+
+		static TestModel model;
+		model               = (TestModel){ .length = 0 };
+
+		TskU64 random_state = i + 1;
+		for (TskUSize operation = 0; operation < TEST_MODEL_OPERATIONS; operation++) {
+			TskU64   random = test_random(&random_state);
+			TskUSize index  = (TskUSize)(random >> 16) % TEST_MODEL_KEYS_LENGTH;
+			TskU64   key    = test_model_key(index);
+
+			switch (random % 3) {
+				case 0: {
+					assert_true(tsk_set_insert(set_type, &set, &key));
+					test_model_set(&model, index, TSK_TRUE);
+				} break;
+				case 1: {
+					assert_int_equal(tsk_set_remove(set_type, &set, &key), model.present[index]);
+					test_model_set(&model, index, TSK_FALSE);
+				} break;
+				case 2: {
+					assert_int_equal(tsk_set_contains(set_type, &set, &key), model.present[index]);
+				} break;
+			}
+			assert_int_equal(tsk_set_length(set_type, &set), model.length);
+		}
+		test_model_check(set_type, &set, &model);
+
+		tsk_set_drop(set_type, &set);
+	}
+}
+
+static void test_set_operations_match_model(void **state) {
+	(void)state;
+
+	struct {
+		TskUSize          density_1;
+		TskUSize          density_2;
+		TestModelRelation relation;
+	} cases[] = {
+		{ 7, 1, TEST_MODEL_RELATION_RANDOM },
+		{ 1, 7, TEST_MODEL_RELATION_RANDOM },
+		{ 4, 4, TEST_MODEL_RELATION_RANDOM },
+		{ 7, 2, TEST_MODEL_RELATION_SUBSET },
+		{ 7, 8, TEST_MODEL_RELATION_SUBSET },
+		{ 4, 8, TEST_MODEL_RELATION_DISJOINT },
+		{ 1, 8, TEST_MODEL_RELATION_DISJOINT },
+		{ 0, 4, TEST_MODEL_RELATION_RANDOM },
+		{ 4, 0, TEST_MODEL_RELATION_RANDOM },
+		{ 0, 0, TEST_MODEL_RELATION_RANDOM },
+	};
+
+	TskMapEngine engines[] = { TSK_MAP_ENGINE_SWISS_TABLE, TSK_MAP_ENGINE_ROBIN_HOOD };
+	for (TskUSize i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+		const TskType *set_type = tsk_set_type_with_engine(tsk_u64_type, engines[i]);
+		assert_non_null(set_type);
+
+		for (TskUSize j = 0; j < sizeof(cases) / sizeof(cases[0]); j++) {
+			static TestModel model_1;
+			static TestModel model_2;
+			TskSet           set_1;
+			TskSet           set_2;
+
+			TskU64 random_state = i * 64 + j + 1;
+			test_model_fill(set_type, &set_1, &model_1, cases[j].density_1, TSK_NULL, TEST_MODEL_RELATION_RANDOM, &random_state);
+			test_model_fill(set_type, &set_2, &model_2, cases[j].density_2, &model_1, cases[j].relation, &random_state);
+
+			test_model_check_operations(set_type, &set_1, &model_1, &set_2, &model_2);
+			test_model_check_operations(set_type, &set_2, &model_2, &set_1, &model_1);
+			test_model_check_operations(set_type, &set_1, &model_1, &set_1, &model_1);
+			test_model_check_operations(set_type, &set_2, &model_2, &set_2, &model_2);
+
+			tsk_set_drop(set_type, &set_1);
+			tsk_set_drop(set_type, &set_2);
+		}
+	}
+}
+
+int main(void) {
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_set_matches_model),
+		cmocka_unit_test(test_set_operations_match_model),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
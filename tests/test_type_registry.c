@@ -0,0 +1,173 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <tsk/array.h>
+#include <tsk/concurrent_map.h>
+#include <tsk/deque.h>
+#include <tsk/list.h>
+#include <tsk/map.h>
+#include <tsk/rcu_map.h>
+#include <tsk/reference.h>
+#include <tsk/set.h>
+#include <tsk/tuple.h>
+#include <tsk/type.h>
+#include <tsk/type_registry.h>
+
+#include <pthread.h>
+
+#define TEST_THREADS_LENGTH 64
+#define TEST_ELEMENT_TYPES_LENGTH 8
+#define TEST_KEY_TYPES_LENGTH 4
+#define TEST_CHAIN_LENGTH 1024
+#define TEST_TYPES_LENGTH ((TEST_ELEMENT_TYPES_LENGTH * 13) + (TEST_KEY_TYPES_LENGTH * TEST_KEY_TYPES_LENGTH * 6) + TEST_CHAIN_LENGTH)
+
+typedef struct TestThread TestThread;
+struct TestThread {
+	pthread_barrier_t *barrier;
+	TskUSize           offset;
+	const TskType     *types[TEST_TYPES_LENGTH];
+};
+
+static const TskType *test_element_type(TskUSize index) {
+	const TskType *const element_types[TEST_ELEMENT_TYPES_LENGTH] = {
+		tsk_u8_type,
+		tsk_u16_type,
+		tsk_u32_type,
+		tsk_u64_type,
+		tsk_i8_type,
+		tsk_i16_type,
+		tsk_i32_type,
+		tsk_i64_type,
+	};
+	return element_types[index];
+}
+
+static void *test_thread_run(void *argument) {
+	TestThread *thread = argument;
+
+	(void)pthread_barrier_wait(thread->barrier);
+
+	for (TskUSize i = 0; i < TEST_ELEMENT_TYPES_LENGTH; i++) {
+		TskUSize       element_index = (i + thread->offset) % TEST_ELEMENT_TYPES_LENGTH;
+		const TskType *element_type  = test_element_type(element_index);
+		const TskType **types        = &thread->types[element_index * 13];
+
+		types[0]                     = tsk_reference_type(element_type);
+		types[1]                     = tsk_reference_const_type(element_type);
+		types[2]                     = tsk_array_type(element_type);
+		types[3]                     = tsk_array_view_type(element_type);
+		types[4]                     = tsk_array_view_const_type(element_type);
+		types[5]                     = tsk_array_iterator_type(types[2]);
+		types[6]                     = tsk_array_iterator_const_type(types[2]);
+		types[7]                     = tsk_list_type(element_type);
+		types[8]                     = tsk_list_iterator_type(types[7]);
+		types[9]                     = tsk_list_iterator_const_type(types[7]);
+		types[10]                    = tsk_deque_type(element_type);
+		types[11]                    = tsk_set_type(element_type);
+		types[12]                    = tsk_set_iterator_type(element_type);
+	}
+	for (TskUSize i = 0; i < TEST_KEY_TYPES_LENGTH * TEST_KEY_TYPES_LENGTH; i++) {
+		TskUSize        pair_index = (i + thread->offset) % (TEST_KEY_TYPES_LENGTH * TEST_KEY_TYPES_LENGTH);
+		const TskType  *key_type   = test_element_type(pair_index / TEST_KEY_TYPES_LENGTH);
+		const TskType  *value_type = test_element_type(pair_index % TEST_KEY_TYPES_LENGTH);
+		const TskType **types      = &thread->types[(TEST_ELEMENT_TYPES_LENGTH * 13) + (pair_index * 6)];
+
+		types[0]                   = tsk_tuple_type((const TskType *[]){ key_type, value_type }, 2);
+		types[1]                   = tsk_map_type(key_type, value_type);
+		types[2]                   = tsk_map_iterator_type(key_type, value_type);
+		types[3]                   = tsk_map_iterator_const_type(key_type, value_type);
+		types[4]                   = tsk_concurrent_map_type(key_type, value_type);
+		types[5]                   = tsk_rcu_map_type(key_type, value_type);
+	}
+
+	const TskType **types = &thread->types[(TEST_ELEMENT_TYPES_LENGTH * 13) + (TEST_KEY_TYPES_LENGTH * TEST_KEY_TYPES_LENGTH * 6)];
+	for (TskUSize i = 0; i < TEST_CHAIN_LENGTH; i++) {
+		types[i] = i == 0 ? tsk_array_type(tsk_u8_type) : tsk_array_type(types[i - 1]);
+	}
+
+	return TSK_NULL;
+}
+
+static void test_type_registry_concurrent_first_use(void **state) {
+	(void)state;
+
+	pthread_barrier_t barrier;
+	assert_int_equal(pthread_barrier_init(&barrier, TSK_NULL, TEST_THREADS_LENGTH), 0);
+
+	static TestThread threads[TEST_THREADS_LENGTH];
+	pthread_t         thread_ids[TEST_THREADS_LENGTH];
+	for (TskUSize i = 0; i < TEST_THREADS_LENGTH; i++) {
+		threads[i].barrier = &barrier;
+		threads[i].offset  = i;
+		assert_int_equal(pthread_create(&thread_ids[i], TSK_NULL, test_thread_run, &threads[i]), 0);
+	}
+	for (TskUSize i = 0; i < TEST_THREADS_LENGTH; i++) {
+		assert_int_equal(pthread_join(thread_ids[i], TSK_NULL), 0);
+	}
+
+	(void)pthread_barrier_destroy(&barrier);
+
+	for (TskUSize i = 0; i < TEST_THREADS_LENGTH; i++) {
+		for (TskUSize j = 0; j < TEST_TYPES_LENGTH; j++) {
+			assert_non_null(threads[i].types[j]);
+			assert_ptr_equal(threads[i].types[j], threads[0].types[j]);
+		}
+	}
+}
+
+static TskBoolean test_registry_key_equals(const TskAny *entry, const TskAny *key) {
+	return *(const TskU64 *)entry == *(const TskU64 *)key;
+}
+
+static void test_type_registry_claimed_prefix_does_not_block(void **state) {
+	(void)state;
+
+	static TskTypeRegistry registry = TSK_TYPE_REGISTRY(sizeof(TskU64));
+
+	TskU64  key_1                   = 1;
+	TskU64  hash_1                  = 0x0123456789ABCDEFULL;
+	TskAny *entry_1                 = TSK_NULL;
+	assert_int_equal(tsk_type_registry_find_or_claim(&registry, hash_1, test_registry_key_equals, &key_1, &entry_1), TSK_TYPE_REGISTRY_RESULT_CLAIMED);
+	assert_false(tsk_type_registry_contains(&registry, entry_1));
+
+	TskU64  key_2   = 2;
+	TskU64  hash_2  = 0x0123456700000000ULL;
+	TskAny *entry_2 = TSK_NULL;
+	assert_int_equal(tsk_type_registry_find_or_claim(&registry, hash_2, test_registry_key_equals, &key_2, &entry_2), TSK_TYPE_REGISTRY_RESULT_CLAIMED);
+	assert_ptr_not_equal(entry_1, entry_2);
+	assert_false(tsk_type_registry_contains(&registry, entry_2));
+
+	*(TskU64 *)entry_2 = key_2;
+	tsk_type_registry_publish(&registry, entry_2);
+	assert_true(tsk_type_registry_contains(&registry, entry_2));
+	assert_false(tsk_type_registry_contains(&registry, entry_1));
+
+	tsk_type_registry_abandon(&registry, entry_1);
+	assert_false(tsk_type_registry_contains(&registry, entry_1));
+
+	TskAny *entry = TSK_NULL;
+	assert_int_equal(tsk_type_registry_find_or_claim(&registry, hash_2, test_registry_key_equals, &key_2, &entry), TSK_TYPE_REGISTRY_RESULT_FOUND);
+	assert_ptr_equal(entry, entry_2);
+
+	assert_int_equal(tsk_type_registry_find_or_claim(&registry, hash_1, test_registry_key_equals, &key_1, &entry), TSK_TYPE_REGISTRY_RESULT_CLAIMED);
+	assert_ptr_not_equal(entry, entry_1);
+	*(TskU64 *)entry = key_1;
+	tsk_type_registry_publish(&registry, entry);
+	assert_true(tsk_type_registry_contains(&registry, entry));
+	assert_false(tsk_type_registry_contains(&registry, &key_1));
+}
+
+int main(void) {
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_type_registry_concurrent_first_use),
+		cmocka_unit_test(test_type_registry_claimed_prefix_does_not_block),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}